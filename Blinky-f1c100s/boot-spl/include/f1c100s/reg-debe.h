@@ -4,6 +4,7 @@
 #include <stdint.h>
 
 #define F1C100S_DEBE_BASE           (0x01e60000)
+#define F1C100S_DEBE_PALETTE        (0x1000)  /* 256 x ARGB8888, offset to base */
 
 struct f1c100s_debe_reg_t {
   uint8_t  res0[0x800];             /* 0x000 */
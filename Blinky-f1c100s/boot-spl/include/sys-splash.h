@@ -0,0 +1,57 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __SYS_SPLASH_H__
+#define __SYS_SPLASH_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// 棺SPLڿ̼֮ǰSPI FlashĹ̶ƫƶĻ
+// Ӧòfb-f1c100s.cӹʾ³ʼ()
+// tools/splash-packɣȫΪСˣ
+//   splash_header_t + RLE
+// RLEÿһֽڿͷbit7=1Ϊظ(7λ+1)κһأ
+// bit7=0Ϊ(7λ+1)أΪB,G,RֽڣдϽУ
+// ߾Ŀߡ
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SPLASH_FLASH_OFFSET
+#define SPLASH_FLASH_OFFSET   (0x00c00000)    // ڹ̼֮󣬼<F1C100s.sct>
+#endif
+#define SPLASH_MAGIC          (0x48504c53UL)  // "SLPH"
+#define SPLASH_MAX_SIZE       (2048)          // ޣֹ
+#define SPLASH_PLL_VIDEO_HZ   (198000000)     // sys_clock_init()õPLL_VIDEO
+#define SPLASH_FLAG_HSYNC_HI  (1 << 0)
+#define SPLASH_FLAG_VSYNC_HI  (1 << 1)
+
+// 뻺Դ(FB_MEM_BASE)Ӧ÷Դ治صʱԽӹ
+#define SPLASH_FB_END         (0x82000000UL)  // FB_MEM_BASE + FB_MEM_SIZE
+#define SPLASH_FB_ADDR(w, h)  ((SPLASH_FB_END - (uint32_t)(w) * (h) * 4) & ~0xfffUL)
+
+typedef struct {
+  uint32_t magic;             // SPLASH_MAGIC
+  uint16_t width;             // ߣͼ
+  uint16_t height;
+  uint32_t pixel_clock_hz;
+  uint16_t h_front_porch;
+  uint16_t h_back_porch;
+  uint16_t h_sync_len;
+  uint16_t v_front_porch;
+  uint16_t v_back_porch;
+  uint16_t v_sync_len;
+  uint8_t bits_per_pixel;     // λ(16/18/24)
+  uint8_t flags;              // SPLASH_FLAG_xxx
+  uint16_t reserved;
+  uint32_t size;              // RLEݵֽ
+} splash_header_t;
+
+void sys_splash_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SYS_SPLASH_H__ */
@@ -0,0 +1,219 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+////////////////////////////////////////////////////////////////////////////////
+// SPLĿ棺ʱ뻹SRAMУӵַϻûж
+// ﲻȫֱַĴֱַд
+// Ƚ뵽SPLASH_FB_ADDRٿTCON/DEBEͱ⣬֮ſ̼
+// Ӧòfb-f1c100s.cʾѿžֱӽӹܡ
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include "f1c100s/reg-tcon.h"
+#include "f1c100s/reg-debe.h"
+#include "sys-splash.h"
+#include "io.h"
+
+extern void sys_spi_flash_read(int addr, void* buf, int count);
+extern void mmu_clean_dcache(void);
+
+typedef struct {
+  uint32_t addr;              // һζFlashַ
+  uint32_t left;              // ûRLEֽ
+  uint32_t pos;
+  uint32_t len;
+  uint8_t buf[512];
+} splash_in_t;
+
+static int splash_getc(splash_in_t* in)
+{
+  if (in->pos >= in->len) {
+    if (in->left == 0)
+      return -1;
+    in->len = (in->left < sizeof(in->buf)) ? in->left : sizeof(in->buf);
+    sys_spi_flash_read(in->addr, in->buf, in->len);
+    in->addr += in->len;
+    in->left -= in->len;
+    in->pos = 0;
+  }
+  return in->buf[in->pos++];
+}
+
+static int splash_getpixel(splash_in_t* in, uint32_t* c)
+{
+  int b, g, r;
+
+  b = splash_getc(in);
+  g = splash_getc(in);
+  r = splash_getc(in);
+  if (r < 0)
+    return -1;
+  *c = ((uint32_t)r << 16) | ((uint32_t)g << 8) | (uint32_t)b;
+  return 0;
+}
+
+/*
+ * nصfb
+ * @return: 0ɹݲԽ緵-1
+ */
+static int splash_decode(splash_in_t* in, uint32_t* fb, uint32_t n)
+{
+  uint32_t i = 0, k, c;
+  int t;
+
+  while (i < n) {
+    t = splash_getc(in);
+    if (t < 0)
+      return -1;
+    k = (t & 0x7f) + 1;
+    if (k > n - i)
+      return -1;
+    if (t & 0x80) {
+      if (splash_getpixel(in, &c) != 0)
+        return -1;
+      while (k--)
+        fb[i++] = c;
+    } else {
+      while (k--) {
+        if (splash_getpixel(in, &c) != 0)
+          return -1;
+        fb[i++] = c;
+      }
+    }
+  }
+  return 0;
+}
+
+/*
+ * ʱӡλLCDţfb_f1c100s_init()ͬ
+ */
+static void splash_hw_init(void)
+{
+  uint32_t val;
+
+  // DEBEʱȡPLL_VIDEOƵf1c100s_clk_debe_init()Ľһ
+  write32(0x01c20104, (1UL << 31) | (0 << 24) | (0xf << 0));
+  write32(0x01c20118, read32(0x01c20118) | (1UL << 31));        // TCONʱ
+  write32(0x01c20064, read32(0x01c20064) | (1 << 12) | (1 << 4)); // DEBE/TCON
+  write32(0x01c202c4, read32(0x01c202c4) | (1 << 12) | (1 << 4)); // λ
+
+  // PD0~PD21ΪLCD(2)ǿ
+  write32(0x01c2086c + 0x00, 0x22222222);
+  write32(0x01c2086c + 0x04, 0x22222222);
+  val = read32(0x01c2086c + 0x08) & ~0x00ffffffUL;
+  write32(0x01c2086c + 0x08, val | 0x00222222);
+  write32(0x01c2086c + 0x14, 0xffffffff);
+  val = read32(0x01c2086c + 0x18) & ~0x00000fffUL;
+  write32(0x01c2086c + 0x18, val | 0x00000fff);
+  write32(0x01c2086c + 0x1c, 0);
+  val = read32(0x01c2086c + 0x20) & ~0x00000fffUL;
+  write32(0x01c2086c + 0x20, val);
+}
+
+static void splash_debe_init(splash_header_t const* h, uint32_t addr)
+{
+  struct f1c100s_debe_reg_t* debe = (struct f1c100s_debe_reg_t*)F1C100S_DEBE_BASE;
+  uint32_t i, size;
+
+  for (i = 0x0800; i < 0x1000; i += 4)
+    write32(F1C100S_DEBE_BASE + i, 0);
+  size = ((uint32_t)(h->height - 1) << 16) | (uint32_t)(h->width - 1);
+  write32((uint32_t)&debe->mode, read32((uint32_t)&debe->mode) | (1 << 0));
+  write32((uint32_t)&debe->disp_size, size);
+  write32((uint32_t)&debe->layer0_size, size);
+  write32((uint32_t)&debe->layer0_stride, (uint32_t)h->width << 5);
+  write32((uint32_t)&debe->layer0_addr_low32b, addr << 3);
+  write32((uint32_t)&debe->layer0_addr_high4b, addr >> 29);
+  write32((uint32_t)&debe->layer0_attr1_ctrl, (0x09 << 8) | (1 << 2));  // XRGB8888
+  write32((uint32_t)&debe->mode, read32((uint32_t)&debe->mode) | (1 << 8));
+  write32((uint32_t)&debe->reg_ctrl, read32((uint32_t)&debe->reg_ctrl) | (1 << 0));
+  write32((uint32_t)&debe->mode, read32((uint32_t)&debe->mode) | (1 << 1));
+}
+
+/*
+ * fb-f1c100s.cf1c100s_tcon_set_mode()ͬʱȡļͷ
+ */
+static void splash_tcon_init(splash_header_t const* h)
+{
+  struct f1c100s_tcon_reg_t* tcon = (struct f1c100s_tcon_reg_t*)F1C100S_TCON_BASE;
+  uint32_t val, bp, total;
+
+  write32((uint32_t)&tcon->ctrl, 0);
+  write32((uint32_t)&tcon->int0, 0);
+  val = h->v_front_porch + h->v_back_porch + h->v_sync_len;
+  write32((uint32_t)&tcon->tcon0_ctrl, (1UL << 31) | ((val & 0x1f) << 4));
+  val = SPLASH_PLL_VIDEO_HZ / h->pixel_clock_hz;
+  write32((uint32_t)&tcon->tcon0_dclk, (0xFUL << 28) | (val << 0));
+  write32((uint32_t)&tcon->tcon0_timing_active, ((uint32_t)(h->width - 1) << 16) | (uint32_t)(h->height - 1));
+
+  bp = h->h_sync_len + h->h_back_porch;
+  total = h->width + h->h_front_porch + bp;
+  write32((uint32_t)&tcon->tcon0_timing_h, ((total - 1) << 16) | ((bp - 1) << 0));
+  bp = h->v_sync_len + h->v_back_porch;
+  total = h->height + h->v_front_porch + bp;
+  write32((uint32_t)&tcon->tcon0_timing_v, ((total * 2) << 16) | ((bp - 1) << 0));
+  write32((uint32_t)&tcon->tcon0_timing_sync, ((uint32_t)(h->h_sync_len - 1) << 16) | (uint32_t)(h->v_sync_len - 1));
+  write32((uint32_t)&tcon->tcon0_hv_intf, 0);
+  write32((uint32_t)&tcon->tcon0_cpu_intf, 0);
+
+  if (h->bits_per_pixel == 18 || h->bits_per_pixel == 16) {
+    for (val = 0; val < 6; val++)
+      write32((uint32_t)&tcon->tcon0_frm_seed[val], 0x11111111);
+    write32((uint32_t)&tcon->tcon0_frm_table[0], 0x01010000);
+    write32((uint32_t)&tcon->tcon0_frm_table[1], 0x15151111);
+    write32((uint32_t)&tcon->tcon0_frm_table[2], 0x57575555);
+    write32((uint32_t)&tcon->tcon0_frm_table[3], 0x7f7f7777);
+    write32((uint32_t)&tcon->tcon0_frm_ctrl, (h->bits_per_pixel == 18) ? ((1UL << 31) | (0 << 4)) : ((1UL << 31) | (5 << 4)));
+  }
+
+  val = (1 << 28);
+  if (!(h->flags & SPLASH_FLAG_HSYNC_HI))
+    val |= (1 << 25);
+  if (!(h->flags & SPLASH_FLAG_VSYNC_HI))
+    val |= (1 << 24);
+  write32((uint32_t)&tcon->tcon0_io_polarity, val);
+  write32((uint32_t)&tcon->tcon0_io_tristate, 0);
+  write32((uint32_t)&tcon->ctrl, (1UL << 31));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: sys_splash_init
+//|  |: SPLASH_FLASH_OFFSET沢Ļ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: sys_mmu_init()sys_spi_flash_init()֮󡢿̼֮ǰã
+//|          |: ûлݲʱʲôҲʾӦòʼ
+//|          |: GPIO(PE6)ֱӴ򿪣ӦòPWMʼٽ֡
+////////////////////////////////////////////////////////////////////////////////
+void sys_splash_init(void)
+{
+  splash_in_t in;
+  splash_header_t h;
+  uint32_t addr, val;
+
+  sys_spi_flash_read(SPLASH_FLASH_OFFSET, &h, sizeof(h));
+  if (h.magic != SPLASH_MAGIC || h.width == 0 || h.width > SPLASH_MAX_SIZE ||
+      h.height == 0 || h.height > SPLASH_MAX_SIZE || h.pixel_clock_hz == 0 ||
+      h.h_sync_len == 0 || h.v_sync_len == 0 || (SPLASH_PLL_VIDEO_HZ / h.pixel_clock_hz) > 0x7f)
+    return;
+
+  addr = SPLASH_FB_ADDR(h.width, h.height);
+  in.addr = SPLASH_FLASH_OFFSET + sizeof(h);
+  in.left = h.size;
+  in.pos = 0;
+  in.len = 0;
+  if (splash_decode(&in, (uint32_t*)addr, (uint32_t)h.width * h.height) != 0)
+    return;
+  mmu_clean_dcache();
+
+  splash_hw_init();
+  splash_debe_init(&h, addr);
+  splash_tcon_init(&h);
+
+  // PE6ߵƽ
+  val = read32(0x01c20890 + 0x00) & ~(0xfUL << 24);
+  write32(0x01c20890 + 0x00, val | (0x1UL << 24));
+  write32(0x01c20890 + 0x10, read32(0x01c20890 + 0x10) | (1 << 6));
+}
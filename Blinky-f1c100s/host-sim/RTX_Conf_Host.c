@@ -0,0 +1,34 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include <stdio.h>
+#include <stdlib.h>
+#include "efxinc.h"
+
+// Linux϶Ӧ<RTX_Conf_F1C100s.c>Ļص֣ں˱<rtx_pthread.c>
+
+/*--------------------------- os_tmr_call -----------------------------------*/
+
+void os_tmr_call(U16 info)
+{
+#if UFX_TIMERCNT > 0
+  UFX_PostTaskTimer(info);
+#endif
+}
+
+/*--------------------------- os_error --------------------------------------*/
+
+void os_error(U32 err_code)
+{
+  switch (err_code) {
+    case OS_ERR_STK_OVF:
+      DBG_PRINT("\nOS_ERR_STK_OVF(%u)\n", isr_tsk_get());
+      break;
+    case OS_ERR_FIFO_OVF:
+      break;
+    case OS_ERR_MBX_OVF:
+      break;
+  }
+  DBG_PRINT("\nos_error(%u)\n", err_code);
+}
+
+////////////////////////////////////////////////////////////////////////////////
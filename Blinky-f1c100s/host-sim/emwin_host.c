@@ -0,0 +1,258 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include <string.h>
+#include "efxinc.h"
+#include "GUI.h"
+#include "GUIDRV_Lin.h"
+#include "LCDConf.h"
+#include "framebuffer.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// LinuxemWinֻARMemWin⣬޷ӣ
+// ֻʵLCDConf.c/GUI_X_RTX.c/GUI_Touch.cõýӿڣ
+// ЩˮԭУMainTask()һֱдVRAMĲͼ
+// GUIDEMO֤ʾ·(vblank˫ץ֡)Ƿ
+////////////////////////////////////////////////////////////////////////////////
+
+const GUI_DEVICE_API GUIDRV_Lin_32_API;
+const GUI_DEVICE_API GUIDRV_Lin_8_API;
+const LCD_API_COLOR_CONV LCD_API_ColorConv_8888;
+const LCD_API_COLOR_CONV LCD_API_ColorConv_8666;
+const LCD_API_COLOR_CONV LCD_API_ColorConv_M8888I;
+GUI_CONST_STORAGE GUI_FONT GUI_Font6x8;
+
+/* <LCDConf.c><GUI_X_RTX.c>ļ */
+void GUI_X_Config(void);
+void LCD_X_Config(void);
+int  LCD_X_DisplayDriver(unsigned LayerIndex, unsigned Cmd, void* pData);
+
+static struct {
+  int xSize, ySize;
+  int vxSize, vySize;
+  void* pVRAM;
+} _layer;
+
+// ͼ8ɫ(XRGB)8bppʱlayer0ڵɫе±
+static U32 const _bars[8] = {
+  0xFFFFFF, 0xFFFF00, 0x00FFFF, 0x00FF00,
+  0xFF00FF, 0xFF0000, 0x0000FF, 0x000000,
+};
+
+#if (FB_LAYER0_BPP == 8)
+typedef U8  PIXEL;
+#define __PIX(i)  ((PIXEL)(i))
+#else
+typedef U32 PIXEL;
+#define __PIX(i)  (_bars[i])
+#endif
+
+// ͼ֮֡澲ֹ
+#ifndef SIM_ANIM_FRAMES
+#define SIM_ANIM_FRAMES (120)
+#endif
+
+static GUI_PID_STATE _pid;
+static bool_t _inited = false;
+
+// LCDConf.cǼǵLCD_DEVFUNC_DRAWBMP_32BPP(׷⿽)
+typedef void (*DRAWBMP32_FUNC)(int LayerIndex, int x, int y, U32 const* p, int xSize, int ySize, int BytesPerLine);
+static DRAWBMP32_FUNC _pfDrawBmp32;
+
+GUI_DEVICE* GUI_DEVICE_CreateAndLink(const GUI_DEVICE_API* pDeviceAPI, const LCD_API_COLOR_CONV* pColorConvAPI, U16 Flags, int LayerIndex)
+{
+  (void)pDeviceAPI;
+  (void)pColorConvAPI;
+  (void)Flags;
+  (void)LayerIndex;
+  return NULL;
+}
+
+int LCD_GetSwapXY(void)
+{
+  return 0;
+}
+
+// ͼֻlayer0ϣǲú
+int LCD_SetSizeEx(int LayerIndex, int xSize, int ySize)
+{
+  if (LayerIndex != 0)
+    return 0;
+  _layer.xSize = xSize;
+  _layer.ySize = ySize;
+  return 0;
+}
+
+int LCD_SetVSizeEx(int LayerIndex, int xSize, int ySize)
+{
+  if (LayerIndex != 0)
+    return 0;
+  _layer.vxSize = xSize;
+  _layer.vySize = ySize;
+  return 0;
+}
+
+int LCD_SetVRAMAddrEx(int LayerIndex, void* pVRAM)
+{
+  if (LayerIndex != 0)
+    return 0;
+  _layer.pVRAM = pVRAM;
+  return 0;
+}
+
+int LCD_SetDevFunc(int LayerIndex, int IdFunc, void (* pDriverFunc)(void))
+{
+  if (LayerIndex != 0 || IdFunc != LCD_DEVFUNC_DRAWBMP_32BPP)
+    return 1;
+  _pfDrawBmp32 = (DRAWBMP32_FUNC)pDriverFunc;
+  return 0;
+}
+
+void GUI_ALLOC_AssignMemory(void* p, U32 NumBytes)
+{
+  (void)p;
+  (void)NumBytes;
+}
+
+void GUI_ALLOC_SetAvBlockSize(U32 BlockSize)
+{
+  (void)BlockSize;
+}
+
+void GUI_SetOnErrorFunc(void (*pFunc)(const char* s))
+{
+  (void)pFunc;
+}
+
+void GUITASK_SetMaxTask(int MaxTask)
+{
+  (void)MaxTask;
+}
+
+void GUI_SetDefaultFont(const GUI_FONT* pFont)
+{
+  (void)pFont;
+}
+
+void GUI_TOUCH_StoreStateEx(const GUI_PID_STATE* pState)
+{
+  CPU_SR_DECL;
+
+  CPU_ENTER_CRITICAL();
+  _pid = *pState;
+  CPU_EXIT_CRITICAL();
+}
+
+int GUI_Init(void)
+{
+  if (!_inited) {
+    _inited = true;
+    GUI_X_Config();
+    LCD_X_Config();
+    LCD_X_DisplayDriver(0, LCD_X_INITCONTROLLER, NULL);
+#if (FB_LAYER0_BPP == 8)
+    {
+      LCD_X_SETLUTENTRY_INFO lut;
+      U32 c;
+
+      // ͬemWinLCD_InitLUT()ɫLCD_COLOR(0xBBGGRR)
+      for (c = 0; c < 8; c++) {
+        lut.Pos = (U8)c;
+        lut.Color = ((_bars[c] & 0xff) << 16) | (_bars[c] & 0xff00) | ((_bars[c] >> 16) & 0xff);
+        LCD_X_DisplayDriver(0, LCD_X_SETLUTENTRY, &lut);
+      }
+    }
+#endif
+  }
+  return 0;
+}
+
+void GUI_SetOrg(int x, int y)
+{
+  LCD_X_SETORG_INFO info;
+
+  info.xPos = x;
+  info.yPos = y;
+  LCD_X_DisplayDriver(0, LCD_X_SETORG, &info);
+}
+
+/*
+* ͼ8(°벿ַ) + һƶİ׿ + ʮ
+* @return: none
+*/
+static void __draw_pattern(U32 n)
+{
+  int x, y, bx, by, w = _layer.vxSize, h = _layer.vySize;
+  GUI_PID_STATE pid;
+  PIXEL* p = (PIXEL*)_layer.pVRAM;
+  CPU_SR_DECL;
+
+  if (p == NULL || w <= 0 || h <= 0)
+    return;
+  for (y = 0; y < h; y++) {
+    for (x = 0; x < w; x++) {
+      p[y * w + x] = __PIX((y < _layer.ySize) ? x * 8 / w : 7 - x * 8 / w);
+    }
+  }
+  bx = (int)(n * 4 % (U32)(2 * (w - 32)));
+  if (bx >= w - 32)
+    bx = 2 * (w - 32) - bx;
+  by = (h - 32) / 2;
+#if (FB_LAYER0_BPP == 32)
+  // ǼDRAWBMP_32BPPʱ׿洢豸鿽ȥ׷·
+  if (_pfDrawBmp32) {
+    static U32 block[32 * 32];
+
+    for (x = 0; x < 32 * 32; x++)
+      block[x] = __PIX(0);
+    _pfDrawBmp32(0, bx, by, block, 32, 32, 32 * 4);
+  } else
+#endif
+  for (y = by; y < by + 32; y++) {
+    for (x = bx; x < bx + 32; x++) {
+      p[y * w + x] = __PIX(0);
+    }
+  }
+  CPU_ENTER_CRITICAL();
+  pid = _pid;
+  CPU_EXIT_CRITICAL();
+  if (pid.Pressed && pid.x >= 0 && pid.x < w && pid.y >= 0 && pid.y < h) {
+    for (x = 0; x < w; x++)
+      p[pid.y * w + x] = __PIX(5);
+    for (y = 0; y < h; y++)
+      p[y * w + pid.x] = __PIX(5);
+  }
+}
+
+void MainTask(void)
+{
+  U32 n = 0;
+  int range;
+  ColorMatrixType cm;
+
+  GUI_Init();
+  for (;;) {
+    // SIM_ANIM_FRAMES֡澲ֹ(ʱճػ)֤ˢʵƵ
+    if (n >= SIM_ANIM_FRAMES && !_pid.Pressed) {
+      GUI_X_Delay(16);
+      continue;
+    }
+    LCDCONF_Invalidate();
+    __draw_pattern(n);
+    // ͷһɫӺɫ룬֤LCDCONF_SetColorMatrix()
+    if (n <= 64) {
+      CSC_Identity(&cm);
+      CSC_Fade(&cm, (int32_t)n * 4);
+      LCDCONF_SetColorMatrix(&cm);
+    }
+    // ƽʾڣ֤_SetOrg()
+    range = _layer.vySize - _layer.ySize;
+    if (range > 0) {
+      int y = (int)(n * 2 % (U32)(2 * range));
+      GUI_SetOrg(0, (y > range) ? 2 * range - y : y);
+    }
+    n++;
+    GUI_X_Delay(16);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
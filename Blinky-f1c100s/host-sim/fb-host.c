@@ -0,0 +1,683 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include "framebuffer.h"
+#include "f1c100s-irq.h"
+#include "target.h"
+#include "ftrace.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// LinuxframebufferAPIͬ<fb-f1c100s.c>һˢе
+// vblank߳ģTCON֡жϣÿvblankʱץȡǰʾĻ塣
+//
+// 
+//   SIM_PANEL     (800x480fb-panel.c)ȱʡΪFB_PANEL
+//   SIM_PNG_DIR   ÿSIM_PNG_EVERY֡(ĬΪˢ)һPNGĿ¼
+//   SIM_RAW       ÿһ֡XRGB8888׷дļ(ffmpegֱӲ)
+//   SIM_FRAMES    ָ֡˳
+//   SIM_SECONDS   ָ˳
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+  // ͰĻ壬ɨʱ
+  fb_panel_t const* panel;
+  int32_t width;
+  int32_t height;
+  int32_t vwidth;
+  int32_t vheight;
+  int32_t hz;
+  int32_t vstart;
+  int32_t vtotal;
+  long line_ns;
+  uint8_t* mem;
+
+  uint8_t* vram[2];
+  volatile int index;
+  int32_t brightness;
+
+  // ͬDEBE layer0base+ԭvblankʱ浽scanɨоΪ
+  uint8_t* base;
+  int32_t xorg;
+  int32_t yorg;
+  uint8_t* volatile scan;
+
+  // ɫģʽ256ɫlayer1ǲ
+  uint32_t palette[256];
+  uint32_t* ovl;
+  int32_t ovl_x;
+  int32_t ovl_y;
+  int32_t ovl_on;
+  int32_t ovl_key;
+  uint32_t key_min;
+  uint32_t key_max;
+
+  // ɫץ֡ʱCSC_Apply()DEBEͬ
+  ColorMatrixType csc;
+  int32_t csc_en;
+
+  // fb_f1c100s_commit()ݴʾ״̬ɻصvblankʱһ
+  fb_state_t next;
+  fb_commit_cb_t cb[FB_COMMIT_CB_MAX];
+  void* cb_arg[FB_COMMIT_CB_MAX];
+  int32_t ncb;
+
+  // TCONжϣı־жϵк(<0Ϊر)
+  volatile uint32_t irq_flags;
+  volatile int32_t irq_line;
+
+  // ˢʵĵʱӷƵ֡ں֮Ŵ
+  volatile int32_t refresh_div;
+} fb_host_priv_data_t;
+
+#define FB_HOST_BYTES   (FB_LAYER0_BPP / 8)
+
+static fb_host_priv_data_t fb_host_priv_object;
+static pthread_t _vblank_thread;
+static bool_t _vblank_running = false;
+
+/* <png_write.c>ļ */
+int png_write_xrgb(char const* path, uint32_t const* pixels, int width, int height);
+
+static void __ts_add(struct timespec* ts, long ns)
+{
+  ts->tv_nsec += ns;
+  while (ts->tv_nsec >= 1000000000L) {
+    ts->tv_nsec -= 1000000000L;
+    ts->tv_sec++;
+  }
+}
+
+static unsigned long __env_ulong(char const* name, unsigned long def)
+{
+  char const* s = getenv(name);
+
+  return (s && *s) ? strtoul(s, NULL, 0) : def;
+}
+
+/*
+* һ֡
+* @return: none
+*/
+static void __capture(fb_host_priv_data_t const* pdat, uint32_t const* frame, unsigned long n,
+                      char const* png_dir, unsigned long png_every, FILE* raw)
+{
+  char path[512];
+
+  if (raw) {
+    fwrite(frame, 4, pdat->width * pdat->height, raw);
+  }
+  if (png_dir && png_every && (n % png_every) == 0) {
+    snprintf(path, sizeof(path), "%s/frame_%05lu.png", png_dir, n);
+    if (png_write_xrgb(path, frame, pdat->width, pdat->height) != 0) {
+      fprintf(stderr, "fb-host: cannot write %s\n", path);
+    }
+  }
+}
+
+/* ǲصR/G/BǷɫΧ */
+static int __keyed(fb_host_priv_data_t const* pdat, uint32_t c)
+{
+  int sh;
+
+  for (sh = 0; sh <= 16; sh += 8) {
+    if (((c >> sh) & 0xff) < ((pdat->key_min >> sh) & 0xff) ||
+        ((c >> sh) & 0xff) > ((pdat->key_max >> sh) & 0xff))
+      return 0;
+  }
+  return 1;
+}
+
+/*
+* DEBEķʽϳһ֡layer0(32bppɫ) + alphaϵĸǲ㣬
+* ɫʱɫΧڵĸǲزʾ
+* @return: none
+*/
+static void __compose(fb_host_priv_data_t* pdat, uint32_t* frame)
+{
+  uint8_t const* scan = pdat->scan;
+  uint32_t const* src;
+  uint32_t o, c, a;
+  int x, y, ox, oy, w = pdat->width, h = pdat->height;
+
+  for (y = 0; y < h; y++) {
+#if (FB_LAYER0_BPP == 8)
+    for (x = 0; x < w; x++)
+      frame[y * w + x] = pdat->palette[scan[y * pdat->vwidth + x]];
+#else
+    memcpy(&frame[y * w], &scan[y * pdat->vwidth * 4], w * 4);
+#endif
+  }
+  if (pdat->ovl == NULL || !pdat->ovl_on)
+    return;
+  for (y = 0; y < h; y++) {
+    oy = y - pdat->ovl_y;
+    if (oy < 0 || oy >= h)
+      continue;
+    src = &pdat->ovl[oy * w];
+    for (x = 0; x < w; x++) {
+      ox = x - pdat->ovl_x;
+      if (ox < 0 || ox >= w)
+        continue;
+      o = src[ox];
+      if (pdat->ovl_key && __keyed(pdat, o))
+        continue;
+      a = o >> 24;
+      c = frame[y * w + x];
+      frame[y * w + x] =
+        ((((o >> 16) & 0xff) * a + ((c >> 16) & 0xff) * (255 - a)) / 255) << 16 |
+        ((((o >> 8) & 0xff) * a + ((c >> 8) & 0xff) * (255 - a)) / 255) << 8 |
+        (((o & 0xff) * a + (c & 0xff) * (255 - a)) / 255);
+    }
+  }
+}
+
+/*
+* vblanḳ߳൱TCON֡ж
+* @return: none
+*/
+static void* __vblank_thread(void* arg)
+{
+  fb_host_priv_data_t* pdat = (fb_host_priv_data_t*)arg;
+  uint32_t* frame = (uint32_t*)malloc(pdat->width * pdat->height * 4);
+  char const* png_dir = getenv("SIM_PNG_DIR");
+  char const* raw_path = getenv("SIM_RAW");
+  unsigned long png_every = __env_ulong("SIM_PNG_EVERY", pdat->hz);
+  unsigned long max_frames = __env_ulong("SIM_FRAMES", 0);
+  unsigned long seconds = __env_ulong("SIM_SECONDS", 0);
+  unsigned long n = 0, periods = 0;
+  struct timespec next, vb, at;
+  int32_t line, div;
+  FILE* raw = NULL;
+  CPU_SR_DECL;
+
+  if (frame == NULL)
+    return NULL;
+  if (png_dir && !*png_dir)
+    png_dir = NULL;
+  if (raw_path && *raw_path) {
+    raw = fopen(raw_path, "wb");
+    if (raw == NULL)
+      perror(raw_path);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &next);
+  for (;;) {
+    vb = next;
+    div = pdat->refresh_div;
+    periods += div;
+    __ts_add(&next, pdat->line_ns * pdat->vtotal * div);
+    // жϣ֡ɨָеʱ(ж˺)
+    while ((line = pdat->irq_line) >= 0) {
+      at = vb;
+      __ts_add(&at, (pdat->vstart + line) * pdat->line_ns * div);
+      if (at.tv_sec > next.tv_sec || (at.tv_sec == next.tv_sec && at.tv_nsec >= next.tv_nsec))
+        break;
+      while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &at, NULL) == EINTR);
+      if (pdat->irq_line != line)
+        continue;
+      pdat->irq_flags |= FB_IRQ_LINE;
+      host_raise_irq(F1C100S_IRQ_LCD);
+      if (pdat->irq_line == line)
+        break;
+    }
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR);
+
+    // ֡жɨvblankʼʱĻ壬ٽ�⿴֡
+    pdat->irq_flags |= FB_IRQ_VBLANK;
+    host_raise_irq(F1C100S_IRQ_LCD);
+    CPU_ENTER_CRITICAL();
+    __compose(pdat, frame);
+    if (pdat->csc_en)
+      CSC_Apply(&pdat->csc, frame, pdat->width * pdat->height);
+    CPU_EXIT_CRITICAL();
+
+    n++;
+    __capture(pdat, frame, n, png_dir, png_every, raw);
+    // SIM_SECONDSȫ֡ڼƣƵʱɨ֡
+    if ((max_frames && n >= max_frames) || (seconds && periods >= seconds * pdat->hz)) {
+      if (raw)
+        fclose(raw);
+      // һ֡Ǳ棬عȶ
+      if (png_dir && png_every && (n % png_every) != 0)
+        __capture(pdat, frame, 0, png_dir, 1, NULL);
+      fflush(stdout);
+      printf("fb-host: %lu frames, exit\n", n);
+      LCDCONF_ReportRefresh();
+      exit(0);
+    }
+  }
+  return NULL;
+}
+
+void fb_f1c100s_setbl(framebuffer_t* fb, int32_t brightness)
+{
+  fb_host_priv_data_t* pdat = (fb_host_priv_data_t*)fb->priv;
+
+  pdat->brightness = brightness;
+}
+
+int32_t fb_f1c100s_getbl(framebuffer_t* fb)
+{
+  fb_host_priv_data_t* pdat = (fb_host_priv_data_t*)fb->priv;
+
+  return pdat->brightness;
+}
+
+/*
+* ӹύ֮״̬ʼһͬ<fb-f1c100s.c>
+* @return: none
+*/
+void fb_f1c100s_begin(framebuffer_t* fb, fb_state_t* st)
+{
+  fb_host_priv_data_t* pdat = (fb_host_priv_data_t*)fb->priv;
+  fb_state_t const* nx;
+  CPU_SR_DECL;
+
+  st->flags = 0;
+  if (!pdat)
+    return;
+  nx = &pdat->next;
+  CPU_ENTER_CRITICAL();
+  st->base = (nx->flags & FB_STATE_BASE) ? nx->base : pdat->base;
+  st->xorg = (nx->flags & FB_STATE_ORIGIN) ? nx->xorg : pdat->xorg;
+  st->yorg = (nx->flags & FB_STATE_ORIGIN) ? nx->yorg : pdat->yorg;
+  st->ovl_on = (nx->flags & FB_STATE_OVL_SHOW) ? nx->ovl_on : pdat->ovl_on;
+  st->ovl_x = (nx->flags & FB_STATE_OVL_POS) ? nx->ovl_x : pdat->ovl_x;
+  st->ovl_y = (nx->flags & FB_STATE_OVL_POS) ? nx->ovl_y : pdat->ovl_y;
+  st->key_on = (nx->flags & FB_STATE_OVL_KEY) ? nx->key_on : pdat->ovl_key;
+  st->key_min = (nx->flags & FB_STATE_OVL_KEY) ? nx->key_min : pdat->key_min;
+  st->key_max = (nx->flags & FB_STATE_OVL_KEY) ? nx->key_max : pdat->key_max;
+  st->csc_en = (nx->flags & FB_STATE_CSC) ? nx->csc_en : pdat->csc_en;
+  st->csc = (nx->flags & FB_STATE_CSC) ? nx->csc : pdat->csc;
+  CPU_EXIT_CRITICAL();
+}
+
+/*
+* ݴһύһvblankǰĶύֶκϲ
+* @return: 0ɹصʱ-1ʲôݴ
+*/
+int32_t fb_f1c100s_commit(framebuffer_t* fb, fb_state_t const* st, fb_commit_cb_t cb, void* arg)
+{
+  fb_host_priv_data_t* pdat = (fb_host_priv_data_t*)fb->priv;
+  fb_state_t* nx;
+  int32_t x, y;
+  CPU_SR_DECL;
+
+  if (!pdat)
+    return -1;
+  CPU_ENTER_CRITICAL();
+  if (cb && pdat->ncb >= FB_COMMIT_CB_MAX) {
+    CPU_EXIT_CRITICAL();
+    return -1;
+  }
+  nx = &pdat->next;
+  if ((st->flags & FB_STATE_BASE) && st->base) {
+    nx->base = st->base;
+    nx->flags |= FB_STATE_BASE;
+  }
+  if (st->flags & FB_STATE_ORIGIN) {
+    x = st->xorg;
+    y = st->yorg;
+    if (x > pdat->vwidth - pdat->width)
+      x = pdat->vwidth - pdat->width;
+    if (x < 0)
+      x = 0;
+    if (y > pdat->vheight - pdat->height)
+      y = pdat->vheight - pdat->height;
+    if (y < 0)
+      y = 0;
+    nx->xorg = x;
+    nx->yorg = y;
+    nx->flags |= FB_STATE_ORIGIN;
+  }
+  if (pdat->ovl && (st->flags & FB_STATE_OVL_SHOW)) {
+    nx->ovl_on = st->ovl_on ? 1 : 0;
+    nx->flags |= FB_STATE_OVL_SHOW;
+  }
+  if (pdat->ovl && (st->flags & FB_STATE_OVL_POS)) {
+    nx->ovl_x = st->ovl_x;
+    nx->ovl_y = st->ovl_y;
+    nx->flags |= FB_STATE_OVL_POS;
+  }
+  if (pdat->ovl && (st->flags & FB_STATE_OVL_KEY)) {
+    nx->key_on = st->key_on ? 1 : 0;
+    nx->key_min = st->key_min & 0x00ffffff;
+    nx->key_max = st->key_max & 0x00ffffff;
+    nx->flags |= FB_STATE_OVL_KEY;
+  }
+  if (st->flags & FB_STATE_CSC) {
+    nx->csc_en = (st->csc_en && !CSC_IsIdentity(&st->csc)) ? 1 : 0;
+    nx->csc = st->csc;
+    nx->flags |= FB_STATE_CSC;
+  }
+  if (cb) {
+    pdat->cb[pdat->ncb] = cb;
+    pdat->cb_arg[pdat->ncb] = arg;
+    pdat->ncb++;
+  }
+  CPU_EXIT_CRITICAL();
+  return 0;
+}
+
+int32_t fb_f1c100s_commit_pending(framebuffer_t* fb)
+{
+  fb_host_priv_data_t* pdat = (fb_host_priv_data_t*)fb->priv;
+
+  return (pdat && (pdat->next.flags || pdat->ncb)) ? 1 : 0;
+}
+
+/*
+* ֡жݴ״̬ٵɻص
+* @return: none
+*/
+void fb_f1c100s_vsync(framebuffer_t* fb)
+{
+  fb_host_priv_data_t* pdat = (fb_host_priv_data_t*)fb->priv;
+  fb_state_t* nx;
+  uint32_t flags;
+  int32_t i, n;
+
+  if (!pdat || (!pdat->next.flags && !pdat->ncb))
+    return;
+  nx = &pdat->next;
+  flags = nx->flags;
+  nx->flags = 0;
+  if (flags & FB_STATE_BASE)
+    pdat->base = (uint8_t*)nx->base;
+  if (flags & FB_STATE_ORIGIN) {
+    pdat->xorg = nx->xorg;
+    pdat->yorg = nx->yorg;
+  }
+  if (flags & (FB_STATE_BASE | FB_STATE_ORIGIN))
+    pdat->scan = pdat->base + (pdat->yorg * pdat->vwidth + pdat->xorg) * FB_HOST_BYTES;
+  if (flags & FB_STATE_OVL_SHOW)
+    pdat->ovl_on = nx->ovl_on;
+  if (flags & FB_STATE_OVL_POS) {
+    pdat->ovl_x = nx->ovl_x;
+    pdat->ovl_y = nx->ovl_y;
+  }
+  if (flags & FB_STATE_OVL_KEY) {
+    pdat->ovl_key = nx->key_on;
+    pdat->key_min = nx->key_min;
+    pdat->key_max = nx->key_max;
+  }
+  if (flags & FB_STATE_CSC) {
+    pdat->csc = nx->csc;
+    pdat->csc_en = nx->csc_en;
+  }
+
+  n = pdat->ncb;
+  pdat->ncb = 0;
+  for (i = 0; i < n; i++)
+    pdat->cb[i](pdat->cb_arg[i]);
+}
+
+void fb_f1c100s_present(framebuffer_t* fb, int index)
+{
+  fb_host_priv_data_t* pdat = (fb_host_priv_data_t*)fb->priv;
+  fb_state_t st;
+
+  if (pdat && (index == 0 || index == 1)) {
+    TRACE1(TRC_FRAME_FLIP, index);
+    pdat->index = index;
+    st.flags = FB_STATE_BASE;
+    st.base = pdat->vram[index];
+    fb_f1c100s_commit(fb, &st, NULL, NULL);
+  }
+}
+
+void fb_f1c100s_set_vram(framebuffer_t* fb, void* vram)
+{
+  fb_state_t st;
+
+  st.flags = FB_STATE_BASE;
+  st.base = vram;
+  fb_f1c100s_commit(fb, &st, NULL, NULL);
+}
+
+void fb_f1c100s_set_origin(framebuffer_t* fb, int32_t x, int32_t y)
+{
+  fb_state_t st;
+
+  st.flags = FB_STATE_ORIGIN;
+  st.xorg = x;
+  st.yorg = y;
+  fb_f1c100s_commit(fb, &st, NULL, NULL);
+}
+
+uint32_t fb_f1c100s_irq_ack(framebuffer_t* fb)
+{
+  fb_host_priv_data_t* pdat = (fb_host_priv_data_t*)fb->priv;
+  uint32_t flags = pdat->irq_flags;
+
+  pdat->irq_flags = 0;
+  return flags;
+}
+
+void fb_f1c100s_set_line_irq(framebuffer_t* fb, int32_t line)
+{
+  fb_host_priv_data_t* pdat = (fb_host_priv_data_t*)fb->priv;
+
+  pdat->irq_line = (line < 0 || line >= pdat->height) ? -1 : line;
+}
+
+int32_t fb_f1c100s_set_refresh_div(framebuffer_t* fb, int32_t div)
+{
+  fb_host_priv_data_t* pdat = (fb_host_priv_data_t*)fb->priv;
+
+  if (div < 1)
+    div = 1;
+  if (div > FB_REFRESH_DIV_MAX)
+    div = FB_REFRESH_DIV_MAX;
+  pdat->refresh_div = div;
+  return div;
+}
+
+void fb_f1c100s_get_scan(framebuffer_t* fb, fb_scan_t* scan)
+{
+  fb_host_priv_data_t* pdat = (fb_host_priv_data_t*)fb->priv;
+
+  scan->vtotal = pdat->vtotal;
+  scan->vstart = pdat->vstart;
+  scan->line_ns = (uint32_t)(pdat->line_ns * pdat->refresh_div);
+}
+
+void fb_f1c100s_set_csc(framebuffer_t* fb, ColorMatrixType const* cm)
+{
+  fb_state_t st;
+
+  st.flags = FB_STATE_CSC;
+  st.csc_en = cm ? 1 : 0;
+  if (cm)
+    st.csc = *cm;
+  else
+    CSC_Identity(&st.csc);
+  fb_f1c100s_commit(fb, &st, NULL, NULL);
+}
+
+// ûSPLҲûп
+void* fb_f1c100s_get_splash(void)
+{
+  return NULL;
+}
+
+void fb_f1c100s_end_splash(framebuffer_t* fb)
+{
+  (void)fb;
+}
+
+void fb_f1c100s_set_palette(framebuffer_t* fb, int32_t index, uint32_t argb)
+{
+  fb_host_priv_data_t* pdat = (fb_host_priv_data_t*)fb->priv;
+
+  if (pdat && index >= 0 && index < 256)
+    pdat->palette[index] = argb;
+}
+
+void* fb_f1c100s_get_overlay(void)
+{
+  return fb_f1c100s_get_panel() ? fb_host_priv_object.ovl : NULL;
+}
+
+void fb_f1c100s_overlay_show(framebuffer_t* fb, int32_t on)
+{
+  fb_state_t st;
+
+  st.flags = FB_STATE_OVL_SHOW;
+  st.ovl_on = on;
+  fb_f1c100s_commit(fb, &st, NULL, NULL);
+}
+
+void fb_f1c100s_overlay_move(framebuffer_t* fb, int32_t x, int32_t y)
+{
+  fb_state_t st;
+
+  st.flags = FB_STATE_OVL_POS;
+  st.ovl_x = x;
+  st.ovl_y = y;
+  fb_f1c100s_commit(fb, &st, NULL, NULL);
+}
+
+void fb_f1c100s_overlay_colorkey(framebuffer_t* fb, uint32_t min, uint32_t max)
+{
+  fb_state_t st;
+
+  fb_f1c100s_begin(fb, &st);
+  st.flags = FB_STATE_OVL_KEY;
+  st.key_min = min;
+  st.key_max = max;
+  fb_f1c100s_commit(fb, &st, NULL, NULL);
+}
+
+void fb_f1c100s_overlay_colorkey_enable(framebuffer_t* fb, int32_t on)
+{
+  fb_state_t st;
+
+  fb_f1c100s_begin(fb, &st);
+  st.flags = FB_STATE_OVL_KEY;
+  st.key_on = on;
+  fb_f1c100s_commit(fb, &st, NULL, NULL);
+}
+
+/*
+* ѡ岢仺壬ͬ<fb-f1c100s.c>ֱӴӶ䣬FB_MEM_SIZE
+* @return: 壬δ֪ʱNULL
+*/
+fb_panel_t const* fb_f1c100s_select_panel(char const* name)
+{
+  fb_host_priv_data_t* pdat = &fb_host_priv_object;
+  fb_panel_t const* p;
+  size_t size, ovl;
+  int i;
+
+  p = fb_panel_find(name ? name : FB_PANEL);
+  if (!p)
+    return NULL;
+  pdat->panel = p;
+  pdat->width = p->width;
+  pdat->height = p->height;
+  pdat->vwidth = p->width * FB_VIRT_XPAGES;
+  pdat->vheight = p->height * FB_VIRT_YPAGES;
+  pdat->hz = (int32_t)fb_panel_hz(p);
+  pdat->vstart = p->v_front_porch + p->v_sync_len + p->v_back_porch;
+  pdat->vtotal = p->height + pdat->vstart;
+  pdat->line_ns = (long)((p->width + p->h_front_porch + p->h_back_porch + p->h_sync_len) * 1000000000LL / p->pixel_clock_hz);
+
+  size = (size_t)pdat->vwidth * pdat->vheight * FB_HOST_BYTES;
+  ovl = FB_OVERLAY_EN ? (size_t)p->width * p->height * 4 : 0;
+  free(pdat->mem);
+  pdat->mem = (uint8_t*)calloc(1, size * FB_NUM_BUFFERS + ovl);
+  for (i = 0; i < 2; i++)
+    pdat->vram[i] = pdat->mem + size * ((i < FB_NUM_BUFFERS) ? i : 0);
+  pdat->ovl = ovl ? (uint32_t*)(pdat->mem + size * FB_NUM_BUFFERS) : NULL;
+  return p;
+}
+
+fb_panel_t const* fb_f1c100s_get_panel(void)
+{
+  if (!fb_host_priv_object.panel) {
+    if (!fb_f1c100s_select_panel(getenv("SIM_PANEL"))) {
+      fprintf(stderr, "fb-host: unknown SIM_PANEL, using %s\n", FB_PANEL);
+      fb_f1c100s_select_panel(NULL);
+    }
+  }
+  return fb_host_priv_object.panel;
+}
+
+void fb_f1c100s_get_vsize(int32_t* vwidth, int32_t* vheight)
+{
+  fb_f1c100s_get_panel();
+  *vwidth = fb_host_priv_object.vwidth;
+  *vheight = fb_host_priv_object.vheight;
+}
+
+void fb_f1c100s_init(framebuffer_t* fb)
+{
+  fb_host_priv_data_t* pdat = &fb_host_priv_object;
+
+  fb_f1c100s_get_panel();
+  pdat->index = 0;
+  pdat->brightness = 0;
+  pdat->base = pdat->vram[0];
+  pdat->xorg = 0;
+  pdat->yorg = 0;
+  pdat->scan = pdat->base;
+  pdat->ovl_x = 0;
+  pdat->ovl_y = 0;
+  pdat->ovl_on = 1;
+  pdat->ovl_key = 0;
+  pdat->key_min = 0;
+  pdat->key_max = 0;
+  CSC_Identity(&pdat->csc);
+  pdat->csc_en = 0;
+  pdat->next.flags = 0;
+  pdat->ncb = 0;
+  pdat->irq_flags = 0;
+  pdat->irq_line = -1;
+  pdat->refresh_div = 1;
+  fb_panel_check_budget(pdat->panel, FB_HOST_BYTES, pdat->ovl != NULL);
+
+  fb->name = "fb-host";
+  fb->width = pdat->width;
+  fb->height = pdat->height;
+  fb->pwidth = pdat->panel->pwidth;
+  fb->pheight = pdat->panel->pheight;
+  fb->bpp = FB_LAYER0_BPP;
+  fb->priv = pdat;
+
+  if (!_vblank_running) {
+    _vblank_running = true;
+    pthread_create(&_vblank_thread, NULL, __vblank_thread, pdat);
+  }
+}
+
+void* fb_f1c100s_get_vram1(void)
+{
+  return fb_f1c100s_get_panel() ? fb_host_priv_object.vram[0] : NULL;
+}
+
+void* fb_f1c100s_get_vram2(void)
+{
+  return fb_f1c100s_get_panel() ? fb_host_priv_object.vram[1] : NULL;
+}
+
+void fb_f1c100s_remove(framebuffer_t* fb)
+{
+  (void)fb;
+}
+
+void fb_f1c100s_suspend(framebuffer_t* fb)
+{
+  (void)fb;
+}
+
+void fb_f1c100s_resume(framebuffer_t* fb)
+{
+  (void)fb;
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,131 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __RTL_H__
+#define __RTL_H__
+////////////////////////////////////////////////////////////////////////////////
+// LinuxRTXӿڣ<RTX4/INC/RTL.h>ֻõںAPI
+// <host-sim/rtx_pthread.c>pthreadʵ֡ͺͷֵRTXһ£
+// ֻĳɰָȴ洢(64λU32ŲϢָ)
+////////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+#define __task
+
+typedef signed char     S8;
+typedef unsigned char   U8;
+typedef short           S16;
+typedef unsigned short  U16;
+typedef int             S32;
+typedef unsigned int    U32;
+typedef long long       S64;
+typedef unsigned long long U64;
+typedef unsigned char   BIT;
+typedef unsigned int    BOOL;
+
+#ifndef __TRUE
+#define __TRUE          1
+#endif
+#ifndef __FALSE
+#define __FALSE         0
+#endif
+
+typedef U32 OS_SEM[2];
+#define os_mbx_declare(name,cnt)    void* name [4 + (cnt)]
+typedef void* OS_MBX[];
+typedef U32 OS_MUT[4];
+typedef U32 OS_TID;
+typedef void* OS_ID;
+typedef U32 OS_RESULT;
+
+#define OS_R_TMO        0x01
+#define OS_R_EVT        0x02
+#define OS_R_SEM        0x03
+#define OS_R_MBX        0x04
+#define OS_R_MUT        0x05
+#define OS_R_OK         0x00
+#define OS_R_NOK        0xff
+
+#define OS_TCB_SIZE     48
+#define OS_TMR_SIZE     8
+
+#define OS_ERR_STK_OVF  1
+#define OS_ERR_FIFO_OVF 2
+#define OS_ERR_MBX_OVF  3
+
+/* Task Management */
+#define os_sys_init(tsk)              os_sys_init0(tsk,0,NULL)
+#define os_sys_init_prio(tsk,prio)    os_sys_init0(tsk,prio,NULL)
+#define os_sys_init_user(tsk,prio,stk,size)                                   \
+                                      os_sys_init0(tsk,(prio)|((size)<<8),stk)
+#define os_tsk_create(tsk,prio)       os_tsk_create0(tsk,prio,NULL,NULL)
+#define os_tsk_create_user(tsk,prio,stk,size)                                 \
+                                      os_tsk_create0(tsk,(prio)|((size)<<8),stk,NULL)
+#define os_tsk_delete_self()          { os_tsk_delete(0); for(;;); }
+#define os_tsk_prio_self(prio)        os_tsk_prio(0,prio)
+#define isr_tsk_get()                 os_tsk_self()
+
+extern void      os_sys_init0(void (*task)(void), U32 prio_stksz, void* stk);
+extern OS_TID    os_tsk_create0(void (*task)(void), U32 prio_stksz, void* stk, void* argv);
+extern OS_TID    os_tsk_self(void);
+extern void      os_tsk_pass(void);
+extern OS_RESULT os_tsk_prio(OS_TID task_id, U8 new_prio);
+extern OS_RESULT os_tsk_delete(OS_TID task_id);
+
+/* Event flag Management */
+#define os_evt_wait_or(wflags,tmo)      os_evt_wait(wflags,tmo,__FALSE)
+#define os_evt_wait_and(wflags,tmo)     os_evt_wait(wflags,tmo,__TRUE)
+
+extern OS_RESULT os_evt_wait(U16 wait_flags, U16 timeout, BOOL and_wait);
+extern void      os_evt_set(U16 event_flags, OS_TID task_id);
+extern void      os_evt_clr(U16 clear_flags, OS_TID task_id);
+extern void      isr_evt_set(U16 event_flags, OS_TID task_id);
+extern U16       os_evt_get(void);
+
+/* Semaphore Management */
+extern void      os_sem_init(OS_ID semaphore, U16 token_count);
+extern OS_RESULT os_sem_send(OS_ID semaphore);
+extern OS_RESULT os_sem_wait(OS_ID semaphore, U16 timeout);
+extern void      isr_sem_send(OS_ID semaphore);
+
+/* Mailbox Management */
+#define isr_mbx_check(mbx)              os_mbx_check(mbx)
+
+extern void      os_mbx_init(OS_ID mailbox, U16 mbx_size);
+extern OS_RESULT os_mbx_send(OS_ID mailbox, void* message_ptr, U16 timeout);
+extern OS_RESULT os_mbx_wait(OS_ID mailbox, void** message, U16 timeout);
+extern OS_RESULT os_mbx_check(OS_ID mailbox);
+extern void      isr_mbx_send(OS_ID mailbox, void* message_ptr);
+extern OS_RESULT isr_mbx_receive(OS_ID mailbox, void** message);
+
+/* Mutex Management */
+extern void      os_mut_init(OS_ID mutex);
+extern OS_RESULT os_mut_release(OS_ID mutex);
+extern OS_RESULT os_mut_wait(OS_ID mutex, U16 timeout);
+
+/* Time Management */
+extern U32       os_time_get(void);
+extern void      os_dly_wait(U16 delay_time);
+extern void      os_itv_set(U16 interval_time);
+extern void      os_itv_wait(void);
+
+/* User Timer Management */
+extern OS_ID     os_tmr_create(U16 tcnt, U16 info);
+extern OS_ID     os_tmr_kill(OS_ID timer);
+
+/* System Functions */
+extern void      tsk_lock(void);
+extern void      tsk_unlock(void);
+
+/* <RTX_Conf_xxx.c>ṩĻص */
+extern void      os_tmr_call(U16 info);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __RTL_H__ */
@@ -0,0 +1,70 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __IO_H__
+#define __IO_H__
+////////////////////////////////////////////////////////////////////////////////
+// LinuxļĴʣ<boot-spl/include/io.h>
+// ĴһٵļĴļ(дʲôʲô)
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* <host-sim/target_Host.c>ļ */
+volatile uint32_t* host_reg(uint32_t addr);
+
+static inline uint8_t read8(uint32_t addr)
+{
+  return (uint8_t)(*host_reg(addr) >> ((addr & 3) * 8));
+}
+
+static inline uint16_t read16(uint32_t addr)
+{
+  return (uint16_t)(*host_reg(addr) >> ((addr & 2) * 8));
+}
+
+static inline uint32_t read32(uint32_t addr)
+{
+  return *host_reg(addr);
+}
+
+static inline uint64_t read64(uint32_t addr)
+{
+  return *host_reg(addr) | ((uint64_t)*host_reg(addr + 4) << 32);
+}
+
+static inline void write8(uint32_t addr, uint8_t value)
+{
+  volatile uint32_t* r = host_reg(addr);
+  uint32_t sh = (addr & 3) * 8;
+
+  *r = (*r & ~(0xffU << sh)) | ((uint32_t)value << sh);
+}
+
+static inline void write16(uint32_t addr, uint16_t value)
+{
+  volatile uint32_t* r = host_reg(addr);
+  uint32_t sh = (addr & 2) * 8;
+
+  *r = (*r & ~(0xffffU << sh)) | ((uint32_t)value << sh);
+}
+
+static inline void write32(uint32_t addr, uint32_t value)
+{
+  *host_reg(addr) = value;
+}
+
+static inline void write64(uint32_t addr, uint64_t value)
+{
+  *host_reg(addr) = (uint32_t)value;
+  *host_reg(addr + 4) = (uint32_t)(value >> 32);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __IO_H__ */
@@ -0,0 +1,81 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __TARGET_HOST_H__
+#define __TARGET_HOST_H__
+////////////////////////////////////////////////////////////////////////////////
+// Linuxtarget壬<target.h>ڶ__HOST_SIMʱ
+// ڴȫʧЧ(ֻ)ٽһȫֵݹжϣ
+// ģж(tickvblank)ڳִС
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include "ftypes.h"
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+#define MEM_PI_SRAM
+#define MEM_PI_SUMMARY
+#define MEM_PI_NOINIT
+#define MEM_PI_CPUONLY
+#define MEM_PI_HARDWARE __attribute__((aligned(32)))
+#define MEM_PI_NCNB     __attribute__((aligned(32)))
+#define MEM_PI_STACK    __attribute__((aligned(8)))
+
+#define CACHE_ALIGNED   __attribute__((aligned(32)))
+
+#ifndef INLINE
+#define INLINE        __attribute__((always_inline))
+#endif
+
+#ifndef NOINLINE
+#define NOINLINE      __attribute__((noinline))
+#endif
+
+#ifndef NOINLINE_FUNC
+#define NOINLINE_FUNC __attribute__((noinline))
+#endif
+
+#ifndef ALIGN
+#define ALIGN(n)      __attribute__((aligned(n)))
+#endif
+
+#ifndef __weak
+#define __weak        __attribute__((weak))
+#endif
+
+/* <host-sim/target_Host.c>ļ */
+ubase_t host_enter_critical(void);
+void    host_exit_critical(ubase_t sr);
+void    host_raise_irq(uint8_t nIRQ);
+
+#define CPU_SR_DECL           ubase_t cpu_sr
+#define CPU_ENTER_CRITICAL()  do{cpu_sr = host_enter_critical();}while(0)
+#define CPU_EXIT_CRITICAL()   do{host_exit_critical(cpu_sr);}while(0)
+
+static inline unsigned CPU_CLZ16(uint16_t val)
+{
+  return val ? (unsigned)(__builtin_clz(val) - 16) : 16;
+}
+
+static inline uint8_t __swap_byte(uint8_t newval, uint8_t volatile* pmem)
+{
+  return __atomic_exchange_n(pmem, newval, __ATOMIC_SEQ_CST);
+}
+
+static inline uint32_t UTL_REV32(uint32_t val)
+{
+  return __builtin_bswap32(val);
+}
+
+static inline uint16_t UTL_REV16(uint16_t val)
+{
+  return __builtin_bswap16(val);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __TARGET_HOST_H__ */
@@ -0,0 +1,141 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// СPNGд룺8λRGBzlibֻstored(ѹ)libpng/zlib
+////////////////////////////////////////////////////////////////////////////////
+
+static uint32_t _crc_table[256];
+
+static void __crc_init(void)
+{
+  uint32_t c, n, k;
+
+  if (_crc_table[1])
+    return;
+  for (n = 0; n < 256; n++) {
+    c = n;
+    for (k = 0; k < 8; k++)
+      c = (c & 1) ? 0xEDB88320UL ^ (c >> 1) : (c >> 1);
+    _crc_table[n] = c;
+  }
+}
+
+static uint32_t __crc_update(uint32_t crc, uint8_t const* p, size_t n)
+{
+  while (n--)
+    crc = _crc_table[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+  return crc;
+}
+
+static void __put32(uint8_t* p, uint32_t v)
+{
+  p[0] = (uint8_t)(v >> 24);
+  p[1] = (uint8_t)(v >> 16);
+  p[2] = (uint8_t)(v >> 8);
+  p[3] = (uint8_t)v;
+}
+
+/* ֶдһchunkдͷݱдCRC */
+typedef struct {
+  FILE* fp;
+  uint32_t crc;
+} ChunkType;
+
+static void __chunk_begin(ChunkType* ck, FILE* fp, char const* type, uint32_t len)
+{
+  uint8_t hdr[8];
+
+  __put32(hdr, len);
+  memcpy(hdr + 4, type, 4);
+  fwrite(hdr, 1, 8, fp);
+  ck->fp = fp;
+  ck->crc = __crc_update(0xFFFFFFFFUL, hdr + 4, 4);
+}
+
+static void __chunk_data(ChunkType* ck, void const* data, size_t len)
+{
+  fwrite(data, 1, len, ck->fp);
+  ck->crc = __crc_update(ck->crc, (uint8_t const*)data, len);
+}
+
+static void __chunk_end(ChunkType* ck)
+{
+  uint8_t crc[4];
+
+  __put32(crc, ck->crc ^ 0xFFFFFFFFUL);
+  fwrite(crc, 1, 4, ck->fp);
+}
+
+/*
+* XRGB8888ͼ񱣴ΪPNG
+* @path: ļ
+* @pixels/@width/@height: ͼм
+* @return: ɹ0
+*/
+int png_write_xrgb(char const* path, uint32_t const* pixels, int width, int height)
+{
+  static uint8_t const sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+  uint8_t ihdr[13], blk[5], row[1 + 3 * 4096], tmp[4];
+  uint32_t row_len = 1 + 3 * (uint32_t)width;
+  uint32_t a = 1, b = 0, i, len;
+  ChunkType ck;
+  FILE* fp;
+  int x, y;
+
+  if (width <= 0 || width > 4096 || height <= 0)
+    return -1;
+  fp = fopen(path, "wb");
+  if (fp == NULL)
+    return -1;
+  __crc_init();
+  fwrite(sig, 1, 8, fp);
+
+  __put32(ihdr, (uint32_t)width);
+  __put32(ihdr + 4, (uint32_t)height);
+  ihdr[8] = 8;    // bit depth
+  ihdr[9] = 2;    // RGB
+  ihdr[10] = ihdr[11] = ihdr[12] = 0;
+  __chunk_begin(&ck, fp, "IHDR", 13);
+  __chunk_data(&ck, ihdr, 13);
+  __chunk_end(&ck);
+
+  // ÿһstored(г65535)zlibͷ2ֽ + ͷ5ֽ/ + adler32
+  len = 2 + (uint32_t)height * (5 + row_len) + 4;
+  __chunk_begin(&ck, fp, "IDAT", len);
+  tmp[0] = 0x78;
+  tmp[1] = 0x01;
+  __chunk_data(&ck, tmp, 2);
+  for (y = 0; y < height; y++) {
+    row[0] = 0;   // filter: none
+    for (x = 0; x < width; x++) {
+      uint32_t c = pixels[(size_t)y * width + x];
+      row[1 + 3 * x] = (uint8_t)(c >> 16);
+      row[2 + 3 * x] = (uint8_t)(c >> 8);
+      row[3 + 3 * x] = (uint8_t)c;
+    }
+    blk[0] = (y == height - 1) ? 1 : 0;
+    blk[1] = (uint8_t)row_len;
+    blk[2] = (uint8_t)(row_len >> 8);
+    blk[3] = (uint8_t)~row_len;
+    blk[4] = (uint8_t)(~row_len >> 8);
+    __chunk_data(&ck, blk, 5);
+    __chunk_data(&ck, row, row_len);
+    for (i = 0; i < row_len; i++) {
+      a = (a + row[i]) % 65521;
+      b = (b + a) % 65521;
+    }
+  }
+  __put32(tmp, (b << 16) | a);
+  __chunk_data(&ck, tmp, 4);
+  __chunk_end(&ck);
+
+  __chunk_begin(&ck, fp, "IEND", 0);
+  __chunk_end(&ck);
+  return fclose(fp) == 0 ? 0 : -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
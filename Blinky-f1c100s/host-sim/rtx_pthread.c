@@ -0,0 +1,552 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+#include "efxinc.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// pthreadʵֵRTXںAPI(ֻ<host-sim/include/RTL.h>Ĳ)
+// ÿRTXӦһpthreadеȴͬһϣtick߳
+// ÿ1ms㲥һΣִ֮УģRTXȼռ
+// ȼĴڷҪٽ
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OS_TASKCNT
+#define OS_TASKCNT      40
+#endif
+
+#ifndef OS_TIMERCNT
+#define OS_TIMERCNT     UFX_TIMERCNT
+#endif
+
+#define OS_TICK_NS      (1000000L)
+#define OS_WAIT_FOREVER (0xFFFF)
+
+typedef struct {
+  void (*task)(void);
+  pthread_t thread;
+  bool_t used;
+  U8 prio;
+  U16 evt_flags;
+  U16 itv;
+  U32 itv_next;
+} HostTcbType;
+
+typedef struct {
+  U32 tcnt;
+  U16 info;
+  bool_t used;
+} HostTmrType;
+
+// ͷռos_mbx_declare()Ԥ4ָ
+#define MBX_SIZE(m)     (((uintptr_t*)(m))[0])
+#define MBX_FIRST(m)    (((uintptr_t*)(m))[1])
+#define MBX_COUNT(m)    (((uintptr_t*)(m))[2])
+#define MBX_MSG(m, i)   (((void**)(m))[4 + (i)])
+
+volatile U32 os_time = 0;
+
+static HostTcbType _tcb[OS_TASKCNT + 1];
+static HostTmrType _tmr[OS_TIMERCNT > 0 ? OS_TIMERCNT : 1];
+static pthread_mutex_t _k_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t _k_cond = PTHREAD_COND_INITIALIZER;
+static __thread OS_TID _self = 0;
+
+/* ȴֱcond()ʱʱ_k_lock */
+static bool_t __k_wait(bool_t (*cond)(void*), void* arg, U16 timeout)
+{
+  U32 start = os_time;
+
+  for (;;) {
+    if (cond(arg))
+      return true;
+    if (timeout == 0)
+      return false;
+    if (timeout != OS_WAIT_FOREVER && (U32)(os_time - start) >= timeout)
+      return false;
+    pthread_cond_wait(&_k_cond, &_k_lock);
+  }
+}
+
+static void* __task_entry(void* arg)
+{
+  HostTcbType* tcb = (HostTcbType*)arg;
+
+  _self = (OS_TID)(tcb - _tcb);
+  tcb->task();
+  os_tsk_delete(0);
+  return NULL;
+}
+
+/*
+* ϵͳ̣߳൱RTXSysTickж
+* @return: none
+*/
+static void* __tick_thread(void* arg)
+{
+  extern void $Sub$$os_tmr_tick(void);
+  struct timespec next;
+  CPU_SR_DECL;
+
+  (void)arg;
+  clock_gettime(CLOCK_MONOTONIC, &next);
+  for (;;) {
+    next.tv_nsec += OS_TICK_NS;
+    if (next.tv_nsec >= 1000000000L) {
+      next.tv_nsec -= 1000000000L;
+      next.tv_sec++;
+    }
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR);
+
+    CPU_ENTER_CRITICAL();
+    pthread_mutex_lock(&_k_lock);
+    os_time++;
+    pthread_mutex_unlock(&_k_lock);
+    // Ŀһ$Sub$$os_tmr_tick()ҹTICK_Exec()Ҳִ
+    $Sub$$os_tmr_tick();
+    CPU_EXIT_CRITICAL();
+
+    pthread_mutex_lock(&_k_lock);
+    pthread_cond_broadcast(&_k_cond);
+    pthread_mutex_unlock(&_k_lock);
+  }
+  return NULL;
+}
+
+/*
+* ûʱʱ$Sub$$os_tmr_tick()
+* @return: none
+*/
+void $Super$$os_tmr_tick(void)
+{
+  U16 expired[OS_TIMERCNT > 0 ? OS_TIMERCNT : 1];
+  U32 i, n = 0;
+
+  pthread_mutex_lock(&_k_lock);
+  for (i = 0; i < OS_TIMERCNT; i++) {
+    if (_tmr[i].used && --_tmr[i].tcnt == 0) {
+      _tmr[i].used = false;
+      expired[n++] = _tmr[i].info;
+    }
+  }
+  pthread_mutex_unlock(&_k_lock);
+  // os_tmr_call()ٵisr_xxx()ܳں
+  for (i = 0; i < n; i++) {
+    os_tmr_call(expired[i]);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Task Management
+
+void os_sys_init0(void (*task)(void), U32 prio_stksz, void* stk)
+{
+  pthread_t tid;
+
+  pthread_create(&tid, NULL, __tick_thread, NULL);
+  os_tsk_create0(task, prio_stksz, stk, NULL);
+  // RTXһٷأmain߳̾ʹ
+  for (;;) {
+    pause();
+  }
+}
+
+OS_TID os_tsk_create0(void (*task)(void), U32 prio_stksz, void* stk, void* argv)
+{
+  OS_TID id;
+
+  (void)stk;
+  (void)argv;
+  pthread_mutex_lock(&_k_lock);
+  for (id = 1; id <= OS_TASKCNT; id++) {
+    if (!_tcb[id].used)
+      break;
+  }
+  if (id > OS_TASKCNT) {
+    pthread_mutex_unlock(&_k_lock);
+    return 0;
+  }
+  memset(&_tcb[id], 0, sizeof(_tcb[id]));
+  _tcb[id].used = true;
+  _tcb[id].task = task;
+  _tcb[id].prio = (U8)prio_stksz;
+  if (pthread_create(&_tcb[id].thread, NULL, __task_entry, &_tcb[id]) != 0) {
+    _tcb[id].used = false;
+    id = 0;
+  } else {
+    pthread_detach(_tcb[id].thread);
+  }
+  pthread_mutex_unlock(&_k_lock);
+  return id;
+}
+
+OS_TID os_tsk_self(void)
+{
+  return _self;
+}
+
+void os_tsk_pass(void)
+{
+  sched_yield();
+}
+
+OS_RESULT os_tsk_prio(OS_TID task_id, U8 new_prio)
+{
+  if (task_id == 0)
+    task_id = _self;
+  if (task_id == 0 || task_id > OS_TASKCNT || !_tcb[task_id].used)
+    return OS_R_NOK;
+  _tcb[task_id].prio = new_prio;
+  return OS_R_OK;
+}
+
+OS_RESULT os_tsk_delete(OS_TID task_id)
+{
+  if (task_id == 0 || task_id == _self) {
+    pthread_mutex_lock(&_k_lock);
+    _tcb[_self].used = false;
+    pthread_mutex_unlock(&_k_lock);
+    pthread_exit(NULL);
+  }
+  // ϲǿֹ߳
+  return OS_R_NOK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Event flag Management
+
+typedef struct {
+  U16 flags;
+  BOOL and_wait;
+} EvtWaitType;
+
+static bool_t __evt_ready(void* arg)
+{
+  EvtWaitType* w = (EvtWaitType*)arg;
+  U16 got = _tcb[_self].evt_flags & w->flags;
+
+  return w->and_wait ? (got == w->flags) : (got != 0);
+}
+
+OS_RESULT os_evt_wait(U16 wait_flags, U16 timeout, BOOL and_wait)
+{
+  EvtWaitType w = { wait_flags, and_wait };
+  OS_RESULT res = OS_R_TMO;
+
+  pthread_mutex_lock(&_k_lock);
+  if (__k_wait(__evt_ready, &w, timeout)) {
+    // RTXһʱȵı־
+    _tcb[_self].evt_flags &= ~wait_flags;
+    res = OS_R_EVT;
+  }
+  pthread_mutex_unlock(&_k_lock);
+  return res;
+}
+
+void os_evt_set(U16 event_flags, OS_TID task_id)
+{
+  if (task_id == 0 || task_id > OS_TASKCNT)
+    return;
+  pthread_mutex_lock(&_k_lock);
+  _tcb[task_id].evt_flags |= event_flags;
+  pthread_cond_broadcast(&_k_cond);
+  pthread_mutex_unlock(&_k_lock);
+}
+
+void os_evt_clr(U16 clear_flags, OS_TID task_id)
+{
+  if (task_id == 0 || task_id > OS_TASKCNT)
+    return;
+  pthread_mutex_lock(&_k_lock);
+  _tcb[task_id].evt_flags &= ~clear_flags;
+  pthread_mutex_unlock(&_k_lock);
+}
+
+void isr_evt_set(U16 event_flags, OS_TID task_id)
+{
+  os_evt_set(event_flags, task_id);
+}
+
+U16 os_evt_get(void)
+{
+  return _tcb[_self].evt_flags;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Semaphore Management
+
+static bool_t __sem_ready(void* arg)
+{
+  return ((U32*)arg)[0] != 0;
+}
+
+void os_sem_init(OS_ID semaphore, U16 token_count)
+{
+  ((U32*)semaphore)[0] = token_count;
+  ((U32*)semaphore)[1] = 0;
+}
+
+OS_RESULT os_sem_send(OS_ID semaphore)
+{
+  pthread_mutex_lock(&_k_lock);
+  ((U32*)semaphore)[0]++;
+  pthread_cond_broadcast(&_k_cond);
+  pthread_mutex_unlock(&_k_lock);
+  return OS_R_OK;
+}
+
+OS_RESULT os_sem_wait(OS_ID semaphore, U16 timeout)
+{
+  OS_RESULT res = OS_R_TMO;
+
+  pthread_mutex_lock(&_k_lock);
+  if (__k_wait(__sem_ready, semaphore, timeout)) {
+    ((U32*)semaphore)[0]--;
+    res = OS_R_OK;
+  }
+  pthread_mutex_unlock(&_k_lock);
+  return res;
+}
+
+void isr_sem_send(OS_ID semaphore)
+{
+  os_sem_send(semaphore);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Mailbox Management
+
+static bool_t __mbx_has_msg(void* arg)
+{
+  return MBX_COUNT(arg) != 0;
+}
+
+static bool_t __mbx_has_room(void* arg)
+{
+  return MBX_COUNT(arg) < MBX_SIZE(arg);
+}
+
+void os_mbx_init(OS_ID mailbox, U16 mbx_size)
+{
+  MBX_SIZE(mailbox) = mbx_size / sizeof(void*) - 4;
+  MBX_FIRST(mailbox) = 0;
+  MBX_COUNT(mailbox) = 0;
+}
+
+static void __mbx_put(OS_ID mailbox, void* message_ptr)
+{
+  MBX_MSG(mailbox, (MBX_FIRST(mailbox) + MBX_COUNT(mailbox)) % MBX_SIZE(mailbox)) = message_ptr;
+  MBX_COUNT(mailbox)++;
+  pthread_cond_broadcast(&_k_cond);
+}
+
+static void* __mbx_get(OS_ID mailbox)
+{
+  void* msg = MBX_MSG(mailbox, MBX_FIRST(mailbox));
+
+  MBX_FIRST(mailbox) = (MBX_FIRST(mailbox) + 1) % MBX_SIZE(mailbox);
+  MBX_COUNT(mailbox)--;
+  pthread_cond_broadcast(&_k_cond);
+  return msg;
+}
+
+OS_RESULT os_mbx_send(OS_ID mailbox, void* message_ptr, U16 timeout)
+{
+  OS_RESULT res = OS_R_TMO;
+
+  pthread_mutex_lock(&_k_lock);
+  if (__k_wait(__mbx_has_room, mailbox, timeout)) {
+    __mbx_put(mailbox, message_ptr);
+    res = OS_R_OK;
+  }
+  pthread_mutex_unlock(&_k_lock);
+  return res;
+}
+
+OS_RESULT os_mbx_wait(OS_ID mailbox, void** message, U16 timeout)
+{
+  OS_RESULT res = OS_R_TMO;
+
+  pthread_mutex_lock(&_k_lock);
+  if (__k_wait(__mbx_has_msg, mailbox, timeout)) {
+    *message = __mbx_get(mailbox);
+    res = OS_R_MBX;
+  }
+  pthread_mutex_unlock(&_k_lock);
+  return res;
+}
+
+OS_RESULT os_mbx_check(OS_ID mailbox)
+{
+  OS_RESULT nfree;
+
+  pthread_mutex_lock(&_k_lock);
+  nfree = (OS_RESULT)(MBX_SIZE(mailbox) - MBX_COUNT(mailbox));
+  pthread_mutex_unlock(&_k_lock);
+  return nfree;
+}
+
+void isr_mbx_send(OS_ID mailbox, void* message_ptr)
+{
+  pthread_mutex_lock(&_k_lock);
+  if (MBX_COUNT(mailbox) < MBX_SIZE(mailbox)) {
+    __mbx_put(mailbox, message_ptr);
+    pthread_mutex_unlock(&_k_lock);
+    return;
+  }
+  pthread_mutex_unlock(&_k_lock);
+  os_error(OS_ERR_MBX_OVF);
+}
+
+OS_RESULT isr_mbx_receive(OS_ID mailbox, void** message)
+{
+  OS_RESULT res = OS_R_OK;
+
+  pthread_mutex_lock(&_k_lock);
+  if (MBX_COUNT(mailbox) != 0) {
+    *message = __mbx_get(mailbox);
+    res = OS_R_MBX;
+  }
+  pthread_mutex_unlock(&_k_lock);
+  return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Mutex Management
+
+static bool_t __mut_ready(void* arg)
+{
+  U32* m = (U32*)arg;
+
+  return m[0] == 0 || m[0] == _self;
+}
+
+void os_mut_init(OS_ID mutex)
+{
+  memset(mutex, 0, sizeof(OS_MUT));
+}
+
+OS_RESULT os_mut_release(OS_ID mutex)
+{
+  U32* m = (U32*)mutex;
+  OS_RESULT res = OS_R_NOK;
+
+  pthread_mutex_lock(&_k_lock);
+  if (m[0] == _self && m[1] > 0) {
+    if (--m[1] == 0) {
+      m[0] = 0;
+      pthread_cond_broadcast(&_k_cond);
+    }
+    res = OS_R_OK;
+  }
+  pthread_mutex_unlock(&_k_lock);
+  return res;
+}
+
+OS_RESULT os_mut_wait(OS_ID mutex, U16 timeout)
+{
+  U32* m = (U32*)mutex;
+  OS_RESULT res = OS_R_TMO;
+
+  pthread_mutex_lock(&_k_lock);
+  if (__k_wait(__mut_ready, mutex, timeout)) {
+    m[0] = _self;
+    m[1]++;
+    res = OS_R_OK;
+  }
+  pthread_mutex_unlock(&_k_lock);
+  return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Time Management
+
+U32 os_time_get(void)
+{
+  return os_time;
+}
+
+void os_dly_wait(U16 delay_time)
+{
+  U32 start;
+
+  // RTX0xFFFFҲֻһܳʱõȴ
+  pthread_mutex_lock(&_k_lock);
+  start = os_time;
+  while ((U32)(os_time - start) < delay_time) {
+    pthread_cond_wait(&_k_cond, &_k_lock);
+  }
+  pthread_mutex_unlock(&_k_lock);
+}
+
+void os_itv_set(U16 interval_time)
+{
+  _tcb[_self].itv = interval_time;
+  _tcb[_self].itv_next = os_time + interval_time;
+}
+
+void os_itv_wait(void)
+{
+  HostTcbType* tcb = &_tcb[_self];
+  U32 left;
+
+  left = tcb->itv_next - os_time;
+  if ((S32)left > 0)
+    os_dly_wait((U16)left);
+  tcb->itv_next += tcb->itv;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// User Timer Management
+
+OS_ID os_tmr_create(U16 tcnt, U16 info)
+{
+  OS_ID id = NULL;
+  U32 i;
+
+  if (tcnt == 0)
+    tcnt = 1;
+  pthread_mutex_lock(&_k_lock);
+  for (i = 0; i < OS_TIMERCNT; i++) {
+    if (!_tmr[i].used) {
+      _tmr[i].used = true;
+      _tmr[i].tcnt = tcnt;
+      _tmr[i].info = info;
+      id = &_tmr[i];
+      break;
+    }
+  }
+  pthread_mutex_unlock(&_k_lock);
+  return id;
+}
+
+OS_ID os_tmr_kill(OS_ID timer)
+{
+  HostTmrType* tmr = (HostTmrType*)timer;
+  OS_ID res = timer;
+
+  pthread_mutex_lock(&_k_lock);
+  if (tmr && tmr->used) {
+    tmr->used = false;
+    res = NULL;
+  }
+  pthread_mutex_unlock(&_k_lock);
+  return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// System Functions
+
+void tsk_lock(void)
+{
+  host_enter_critical();
+}
+
+void tsk_unlock(void)
+{
+  host_exit_critical(0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
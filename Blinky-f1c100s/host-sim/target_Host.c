@@ -0,0 +1,291 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "target.h"
+#include "f1c100s-irq.h"
+#include "ftrace.h"
+#include "io.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Linuxİ弶֧֣ٽټĴļжϿUART0HRT
+// ŹMMU/cacheάӦĿϵtarget_F1C100s.c
+// f1c100s-intc.cf1c100s-uart.cubox_a.smmu_a.s
+////////////////////////////////////////////////////////////////////////////////
+
+// Ĵռ[0x01c00000-0x01ffffff]ַ䵽_reg_dummy
+#define REG_BASE        (0x01c00000UL)
+#define REG_SIZE        (0x00400000UL)
+
+static volatile uint32_t _regs[REG_SIZE / 4];
+static volatile uint32_t _reg_dummy;
+
+static pthread_mutex_t _cpu_lock;
+static pthread_once_t _cpu_once = PTHREAD_ONCE_INIT;
+
+static IRQHandleTypeDef _irq_table[64];
+static volatile uint64_t _irq_enable = 0;
+
+static void __cpu_lock_init(void)
+{
+  pthread_mutexattr_t attr;
+
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&_cpu_lock, &attr);
+  pthread_mutexattr_destroy(&attr);
+}
+
+/*
+* ٽ(൱ڹж)Ƕ
+* @return: CPU_EXIT_CRITICAL()
+*/
+ubase_t host_enter_critical(void)
+{
+  pthread_once(&_cpu_once, __cpu_lock_init);
+  pthread_mutex_lock(&_cpu_lock);
+  return 0;
+}
+
+/*
+* ˳ٽ
+* @return: none
+*/
+void host_exit_critical(ubase_t sr)
+{
+  (void)sr;
+  pthread_mutex_unlock(&_cpu_lock);
+}
+
+/*
+* ȡüĴַӦļټĴԪ
+* @addr: ַ
+* @return: ĴԪ
+*/
+volatile uint32_t* host_reg(uint32_t addr)
+{
+  if (addr - REG_BASE < REG_SIZE)
+    return &_regs[(addr - REG_BASE) / 4];
+  return &_reg_dummy;
+}
+
+/*
+* ģһжϣٽִʹܵISRĿIRQжִһ
+* @nIRQ: жϺ
+* @return: none
+*/
+void host_raise_irq(uint8_t nIRQ)
+{
+  CPU_SR_DECL;
+
+  if (nIRQ >= COUNTOF(_irq_table))
+    return;
+  CPU_ENTER_CRITICAL();
+  if (_irq_enable & (1ULL << nIRQ)) {
+    f1c100s_intc_dispatch(nIRQ);
+  }
+  CPU_EXIT_CRITICAL();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// <f1c100s-intc.c>
+
+uint8_t f1c100s_intc_get_nirq(void)
+{
+  return 0;
+}
+
+void f1c100s_intc_dispatch(uint8_t nIRQ)
+{
+  IRQHandleTypeDef handle = _irq_table[nIRQ];
+  if (handle) {
+    TRACE1(TRC_IRQ_ENTER, nIRQ);
+    handle();
+    TRACE1(TRC_IRQ_EXIT, nIRQ);
+  }
+}
+
+void f1c100s_intc_set_isr(uint8_t nIRQ, void (*handle)(void))
+{
+  if (nIRQ < COUNTOF(_irq_table)) {
+    _irq_table[nIRQ] = handle;
+  }
+}
+
+void f1c100s_intc_enable_irq(uint8_t nIRQ)
+{
+  CPU_SR_DECL;
+
+  CPU_ENTER_CRITICAL();
+  _irq_enable |= (1ULL << nIRQ);
+  CPU_EXIT_CRITICAL();
+}
+
+void f1c100s_intc_disable_irq(uint8_t nIRQ)
+{
+  CPU_SR_DECL;
+
+  CPU_ENTER_CRITICAL();
+  _irq_enable &= ~(1ULL << nIRQ);
+  CPU_EXIT_CRITICAL();
+}
+
+void f1c100s_intc_unmask_irq(uint8_t nIRQ)
+{
+  f1c100s_intc_enable_irq(nIRQ);
+}
+
+void f1c100s_intc_mask_irq(uint8_t nIRQ)
+{
+  f1c100s_intc_disable_irq(nIRQ);
+}
+
+void f1c100s_intc_force_irq(uint8_t nIRQ)
+{
+  host_raise_irq(nIRQ);
+}
+
+void f1c100s_intc_clear_pend(uint8_t nIRQ)
+{
+  (void)nIRQ;
+}
+
+void f1c100s_intc_init(void)
+{
+  CPU_SR_DECL;
+
+  CPU_ENTER_CRITICAL();
+  _irq_enable = 0;
+  memset(_irq_table, 0, sizeof(_irq_table));
+  CPU_EXIT_CRITICAL();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// <f1c100s-uart.c>UART0ֱӳ䵽stdoutûн
+
+void f1c100s_uart_init(void)
+{
+}
+
+void f1c100s_uart_exit(void)
+{
+  fflush(stdout);
+}
+
+uint32_t f1c100s_uart_write(void const* buf, uint32_t num, uint32_t flags)
+{
+  (void)flags;
+  return (uint32_t)fwrite(buf, 1, num, stdout);
+}
+
+int f1c100s_uart_getc(void)
+{
+  return -1;
+}
+
+void f1c100s_uart_flush(void)
+{
+  fflush(stdout);
+}
+
+uint32_t f1c100s_uart_txfree(void)
+{
+  return 4096;
+}
+
+uint32_t f1c100s_uart_dropped(void)
+{
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// <ubox_a.s>
+
+void util_halt(void)
+{
+  for (;;) {
+    pause();
+  }
+}
+
+void util_fastloop(ubase_t n)
+{
+  while (n--) {
+    __asm__ volatile("" ::: "memory");
+  }
+}
+
+ubase_t util_getCPSR(void)
+{
+  return 0x13;
+}
+
+ubase_t util_enter_critical(void)
+{
+  return host_enter_critical();
+}
+
+void util_exit_critical(ubase_t sr)
+{
+  host_exit_critical(sr);
+}
+
+void util_enable_interrupt(void)
+{
+}
+
+void util_disable_interrupt(void)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// <target_F1C100s.c>
+
+void target_reset(void)
+{
+  fflush(stdout);
+  exit(0);
+}
+
+void target_wdt_setup(void)
+{
+}
+
+void target_wdt_feed(void)
+{
+}
+
+void target_hrt_setup(void)
+{
+}
+
+u32_t target_hrt_read(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (u32_t)((uint64_t)ts.tv_sec * TARGET_HRT_FREQ +
+                 (uint64_t)ts.tv_nsec * (TARGET_HRT_FREQ / 1000000UL) / 1000UL);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// <mmu_a.s>/<mmu_c.c>cacheһµģάȫΪ
+
+void MMU_InvalidateIDCache(void) {}
+void MMU_InvalidateICache(void) {}
+void MMU_InvalidateICacheMVA(unsigned long mva) { (void)mva; }
+void MMU_InvalidateDCache(void) {}
+void MMU_InvalidateDCacheMVA(unsigned long mva) { (void)mva; }
+void MMU_CleanDCacheMVA(unsigned long mva) { (void)mva; }
+void MMU_TestCleanDCache(void) {}
+void MMU_DrainWriteBuffer(void) {}
+void MMU_CleanAndInvalidateDCacheMVA(unsigned long mva) { (void)mva; }
+void MMU_TestCleanAndInvalidateDCache(void) {}
+void MMU_CleanDCacheArray(unsigned long mva, unsigned long num) { (void)mva; (void)num; }
+void MMU_InvalidateDCacheArray(unsigned long mva, unsigned long num) { (void)mva; (void)num; }
+
+////////////////////////////////////////////////////////////////////////////////
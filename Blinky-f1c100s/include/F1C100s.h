@@ -33,6 +33,21 @@ void      f1c100s_intc_force_irq(uint8_t nIRQ);
 void      f1c100s_intc_clear_pend(uint8_t nIRQ);
 void      f1c100s_intc_init(void);
 
+
+/* types declared by <f1c100s-uart.c> */
+
+#define UART_TX_DROP    (0)   // ͻʱʣݣ
+#define UART_TX_BLOCK   (1)   // ͻʱȴ(˯)ֱȫд
+#define UART_TX_RAW     (2)   // '\n'"\r\n"ת
+
+void      f1c100s_uart_init(void);
+void      f1c100s_uart_exit(void);
+uint32_t  f1c100s_uart_write(void const* buf, uint32_t num, uint32_t flags);
+int       f1c100s_uart_getc(void);
+void      f1c100s_uart_flush(void);
+uint32_t  f1c100s_uart_txfree(void);
+uint32_t  f1c100s_uart_dropped(void);
+
 #ifdef __cplusplus
 }
 #endif
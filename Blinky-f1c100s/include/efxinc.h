@@ -12,6 +12,8 @@
 #include "RTL.h"
 #endif
 #include "tickproc.h"
+#include "taskmon.h"
+#include "ftrace.h"
 
 #ifdef __cplusplus
 extern "C"  {
@@ -54,9 +56,17 @@ static inline void sys_suspend(void)
   os_dly_wait(TWAIT_FOREVER);
 }
 
-/* <RTX_Conf_xxx.c>ļ */
+// ̶߳ʱܴ<RTX_Conf_xxx.c>еOS_TIMERCNT(Ϊ0ʱ)
+#ifndef UFX_TIMERCNT
+#define UFX_TIMERCNT        (80)
+#endif
+
+/* <ufx_timer.c>ļ */
 void   UFX_SetupTaskTimer(void);
 bool_t UFX_AddTaskTimer(U16 dly, void (*pfn)(void*), void* parg);
+void   UFX_PostTaskTimer(U16 info);
+/* <RTX_Conf_xxx.c>ļ */
+void   os_error(U32 err_code);
 /* <drv-loader.c>ļ */
 bool_t UFX_LoadDrivers(void);
 /* ûʼ */
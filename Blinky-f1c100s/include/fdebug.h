@@ -10,6 +10,23 @@
 extern "C"  {
 #endif
 
+// ӳٸʽ־DBG_LOGn()ֻ¼ʽָͲɵȼ߳ٸʽ
+// ʽ%sǳ(ָջϵĻ)32λݣָ֧㡣
+#ifndef FDEBUG_DLOG_EN
+#define FDEBUG_DLOG_EN      (1)
+#endif
+#ifndef FDEBUG_DLOG_SIZE
+#define FDEBUG_DLOG_SIZE    (64)    // ־Ŀ2
+#endif
+#ifndef FDEBUG_DLOG_PERIOD
+#define FDEBUG_DLOG_PERIOD  (10)    // ־̵߳(ms)
+#endif
+
+// DBG_PUTC/DBG_PUTS/DBG_OUTPUTʹõĻʽ(UART_TX_DROP/UART_TX_BLOCK)
+#ifndef FDEBUG_TX_FLAGS
+#define FDEBUG_TX_FLAGS     (0)
+#endif
+
 #if defined(FDEBUG_EN) && (FDEBUG_EN > 0)
 extern void fdbg_init(void);
 extern void fdbg_flush(bool_t bClose);
@@ -17,19 +34,41 @@ extern void fdbg_putc(int c);
 extern void fdbg_puts(char const s[]);
 extern void fdbg_rxchar(char c);
 extern void fdbg_output(void const* bin, unsigned num);
+extern unsigned fdbg_write(void const* buf, unsigned num, unsigned flags);
 #define DBG_INIT()       fdbg_init()
 #define DBG_CLOSE()      fdbg_flush(1)
 #define DBG_PUTC(c)      fdbg_putc(c)
 #define DBG_PUTS(s)      fdbg_puts(s)
 #define DBG_OUTPUT(s,n)  fdbg_output(s,n)
+#define DBG_WRITE(s,n,f) fdbg_write(s,n,f)
 #define DBG_PRINT(...)   printf(__VA_ARGS__)
+#if (FDEBUG_DLOG_EN > 0)
+extern void fdbg_dlog(char const* fmt, u32_t a0, u32_t a1, u32_t a2, u32_t a3);
+#define DBG_LOG0(f)            fdbg_dlog(f,0,0,0,0)
+#define DBG_LOG1(f,a)          fdbg_dlog(f,(u32_t)(a),0,0,0)
+#define DBG_LOG2(f,a,b)        fdbg_dlog(f,(u32_t)(a),(u32_t)(b),0,0)
+#define DBG_LOG3(f,a,b,c)      fdbg_dlog(f,(u32_t)(a),(u32_t)(b),(u32_t)(c),0)
+#define DBG_LOG4(f,a,b,c,d)    fdbg_dlog(f,(u32_t)(a),(u32_t)(b),(u32_t)(c),(u32_t)(d))
+#else
+#define DBG_LOG0(f)            printf(f)
+#define DBG_LOG1(f,a)          printf(f,a)
+#define DBG_LOG2(f,a,b)        printf(f,a,b)
+#define DBG_LOG3(f,a,b,c)      printf(f,a,b,c)
+#define DBG_LOG4(f,a,b,c,d)    printf(f,a,b,c,d)
+#endif
 #else
 #define DBG_INIT()
 #define DBG_CLOSE()
 #define DBG_PUTC(c)
 #define DBG_PUTS(s)
 #define DBG_OUTPUT(s,n)
+#define DBG_WRITE(s,n,f)
 #define DBG_PRINT(...)
+#define DBG_LOG0(f)
+#define DBG_LOG1(f,a)
+#define DBG_LOG2(f,a,b)
+#define DBG_LOG3(f,a,b,c)
+#define DBG_LOG4(f,a,b,c,d)
 #endif
 
 #ifdef __cplusplus
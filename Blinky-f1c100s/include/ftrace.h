@@ -0,0 +1,82 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __FTRACE_H__
+#define __FTRACE_H__
+////////////////////////////////////////////////////////////////////////////////
+// Ƹ٣ֻ¼¼IDHRTʱ4ʽ˵
+// tools/trace-decodeɣ·Ŀֻʮָ
+////////////////////////////////////////////////////////////////////////////////
+#include "ftypes.h"
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+// ٿأʱ1
+#ifndef TRACE_EN
+#define TRACE_EN          (0)
+#endif
+
+// λļ¼2(ÿ¼24ֽ)
+#ifndef TRACE_BUF_SIZE
+#define TRACE_BUF_SIZE    (4096)
+#endif
+
+#define TRACE_MAGIC       (0x43525446UL)  // "FTRC"
+#define TRACE_VERSION     (1)
+
+// ¼ID<ftrace_evt.h>
+enum {
+  TRC_NONE = 0,
+#define TRACE_EVT(name, fmt)  name,
+#include "ftrace_evt.h"
+#undef TRACE_EVT
+  TRC_COUNT
+};
+
+typedef struct {
+  u32_t ts;             // HRTʱ(TARGET_HRT_FREQ)
+  u16_t id;             // TRC_xxx
+  u16_t nargs;
+  u32_t arg[4];
+} TraceRecType;
+
+// ڴ沼־dumpʽֱͨӶȡTRACE_BufferҲܽ
+typedef struct {
+  u32_t magic;
+  u32_t version;
+  u32_t freq;           // ʱƵ(Hz)
+  u32_t size;           // ¼
+  volatile u32_t head;  // ۼдļ¼¼¼Ϊrec[(head-1)%size]
+  volatile u32_t mask;  // ¼ʹλͼnλӦ¼ID n
+  TraceRecType rec[TRACE_BUF_SIZE];
+} TraceBufType;
+
+#if (TRACE_EN > 0)
+extern TraceBufType TRACE_Buffer;
+void    TRACE_Init(void);
+void    TRACE_SetMask(u32_t mask);
+void    TRACE_Record(u32_t id, u32_t nargs, u32_t a0, u32_t a1, u32_t a2, u32_t a3);
+void    TRACE_Dump(void);
+#define TRACE0(id)             TRACE_Record(id,0,0,0,0,0)
+#define TRACE1(id,a)           TRACE_Record(id,1,(u32_t)(a),0,0,0)
+#define TRACE2(id,a,b)         TRACE_Record(id,2,(u32_t)(a),(u32_t)(b),0,0)
+#define TRACE3(id,a,b,c)       TRACE_Record(id,3,(u32_t)(a),(u32_t)(b),(u32_t)(c),0)
+#define TRACE4(id,a,b,c,d)     TRACE_Record(id,4,(u32_t)(a),(u32_t)(b),(u32_t)(c),(u32_t)(d))
+#else
+#define TRACE_Init()
+#define TRACE_SetMask(mask)
+#define TRACE_Dump()
+#define TRACE0(id)
+#define TRACE1(id,a)
+#define TRACE2(id,a,b)
+#define TRACE3(id,a,b,c)
+#define TRACE4(id,a,b,c,d)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __FTRACE_H__ */
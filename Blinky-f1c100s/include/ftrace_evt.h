@@ -0,0 +1,18 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+////////////////////////////////////////////////////////////////////////////////
+// ¼ÿһ¼(, ʽ)32λ޷ʽ
+// ̼˽빤tools/trace-decodeļ¼ֻ
+// ¼ID˳1ʼţΪþɵdumpܽ룬ֻĩβ׷ӡ
+// ļûаʹȶTRACE_EVT(name, fmt)ٰ
+////////////////////////////////////////////////////////////////////////////////
+TRACE_EVT(TRC_IRQ_ENTER,      "irq %u enter")
+TRACE_EVT(TRC_IRQ_EXIT,       "irq %u exit")
+TRACE_EVT(TRC_TASK_SWITCH,    "switch to task %u")
+TRACE_EVT(TRC_LCD_VBLANK,     "lcd vblank")
+TRACE_EVT(TRC_FRAME_FLIP,     "frame flip to buffer %u")
+TRACE_EVT(TRC_UFX_TMR_POST,   "ufx timer %u expired")
+TRACE_EVT(TRC_UFX_TMR_RUN,    "ufx timer call %08x(%08x)")
+TRACE_EVT(TRC_UFX_TMR_DONE,   "ufx timer call %08x done")
+TRACE_EVT(TRC_USER0,          "user0 %08x %08x %08x %08x")
+TRACE_EVT(TRC_USER1,          "user1 %08x %08x %08x %08x")
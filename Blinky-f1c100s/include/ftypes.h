@@ -41,6 +41,14 @@ typedef void const*         pcvoid_t;
 #define IS_BIG_ENDIAN       (1)
 #endif
 
+#elif defined (__GNUC__)
+
+#if (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define IS_BIG_ENDIAN       (1)
+#else
+#define IS_BIG_ENDIAN       (0)
+#endif
+
 #else
 
 #error IS_BIG_ENDIANδ壡
@@ -57,6 +57,7 @@ void MMU_DisableMMU(void);
 // Set TTBase
 //=========================
 void MMU_SetTTBase(unsigned long base);
+unsigned long MMU_GetTTBase(void);
 void MMU_SetDomain(unsigned long domain);
 
 //=========================
@@ -109,6 +110,7 @@ void MMU_SetProcessId(unsigned long pid);
 //============
 void MMU_CleanDCacheArray(unsigned long mva, unsigned long num);
 void MMU_InvalidateDCacheArray(unsigned long mva, unsigned long num);
+void MMU_SetSectionAttr(unsigned long mva, unsigned long size, unsigned long attr);
 
 ////////////////////////////////////////////////////////////////////////////////
 #endif /* __ARM926EJS_MMU_H__ */
@@ -8,6 +8,11 @@
 #include "mmu.h"
 #include "F1C100s.h"
 
+#if defined(__HOST_SIM)
+// Linux壺ٽڴԵhost-simṩ
+#include "target_host.h"
+#else
+
 #define MEM_PI_SRAM     __attribute__((section("SRAM")))
 
 #define MEM_PI_SUMMARY  __attribute__((section("SUMMARY")))
@@ -120,6 +125,8 @@ static inline uint16_t UTL_REV16(uint16_t val)
 #pragma thumb
 #endif
 
+#endif /* __HOST_SIM */
+
 #ifndef COUNTOF
 #define COUNTOF(ar) (sizeof(ar)/sizeof(ar[0]))
 #endif
@@ -138,6 +145,12 @@ void    target_wdt_setup(void);
 void    target_wdt_feed(void);
 void    target_reset(void);
 
+/* ߾ȼʱ(TIMER1У24MhzԼ178һ) */
+#define TARGET_HRT_FREQ   (24000000UL)
+#define TARGET_HRT_US(t)  ((t) / (TARGET_HRT_FREQ / 1000000UL))
+void    target_hrt_setup(void);
+u32_t   target_hrt_read(void);
+
 ////////////////////////////////////////////////////////////////////////////////
 #endif /* __TARGET_H__ */
 
@@ -0,0 +1,66 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __TASK_MONITOR_H__
+#define __TASK_MONITOR_H__
+////////////////////////////////////////////////////////////////////////////////
+#include "ftypes.h"
+#ifdef __RTX
+#include "RTL.h"
+#endif
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+// أͳÿCPUռʺջʷʱ1
+#ifndef TSKMON_EN
+#define TSKMON_EN             (0)
+#endif
+
+// ɼӵ벻С<RTX_Conf_xxx.c>еOS_TASKCNT
+#ifndef TSKMON_MAXTASK
+#define TSKMON_MAXTASK        (40)
+#endif
+
+// Դӡļ(ms)Ϊ0Զӡ
+#ifndef TSKMON_REPORT_PERIOD
+#define TSKMON_REPORT_PERIOD  (5000)
+#endif
+
+// ջ֣δùջԪֵָ
+#define TSKMON_STK_MAGIC      (0xCDCDCDCDUL)
+
+typedef struct {
+  char const* name;     // δǼǵΪNULL
+  u32_t tid;            // ID0ʾidle
+  u32_t cpu_permille;   // ϸͳƴڵCPUռ(ǧֱ)
+  u32_t cycles;         // ۼʱ(HRTֵ)
+  u32_t switches;       // ۼƱеĴ
+  u32_t stk_size;       // ջС(ֽ)δǼΪ0
+  u32_t stk_used;       // ջʷ(ֽ)
+} TaskMonInfoType;
+
+#if (TSKMON_EN > 0)
+void    TSKMON_Init(void);
+void    TSKMON_PaintStack(void* stk, u32_t size);
+void    TSKMON_Register(OS_TID tid, char const* name, void* stk, u32_t size);
+OS_TID  TSKMON_CreateTask(char const* name, void (*task)(void), U8 prio, void* stk, U16 size);
+void    TSKMON_Sample(void);
+bool_t  TSKMON_GetInfo(u32_t tid, TaskMonInfoType* info);
+void    TSKMON_Report(void);
+#else
+#define TSKMON_Init()
+#define TSKMON_PaintStack(stk,size)
+#define TSKMON_Register(tid,name,stk,size)
+#define TSKMON_CreateTask(name,task,prio,stk,size)  os_tsk_create_user(task,prio,stk,size)
+#define TSKMON_Sample()
+#define TSKMON_GetInfo(tid,info)  (false)
+#define TSKMON_Report()
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __TASK_MONITOR_H__ */
@@ -0,0 +1,167 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "fb-csc.h"
+
+// Rec.601ȨأΪCSC_ONE
+static int32_t const _luma[3] = { 306, 601, 117 };
+
+static int32_t __clamp(int32_t v, int32_t lo, int32_t hi)
+{
+  return (v < lo) ? lo : (v > hi) ? hi : v;
+}
+
+static void __saturate(ColorMatrixType* cm)
+{
+  int i, j;
+
+  for (i = 0; i < 3; i++) {
+    for (j = 0; j < 3; j++)
+      cm->m[i][j] = __clamp(cm->m[i][j], CSC_COEF_MIN, CSC_COEF_MAX);
+    cm->m[i][3] = __clamp(cm->m[i][3], CSC_OFS_MIN, CSC_OFS_MAX);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: CSC_Identity
+//|  |: λ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void CSC_Identity(ColorMatrixType* cm)
+{
+  int i, j;
+
+  for (i = 0; i < 3; i++) {
+    for (j = 0; j < 4; j++)
+      cm->m[i][j] = (i == j) ? CSC_ONE : 0;
+  }
+}
+
+int CSC_IsIdentity(ColorMatrixType const* cm)
+{
+  int i, j;
+
+  for (i = 0; i < 3; i++) {
+    for (j = 0; j < 4; j++) {
+      if (cm->m[i][j] != ((i == j) ? CSC_ONE : 0))
+        return 0;
+    }
+  }
+  return 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: CSC_Adjust
+//|  |: ȡԱȶȡͶɾ
+//|          |:
+//| б |: brightness: Ҷȼƫ(-255~255)0
+//|          |: contrast: ٷֱȣ128Ϊ죬100
+//|          |: saturation: ٷֱȣ0Ϊڰף100
+//|      |:
+//|          |:
+//| עϢ |:  = contrast * (saturation *  - 128) + 128 + brightness
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void CSC_Adjust(ColorMatrixType* cm, int32_t brightness, int32_t contrast, int32_t saturation)
+{
+  int32_t s = saturation * CSC_ONE / 100;
+  int32_t c = contrast * CSC_ONE / 100;
+  int32_t v;
+  int i, j;
+
+  for (i = 0; i < 3; i++) {
+    for (j = 0; j < 3; j++) {
+      v = ((CSC_ONE - s) * _luma[j]) / CSC_ONE + ((i == j) ? s : 0);
+      cm->m[i][j] = (v * c) / CSC_ONE;
+    }
+    cm->m[i][3] = (128 * CSC_OFS_ONE * (CSC_ONE - c)) / CSC_ONE + brightness * CSC_OFS_ONE;
+  }
+  __saturate(cm);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: CSC_Tint
+//|  |: ٷֱŸͨҹģʽɫ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: оϵӡ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void CSC_Tint(ColorMatrixType* cm, int32_t r, int32_t g, int32_t b)
+{
+  int32_t const pct[3] = { r, g, b };
+  int i, j;
+
+  for (i = 0; i < 3; i++) {
+    for (j = 0; j < 4; j++)
+      cm->m[i][j] = cm->m[i][j] * pct[i] / 100;
+  }
+  __saturate(cm);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: CSC_Fade
+//|  |: ɫ
+//|          |:
+//| б |: level: 0Ϊȫڣ256
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: оϵӣƫһţԵһǴڡ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void CSC_Fade(ColorMatrixType* cm, int32_t level)
+{
+  int i, j;
+
+  level = __clamp(level, 0, 256);
+  for (i = 0; i < 3; i++) {
+    for (j = 0; j < 4; j++)
+      cm->m[i][j] = cm->m[i][j] * level / 256;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: CSC_Apply
+//|  |: XRGB8888ӲͬĶ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ˷Ͳã̼ʾDEBEɣ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void CSC_Apply(ColorMatrixType const* cm, uint32_t* pixels, uint32_t count)
+{
+  int32_t in[3], out[3];
+  uint32_t n;
+  int i;
+
+  for (n = 0; n < count; n++) {
+    in[0] = (pixels[n] >> 16) & 0xff;
+    in[1] = (pixels[n] >> 8) & 0xff;
+    in[2] = pixels[n] & 0xff;
+    for (i = 0; i < 3; i++) {
+      out[i] = cm->m[i][0] * in[0] + cm->m[i][1] * in[1] + cm->m[i][2] * in[2]
+             + cm->m[i][3] * (CSC_ONE / CSC_OFS_ONE);
+      out[i] = __clamp((out[i] + CSC_ONE / 2) >> 10, 0, 255);
+    }
+    pixels[n] = (pixels[n] & 0xff000000) | ((uint32_t)out[0] << 16) | ((uint32_t)out[1] << 8) | (uint32_t)out[2];
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 #include <string.h>
 #include <stddef.h>
 #include <stdlib.h>
+#include <stdio.h>
 #include "clk-f1c100s-pll.h"
 #include "reset-f1c100s.h"
 #include "gpio-f1c100s.h"
@@ -34,18 +35,21 @@
 #include "f1c100s/reg-defe.h"
 #include "f1c100s/reg-debe.h"
 #include "f1c100s/reg-ccu.h"
+#include "sys-splash.h"
 #include "io.h"
+#include "mmu.h"
+#include "target.h"
+#include "ftrace.h"
 
 #define phys_to_virt(x) (x)
 
-#define FB_LCD_XSIZE    (480)
-#define FB_LCD_YSIZE    (272)
-
 typedef struct {
   uint32_t virtdefe;
   uint32_t virtdebe;
   uint32_t virttcon;
 
+  fb_panel_t const* panel;
+
   char const* clkdefe;
   char const* clkdebe;
   char const* clktcon;
@@ -54,6 +58,8 @@ typedef struct {
   int32_t rsttcon;
   int32_t width;
   int32_t height;
+  int32_t vwidth;
+  int32_t vheight;
   int32_t pwidth;
   int32_t pheight;
   int32_t bits_per_pixel;
@@ -61,6 +67,42 @@ typedef struct {
   int32_t index;
   void* vram[2];
 
+  /* Scanout state as latched into DEBE */
+  void* base;
+  int32_t xorg;
+  int32_t yorg;
+
+  /* Splash of the SPL, scanned out until fb_f1c100s_end_splash() */
+  void* splash;
+
+  /* Layer1 overlay */
+  void* ovl;
+  int32_t ovl_x;
+  int32_t ovl_y;
+  int32_t ovl_on;
+  int32_t ovl_key;
+  uint32_t key_min;
+  uint32_t key_max;
+
+  /* Output color matrix */
+  ColorMatrixType csc;
+  int32_t csc_en;
+
+  /* Staged by fb_f1c100s_commit(), applied by fb_f1c100s_vsync() */
+  fb_state_t next;
+  fb_commit_cb_t cb[FB_COMMIT_CB_MAX];
+  void* cb_arg[FB_COMMIT_CB_MAX];
+  int32_t ncb;
+
+  /* Callbacks of the last load, run once DEBE has latched it */
+  fb_commit_cb_t load_cb[FB_COMMIT_CB_MAX];
+  void* load_cb_arg[FB_COMMIT_CB_MAX];
+  int32_t nload;
+
+  /* TCON0 dot clock divider at full rate, and the refresh governor factor */
+  int32_t dclk_div;
+  int32_t refresh_div;
+
   struct {
     int32_t pixel_clock_hz;
     int32_t h_front_porch;
@@ -91,7 +133,6 @@ static pwm_t led_pwm_bl = {
 };
 
 static fb_f1c100s_priv_data_t fb_f1c100s_priv_object;
-static uint32_t fb_mem[2][FB_LCD_XSIZE * FB_LCD_YSIZE] __attribute__((aligned(32)));
 
 reset_f1c100s_t reset_1 = {
   .virt = 0x01c202c0,
@@ -130,17 +171,36 @@ inline static void f1c100s_debe_set_mode(fb_f1c100s_priv_data_t* pdat)
 
   write32((uint32_t)&debe->disp_size, (((pdat->height) - 1) << 16) | (((pdat->width) - 1) << 0));
   write32((uint32_t)&debe->layer0_size, (((pdat->height) - 1) << 16) | (((pdat->width) - 1) << 0));
-  write32((uint32_t)&debe->layer0_stride, ((pdat->width) << 5));
-  write32((uint32_t)&debe->layer0_addr_low32b, (uint32_t)(pdat->vram[pdat->index]) << 3);
-  write32((uint32_t)&debe->layer0_addr_high4b, (uint32_t)(pdat->vram[pdat->index]) >> 29);
+  write32((uint32_t)&debe->layer0_stride, ((pdat->vwidth * pdat->bytes_per_pixel) << 3));
+  write32((uint32_t)&debe->layer0_addr_low32b, (uint32_t)(pdat->base) << 3);
+  write32((uint32_t)&debe->layer0_addr_high4b, (uint32_t)(pdat->base) >> 29);
+#if (FB_LAYER0_BPP == 8)
+  write32((uint32_t)&debe->layer0_attr0_ctrl, (1 << 22));               /* palette mode */
+  write32((uint32_t)&debe->layer0_attr1_ctrl, (0x03 << 8));             /* 8bpp index */
+#else
   write32((uint32_t)&debe->layer0_attr1_ctrl, (0x09 << 8) | (1 << 2));  /* ˴ظʽ */
+#endif
+
+  if (pdat->ovl) {
+    /* Alpha only blends across pipes, so the overlay sits in pipe1 on top */
+    write32((uint32_t)&debe->layer1_size, (((pdat->height) - 1) << 16) | (((pdat->width) - 1) << 0));
+    write32((uint32_t)&debe->layer1_pos, 0);
+    write32((uint32_t)&debe->layer1_stride, ((pdat->width) << 5));
+    write32((uint32_t)&debe->layer1_addr_low32b, (uint32_t)(pdat->ovl) << 3);
+    write32((uint32_t)&debe->layer1_addr_high4b, (uint32_t)(pdat->ovl) >> 29);
+    write32((uint32_t)&debe->layer1_attr0_ctrl, (1 << 15) | (1 << 10));
+    write32((uint32_t)&debe->layer1_attr1_ctrl, (0x0a << 8));             /* ARGB8888 */
+  }
 
   val = read32((uint32_t)&debe->mode);
   val |= (1 << 8);
+  if (pdat->ovl && pdat->ovl_on)
+    val |= (1 << 9);
   write32((uint32_t)&debe->mode, val);
 
+  /* Autoload off, the explicit load in f1c100s_debe_load() is the only latch */
   val = read32((uint32_t)&debe->reg_ctrl);
-  val |= (1 << 0);
+  val |= (1 << 1) | (1 << 0);
   write32((uint32_t)&debe->reg_ctrl, val);
 
   val = read32((uint32_t)&debe->mode);
@@ -156,6 +216,79 @@ inline static void f1c100s_debe_set_address(fb_f1c100s_priv_data_t* pdat, void*
   write32((uint32_t)&debe->layer0_addr_high4b, (uint32_t)vram >> 29);
 }
 
+/*
+ * Point layer0 at the panel window of the virtual screen. Panning is only an
+ * address offset, the stride stays the virtual width, so no pixel is copied.
+ */
+static void f1c100s_debe_set_window(fb_f1c100s_priv_data_t* pdat)
+{
+  struct f1c100s_debe_reg_t* debe = (struct f1c100s_debe_reg_t*)(pdat->virtdebe);
+  uint32_t addr;
+
+  addr = (uint32_t)pdat->base + ((pdat->yorg * pdat->vwidth + pdat->xorg) * pdat->bytes_per_pixel);
+  write32((uint32_t)&debe->layer0_stride, ((pdat->vwidth * pdat->bytes_per_pixel) << 3));
+  f1c100s_debe_set_address(pdat, (void*)addr);
+}
+
+static void f1c100s_debe_set_overlay(fb_f1c100s_priv_data_t* pdat)
+{
+  struct f1c100s_debe_reg_t* debe = (struct f1c100s_debe_reg_t*)(pdat->virtdebe);
+  uint32_t val;
+
+  val = read32((uint32_t)&debe->mode) & ~(1 << 9);
+  if (pdat->ovl_on)
+    val |= (1 << 9);
+  write32((uint32_t)&debe->mode, val);
+  write32((uint32_t)&debe->layer1_pos, (((uint32_t)pdat->ovl_y & 0xffff) << 16) | ((uint32_t)pdat->ovl_x & 0xffff));
+  write32((uint32_t)&debe->color_key_min, pdat->key_min);
+  write32((uint32_t)&debe->color_key_max, pdat->key_max);
+  /* R/G/B each: match when min <= c <= max */
+  write32((uint32_t)&debe->color_key_config, (1 << 4) | (1 << 2) | (1 << 0));
+  val = read32((uint32_t)&debe->layer1_attr0_ctrl) & ~(0x3 << 18);
+  if (pdat->ovl_key)
+    val |= (0x1 << 18);
+  write32((uint32_t)&debe->layer1_attr0_ctrl, val);
+}
+
+/*
+ * The DEBE color matrix works on G/R/B order for both rows and columns,
+ * coefficients are s2.10 in 13 bits and constants have 4 fraction bits.
+ */
+static void f1c100s_debe_set_csc(fb_f1c100s_priv_data_t* pdat)
+{
+  static const int32_t map[3] = { 1, 0, 2 };
+  struct f1c100s_debe_reg_t* debe = (struct f1c100s_debe_reg_t*)(pdat->virtdebe);
+  int32_t r, c;
+
+  if (pdat->csc_en) {
+    for (r = 0; r < 3; r++) {
+      for (c = 0; c < 3; c++)
+        write32((uint32_t)&debe->output_color_coef[r * 4 + c], (uint32_t)pdat->csc.m[map[r]][map[c]] & 0x1fff);
+      write32((uint32_t)&debe->output_color_coef[r * 4 + 3], (uint32_t)pdat->csc.m[map[r]][3] & 0x3fff);
+    }
+  }
+  write32((uint32_t)&debe->output_color_ctrl, pdat->csc_en ? (1 << 0) : 0);
+}
+
+/*
+ * The layer, window and color registers are double buffered, setting the
+ * load bit copies all of them into the pipeline at the next frame start.
+ * The bit clears itself once they are copied.
+ */
+inline static void f1c100s_debe_load(fb_f1c100s_priv_data_t* pdat)
+{
+  struct f1c100s_debe_reg_t* debe = (struct f1c100s_debe_reg_t*)(pdat->virtdebe);
+
+  write32((uint32_t)&debe->reg_ctrl, read32((uint32_t)&debe->reg_ctrl) | (1 << 0));
+}
+
+inline static int32_t f1c100s_debe_loading(fb_f1c100s_priv_data_t* pdat)
+{
+  struct f1c100s_debe_reg_t* debe = (struct f1c100s_debe_reg_t*)(pdat->virtdebe);
+
+  return (read32((uint32_t)&debe->reg_ctrl) & (1 << 0)) ? 1 : 0;
+}
+
 inline static void f1c100s_tcon_enable(fb_f1c100s_priv_data_t* pdat)
 {
   struct f1c100s_tcon_reg_t* tcon = (struct f1c100s_tcon_reg_t*)pdat->virttcon;
@@ -309,6 +442,7 @@ inline static void f1c100s_tcon_set_mode(fb_f1c100s_priv_data_t* pdat)
 {
   struct f1c100s_tcon_reg_t* tcon = (struct f1c100s_tcon_reg_t*)pdat->virttcon;
   int32_t bp, total;
+  uint64_t rate;
   uint32_t val;
 
   val = read32((uint32_t)&tcon->ctrl);
@@ -318,8 +452,15 @@ inline static void f1c100s_tcon_set_mode(fb_f1c100s_priv_data_t* pdat)
   val = (pdat->timing.v_front_porch + pdat->timing.v_back_porch + pdat->timing.v_sync_len);
   write32((uint32_t)&tcon->tcon0_ctrl, (1UL << 31) | ((val & 0x1f) << 4));
   //val = clk_get_rate(pdat->clktcon) / pdat->timing.pixel_clock_hz;
-  val = f1c100s_tcon_clk_get_rate() / pdat->timing.pixel_clock_hz;
-  write32((uint32_t)&tcon->tcon0_dclk, (0xFUL << 28) | (val << 0));
+  rate = f1c100s_tcon_clk_get_rate();
+  val = rate / pdat->timing.pixel_clock_hz;
+  if (rate % pdat->timing.pixel_clock_hz) {
+    printf("fb: %s pixel clock %uHz rounded to %uHz (%uHz / %u)\n",
+           pdat->panel->name, (unsigned)pdat->timing.pixel_clock_hz,
+           (unsigned)(rate / val), (unsigned)rate, (unsigned)val);
+  }
+  pdat->dclk_div = val;
+  write32((uint32_t)&tcon->tcon0_dclk, (0xFUL << 28) | ((val * pdat->refresh_div) << 0));
   write32((uint32_t)&tcon->tcon0_timing_active, ((pdat->width - 1) << 16) | ((pdat->height - 1) << 0));
 
   bp = pdat->timing.h_sync_len + pdat->timing.h_back_porch;
@@ -382,6 +523,22 @@ static void fb_f1c100s_init_hw(fb_f1c100s_priv_data_t* pdat)
   pwm_f1c100s_init(pdat->backlight);
 }
 
+/*
+ * Take over the display the SPL splash has set up: TCON0 already runs the
+ * panel timing and is left alone, only the DEBE layers are written again
+ * and latched at a frame start, so the panel never shows a blank frame.
+ */
+static void fb_f1c100s_takeover_hw(fb_f1c100s_priv_data_t* pdat)
+{
+  struct f1c100s_tcon_reg_t* tcon = (struct f1c100s_tcon_reg_t*)pdat->virttcon;
+
+  f1c100s_clk_defe_init();
+  pdat->dclk_div = read32((uint32_t)&tcon->tcon0_dclk) & 0x7f;
+  f1c100s_debe_set_mode(pdat);
+
+  pwm_f1c100s_init(pdat->backlight);
+}
+
 void fb_f1c100s_setbl(framebuffer_t* fb, int32_t brightness)
 {
   fb_f1c100s_priv_data_t* pdat = (fb_f1c100s_priv_data_t*)fb->priv;
@@ -396,13 +553,515 @@ int32_t fb_f1c100s_getbl(framebuffer_t* fb)
   return pwm_f1c100s_get_duty(pdat->backlight);
 }
 
+/*
+ * Start a transaction from the state the display will show after the
+ * pending commit, nothing is staged until fb_f1c100s_commit().
+ */
+void fb_f1c100s_begin(framebuffer_t* fb, fb_state_t* st)
+{
+  fb_f1c100s_priv_data_t* pdat = (fb_f1c100s_priv_data_t*)fb->priv;
+  fb_state_t const* nx;
+  CPU_SR_DECL;
+
+  st->flags = 0;
+  if (!pdat)
+    return;
+  nx = &pdat->next;
+  CPU_ENTER_CRITICAL();
+  st->base = (nx->flags & FB_STATE_BASE) ? nx->base : pdat->base;
+  st->xorg = (nx->flags & FB_STATE_ORIGIN) ? nx->xorg : pdat->xorg;
+  st->yorg = (nx->flags & FB_STATE_ORIGIN) ? nx->yorg : pdat->yorg;
+  st->ovl_on = (nx->flags & FB_STATE_OVL_SHOW) ? nx->ovl_on : pdat->ovl_on;
+  st->ovl_x = (nx->flags & FB_STATE_OVL_POS) ? nx->ovl_x : pdat->ovl_x;
+  st->ovl_y = (nx->flags & FB_STATE_OVL_POS) ? nx->ovl_y : pdat->ovl_y;
+  st->key_on = (nx->flags & FB_STATE_OVL_KEY) ? nx->key_on : pdat->ovl_key;
+  st->key_min = (nx->flags & FB_STATE_OVL_KEY) ? nx->key_min : pdat->key_min;
+  st->key_max = (nx->flags & FB_STATE_OVL_KEY) ? nx->key_max : pdat->key_max;
+  st->csc_en = (nx->flags & FB_STATE_CSC) ? nx->csc_en : pdat->csc_en;
+  st->csc = (nx->flags & FB_STATE_CSC) ? nx->csc : pdat->csc;
+  CPU_EXIT_CRITICAL();
+}
+
+/*
+ * Stage the fields of @st named by its flags for the next vblank. Commits
+ * made before that vblank are merged, the last one wins per field, and all
+ * of them reach the screen in the same frame. @cb runs in the frame
+ * interrupt after the registers are latched. Returns -1 without staging
+ * anything when FB_COMMIT_CB_MAX callbacks are already waiting.
+ */
+int32_t fb_f1c100s_commit(framebuffer_t* fb, fb_state_t const* st, fb_commit_cb_t cb, void* arg)
+{
+  fb_f1c100s_priv_data_t* pdat = (fb_f1c100s_priv_data_t*)fb->priv;
+  fb_state_t* nx;
+  int32_t x, y;
+  CPU_SR_DECL;
+
+  if (!pdat)
+    return -1;
+  CPU_ENTER_CRITICAL();
+  if (cb && pdat->ncb >= FB_COMMIT_CB_MAX) {
+    CPU_EXIT_CRITICAL();
+    return -1;
+  }
+  nx = &pdat->next;
+  if ((st->flags & FB_STATE_BASE) && st->base) {
+    nx->base = st->base;
+    nx->flags |= FB_STATE_BASE;
+  }
+  if (st->flags & FB_STATE_ORIGIN) {
+    x = st->xorg;
+    y = st->yorg;
+    if (x > pdat->vwidth - pdat->width)
+      x = pdat->vwidth - pdat->width;
+    if (x < 0)
+      x = 0;
+    if (y > pdat->vheight - pdat->height)
+      y = pdat->vheight - pdat->height;
+    if (y < 0)
+      y = 0;
+    nx->xorg = x;
+    nx->yorg = y;
+    nx->flags |= FB_STATE_ORIGIN;
+  }
+  if (pdat->ovl && (st->flags & FB_STATE_OVL_SHOW)) {
+    nx->ovl_on = st->ovl_on ? 1 : 0;
+    nx->flags |= FB_STATE_OVL_SHOW;
+  }
+  if (pdat->ovl && (st->flags & FB_STATE_OVL_POS)) {
+    nx->ovl_x = st->ovl_x;
+    nx->ovl_y = st->ovl_y;
+    nx->flags |= FB_STATE_OVL_POS;
+  }
+  if (pdat->ovl && (st->flags & FB_STATE_OVL_KEY)) {
+    nx->key_on = st->key_on ? 1 : 0;
+    nx->key_min = st->key_min & 0x00ffffff;
+    nx->key_max = st->key_max & 0x00ffffff;
+    nx->flags |= FB_STATE_OVL_KEY;
+  }
+  if (st->flags & FB_STATE_CSC) {
+    nx->csc_en = (st->csc_en && !CSC_IsIdentity(&st->csc)) ? 1 : 0;
+    nx->csc = st->csc;
+    nx->flags |= FB_STATE_CSC;
+  }
+  if (cb) {
+    pdat->cb[pdat->ncb] = cb;
+    pdat->cb_arg[pdat->ncb] = arg;
+    pdat->ncb++;
+  }
+  CPU_EXIT_CRITICAL();
+  return 0;
+}
+
+/*
+ * Nonzero while a commit waits for the next vblank.
+ */
+int32_t fb_f1c100s_commit_pending(framebuffer_t* fb)
+{
+  fb_f1c100s_priv_data_t* pdat = (fb_f1c100s_priv_data_t*)fb->priv;
+
+  return (pdat && (pdat->next.flags || pdat->ncb || pdat->nload)) ? 1 : 0;
+}
+
+/*
+ * Frame interrupt half of the transaction: write every staged register,
+ * then one load so DEBE switches over to all of them at the same frame.
+ * The load happens at the following frame start, so the callbacks of a
+ * commit run at the vblank after that, once the load bit has cleared.
+ */
+void fb_f1c100s_vsync(framebuffer_t* fb)
+{
+  fb_f1c100s_priv_data_t* pdat = (fb_f1c100s_priv_data_t*)fb->priv;
+  fb_state_t* nx;
+  uint32_t flags;
+  int32_t i, n;
+
+  if (!pdat)
+    return;
+  if (pdat->nload) {
+    if (f1c100s_debe_loading(pdat))
+      return;
+    n = pdat->nload;
+    pdat->nload = 0;
+    for (i = 0; i < n; i++)
+      pdat->load_cb[i](pdat->load_cb_arg[i]);
+  }
+  if (!pdat->next.flags && !pdat->ncb)
+    return;
+  nx = &pdat->next;
+  flags = nx->flags;
+  nx->flags = 0;
+  if (flags & FB_STATE_BASE)
+    pdat->base = nx->base;
+  if (flags & FB_STATE_ORIGIN) {
+    pdat->xorg = nx->xorg;
+    pdat->yorg = nx->yorg;
+  }
+  if ((flags & (FB_STATE_BASE | FB_STATE_ORIGIN)) && !pdat->splash)
+    f1c100s_debe_set_window(pdat);
+  if (flags & FB_STATE_OVL_SHOW)
+    pdat->ovl_on = nx->ovl_on;
+  if (flags & FB_STATE_OVL_POS) {
+    pdat->ovl_x = nx->ovl_x;
+    pdat->ovl_y = nx->ovl_y;
+  }
+  if (flags & FB_STATE_OVL_KEY) {
+    pdat->ovl_key = nx->key_on;
+    pdat->key_min = nx->key_min;
+    pdat->key_max = nx->key_max;
+  }
+  if (flags & (FB_STATE_OVL_SHOW | FB_STATE_OVL_POS | FB_STATE_OVL_KEY))
+    f1c100s_debe_set_overlay(pdat);
+  if (flags & FB_STATE_CSC) {
+    pdat->csc = nx->csc;
+    pdat->csc_en = nx->csc_en;
+    f1c100s_debe_set_csc(pdat);
+  }
+  n = pdat->ncb;
+  pdat->ncb = 0;
+  if (flags) {
+    f1c100s_debe_load(pdat);
+    for (i = 0; i < n; i++) {
+      pdat->load_cb[i] = pdat->cb[i];
+      pdat->load_cb_arg[i] = pdat->cb_arg[i];
+    }
+    pdat->nload = n;
+  } else {
+    for (i = 0; i < n; i++)
+      pdat->cb[i](pdat->cb_arg[i]);
+  }
+}
+
 void fb_f1c100s_present(framebuffer_t* fb, int index)
 {
   fb_f1c100s_priv_data_t* pdat = (fb_f1c100s_priv_data_t*)fb->priv;
+  fb_state_t st;
 
   if (pdat && (index == 0 || index == 1)) {
-    f1c100s_debe_set_address(pdat, pdat->vram[index]);
+    TRACE1(TRC_FRAME_FLIP, index);
+    pdat->index = index;
+    st.flags = FB_STATE_BASE;
+    st.base = pdat->vram[index];
+    fb_f1c100s_commit(fb, &st, NULL, NULL);
+  }
+}
+
+void fb_f1c100s_set_vram(framebuffer_t* fb, void* vram)
+{
+  fb_state_t st;
+
+  st.flags = FB_STATE_BASE;
+  st.base = vram;
+  fb_f1c100s_commit(fb, &st, NULL, NULL);
+}
+
+void fb_f1c100s_set_origin(framebuffer_t* fb, int32_t x, int32_t y)
+{
+  fb_state_t st;
+
+  st.flags = FB_STATE_ORIGIN;
+  st.xorg = x;
+  st.yorg = y;
+  fb_f1c100s_commit(fb, &st, NULL, NULL);
+}
+
+/*
+ * Queue an output color matrix for the next vblank, NULL or the identity
+ * turns the color pipeline off. Fades cost no CPU time and no bandwidth.
+ */
+void fb_f1c100s_set_csc(framebuffer_t* fb, ColorMatrixType const* cm)
+{
+  fb_state_t st;
+
+  st.flags = FB_STATE_CSC;
+  st.csc_en = cm ? 1 : 0;
+  if (cm)
+    st.csc = *cm;
+  else
+    CSC_Identity(&st.csc);
+  fb_f1c100s_commit(fb, &st, NULL, NULL);
+}
+
+/*
+ * The splash stays on screen while the application draws its first frame,
+ * this switches layer0 over to the committed framebuffer at the next vblank.
+ */
+void fb_f1c100s_end_splash(framebuffer_t* fb)
+{
+  fb_f1c100s_priv_data_t* pdat = (fb_f1c100s_priv_data_t*)fb->priv;
+  fb_state_t st;
+
+  if (!pdat || !pdat->splash)
+    return;
+  fb_f1c100s_begin(fb, &st);
+  st.flags = FB_STATE_BASE;
+  pdat->splash = NULL;
+  fb_f1c100s_commit(fb, &st, NULL, NULL);
+}
+
+void* fb_f1c100s_get_splash(void)
+{
+  return fb_f1c100s_get_panel() ? fb_f1c100s_priv_object.splash : NULL;
+}
+
+void fb_f1c100s_set_palette(framebuffer_t* fb, int32_t index, uint32_t argb)
+{
+  fb_f1c100s_priv_data_t* pdat = (fb_f1c100s_priv_data_t*)fb->priv;
+
+  if (pdat && index >= 0 && index < 256)
+    write32(pdat->virtdebe + F1C100S_DEBE_PALETTE + (index << 2), argb);
+}
+
+void* fb_f1c100s_get_overlay(void)
+{
+  return fb_f1c100s_get_panel() ? fb_f1c100s_priv_object.ovl : NULL;
+}
+
+void fb_f1c100s_overlay_show(framebuffer_t* fb, int32_t on)
+{
+  fb_state_t st;
+
+  st.flags = FB_STATE_OVL_SHOW;
+  st.ovl_on = on;
+  fb_f1c100s_commit(fb, &st, NULL, NULL);
+}
+
+/*
+ * Move the overlay on the panel, the position registers are signed so the
+ * layer may be partly off screen.
+ */
+void fb_f1c100s_overlay_move(framebuffer_t* fb, int32_t x, int32_t y)
+{
+  fb_state_t st;
+
+  st.flags = FB_STATE_OVL_POS;
+  st.ovl_x = x;
+  st.ovl_y = y;
+  fb_f1c100s_commit(fb, &st, NULL, NULL);
+}
+
+/*
+ * Set the color key range of the overlay (0x00RRGGBB, inclusive per channel).
+ * Overlay pixels inside the range are not shown, the layer below is.
+ */
+void fb_f1c100s_overlay_colorkey(framebuffer_t* fb, uint32_t min, uint32_t max)
+{
+  fb_state_t st;
+
+  fb_f1c100s_begin(fb, &st);
+  st.flags = FB_STATE_OVL_KEY;
+  st.key_min = min;
+  st.key_max = max;
+  fb_f1c100s_commit(fb, &st, NULL, NULL);
+}
+
+void fb_f1c100s_overlay_colorkey_enable(framebuffer_t* fb, int32_t on)
+{
+  fb_state_t st;
+
+  fb_f1c100s_begin(fb, &st);
+  st.flags = FB_STATE_OVL_KEY;
+  st.key_on = on;
+  fb_f1c100s_commit(fb, &st, NULL, NULL);
+}
+
+/*
+ * Read and clear the pending TCON0 interrupt flags, the enables are kept.
+ */
+uint32_t fb_f1c100s_irq_ack(framebuffer_t* fb)
+{
+  fb_f1c100s_priv_data_t* pdat = (fb_f1c100s_priv_data_t*)fb->priv;
+  struct f1c100s_tcon_reg_t* tcon = (struct f1c100s_tcon_reg_t*)pdat->virttcon;
+  uint32_t val;
+
+  val = read32((uint32_t)&tcon->int0);
+  write32((uint32_t)&tcon->int0, val & 0xffff0000);
+  return val & (FB_IRQ_VBLANK | FB_IRQ_LINE);
+}
+
+/*
+ * Raise the line interrupt when the beam reaches active line @line, the
+ * hardware counts from the start of vsync. A negative line disables it.
+ * The flags are write-0-to-clear, so 1s are written back to leave pending
+ * ones to the interrupt, and the frame interrupt's own update of int0 is
+ * kept out while the enables change.
+ */
+void fb_f1c100s_set_line_irq(framebuffer_t* fb, int32_t line)
+{
+  fb_f1c100s_priv_data_t* pdat = (fb_f1c100s_priv_data_t*)fb->priv;
+  struct f1c100s_tcon_reg_t* tcon = (struct f1c100s_tcon_reg_t*)pdat->virttcon;
+  uint32_t val;
+  CPU_SR_DECL;
+
+  CPU_ENTER_CRITICAL();
+  val = read32((uint32_t)&tcon->int0) | 0xffff;
+  if (line < 0 || line >= pdat->height) {
+    write32((uint32_t)&tcon->int0, val & ~(1 << 29));
+  } else {
+    line += pdat->timing.v_sync_len + pdat->timing.v_back_porch;
+    write32((uint32_t)&tcon->int1, ((uint32_t)line & 0xfff) << 16);
+    write32((uint32_t)&tcon->int0, val | (1 << 29));
   }
+  CPU_EXIT_CRITICAL();
+}
+
+/*
+ * Divide the dot clock by @div to lower the refresh rate of a static screen,
+ * the line and frame timing is kept so the panel only sees a slower clock.
+ * Takes effect at once, a frame in progress is just scanned out slower.
+ */
+int32_t fb_f1c100s_set_refresh_div(framebuffer_t* fb, int32_t div)
+{
+  fb_f1c100s_priv_data_t* pdat = (fb_f1c100s_priv_data_t*)fb->priv;
+  struct f1c100s_tcon_reg_t* tcon;
+
+  if (!pdat)
+    return 1;
+  if (div < 1)
+    div = 1;
+  if (div > FB_REFRESH_DIV_MAX)
+    div = FB_REFRESH_DIV_MAX;
+  while (div > 1 && pdat->dclk_div * div > 0x7f)
+    div--;
+  if (div != pdat->refresh_div) {
+    tcon = (struct f1c100s_tcon_reg_t*)pdat->virttcon;
+    pdat->refresh_div = div;
+    write32((uint32_t)&tcon->tcon0_dclk, (0xFUL << 28) | ((pdat->dclk_div * div) << 0));
+  }
+  return div;
+}
+
+void fb_f1c100s_get_scan(framebuffer_t* fb, fb_scan_t* scan)
+{
+  fb_f1c100s_priv_data_t* pdat = (fb_f1c100s_priv_data_t*)fb->priv;
+  int32_t htotal;
+
+  htotal = pdat->width + pdat->timing.h_front_porch + pdat->timing.h_back_porch + pdat->timing.h_sync_len;
+  scan->vstart = pdat->timing.v_front_porch + pdat->timing.v_sync_len + pdat->timing.v_back_porch;
+  scan->vtotal = pdat->height + scan->vstart;
+  scan->line_ns = (uint32_t)(((uint64_t)htotal * pdat->dclk_div * 1000000000ULL) / f1c100s_tcon_clk_get_rate());
+  scan->line_ns *= pdat->refresh_div;
+}
+
+/*
+ * The SPL leaves its splash on screen when it found one (sys-splash.c):
+ * TCON0 running this panel's timing and layer0 scanning a 32bpp buffer at
+ * the end of the FB_MEM_BASE region. Returns that buffer when it lies above
+ * @used, NULL when the display is off or set up differently.
+ */
+static void* fb_f1c100s_find_splash(fb_panel_t const* p, uint32_t used)
+{
+#if (FB_LAYER0_BPP == 32)
+  struct f1c100s_tcon_reg_t* tcon = (struct f1c100s_tcon_reg_t*)phys_to_virt(F1C100S_TCON_BASE);
+  struct f1c100s_debe_reg_t* debe = (struct f1c100s_debe_reg_t*)phys_to_virt(F1C100S_DEBE_BASE);
+  uint32_t size, addr;
+
+  if ((read32(0x01c20064) & ((1 << 12) | (1 << 4))) != ((1 << 12) | (1 << 4)))
+    return NULL;
+  if (!(read32((uint32_t)&tcon->ctrl) & (1UL << 31)) || !(read32((uint32_t)&debe->mode) & (1 << 1)))
+    return NULL;
+  size = ((uint32_t)(p->width - 1) << 16) | (uint32_t)(p->height - 1);
+  if (read32((uint32_t)&tcon->tcon0_timing_active) != size)
+    return NULL;
+  if ((read32((uint32_t)&tcon->tcon0_dclk) & 0x7f) != f1c100s_tcon_clk_get_rate() / p->pixel_clock_hz)
+    return NULL;
+  size = ((uint32_t)(p->height - 1) << 16) | (uint32_t)(p->width - 1);
+  if (read32((uint32_t)&debe->disp_size) != size || read32((uint32_t)&debe->layer0_stride) != ((uint32_t)p->width << 5))
+    return NULL;
+  addr = (read32((uint32_t)&debe->layer0_addr_low32b) >> 3) | (read32((uint32_t)&debe->layer0_addr_high4b) << 29);
+  if (addr != SPLASH_FB_ADDR(p->width, p->height) || addr < FB_MEM_BASE + used ||
+      addr + (uint32_t)(p->width * p->height * 4) > FB_MEM_BASE + FB_MEM_SIZE)
+    return NULL;
+  return (void*)addr;
+#else
+  return NULL;
+#endif
+}
+
+/*
+ * Carve the framebuffers for a panel out of the FB_MEM_BASE region. The
+ * virtual screen shrinks to the panel size when the pages do not fit.
+ */
+static int32_t fb_f1c100s_alloc(fb_f1c100s_priv_data_t* pdat, fb_panel_t const* p)
+{
+  uint32_t size, ovl, xpages = FB_VIRT_XPAGES, ypages = FB_VIRT_YPAGES;
+  uint8_t* mem = (uint8_t*)FB_MEM_BASE;
+  int32_t i;
+
+  ovl = FB_OVERLAY_EN ? (uint32_t)(p->width * p->height * 4) : 0;
+  for (;;) {
+    size = (uint32_t)(p->width * xpages * p->height * ypages * (FB_LAYER0_BPP / 8));
+    size = (size + 0xfff) & ~0xfff;
+    if (size * FB_NUM_BUFFERS + ovl <= FB_MEM_SIZE)
+      break;
+    if (xpages == 1 && ypages == 1)
+      return -1;
+    xpages = ypages = 1;
+  }
+
+  pdat->panel = p;
+  pdat->width = p->width;
+  pdat->height = p->height;
+  pdat->vwidth = p->width * xpages;
+  pdat->vheight = p->height * ypages;
+  pdat->pwidth = p->pwidth;
+  pdat->pheight = p->pheight;
+  pdat->bits_per_pixel = p->bits_per_pixel;
+  pdat->bytes_per_pixel = FB_LAYER0_BPP / 8;
+  pdat->timing.pixel_clock_hz = p->pixel_clock_hz;
+  pdat->timing.h_front_porch = p->h_front_porch;
+  pdat->timing.h_back_porch = p->h_back_porch;
+  pdat->timing.h_sync_len = p->h_sync_len;
+  pdat->timing.v_front_porch = p->v_front_porch;
+  pdat->timing.v_back_porch = p->v_back_porch;
+  pdat->timing.v_sync_len = p->v_sync_len;
+  pdat->timing.h_sync_active = p->h_sync_active;
+  pdat->timing.v_sync_active = p->v_sync_active;
+  pdat->timing.den_active = p->den_active;
+  pdat->timing.clk_active = p->clk_active;
+
+  for (i = 0; i < 2; i++)
+    pdat->vram[i] = mem + size * ((i < FB_NUM_BUFFERS) ? i : 0);
+  pdat->ovl = ovl ? mem + size * FB_NUM_BUFFERS : NULL;
+  pdat->splash = (xpages == 1) ? fb_f1c100s_find_splash(p, size * FB_NUM_BUFFERS + ovl) : NULL;
+  memset(mem, 0, size * FB_NUM_BUFFERS + ovl);
+  return 0;
+}
+
+/*
+ * Select the panel timing by name before the display is initialized, NULL
+ * takes FB_PANEL. Returns NULL and keeps the previous panel when the name
+ * is unknown or its framebuffers do not fit into FB_MEM_SIZE.
+ */
+fb_panel_t const* fb_f1c100s_select_panel(char const* name)
+{
+  fb_f1c100s_priv_data_t* pdat = &fb_f1c100s_priv_object;
+  static int32_t mapped = 0;
+  fb_panel_t const* p;
+
+  p = fb_panel_find(name ? name : FB_PANEL);
+  if (!p)
+    return NULL;
+  if (!mapped) {
+    MMU_SetSectionAttr(FB_MEM_BASE, FB_MEM_SIZE, (FB_MEM_CACHE << 2) | MMU_ATTRIB_RW | MMU_ATTRIB_DOM0 | MMU_ATTRIB_SEC);
+    mapped = 1;
+  }
+  if (fb_f1c100s_alloc(pdat, p) != 0)
+    return NULL;
+  return p;
+}
+
+fb_panel_t const* fb_f1c100s_get_panel(void)
+{
+  if (!fb_f1c100s_priv_object.panel)
+    fb_f1c100s_select_panel(NULL);
+  return fb_f1c100s_priv_object.panel;
+}
+
+void fb_f1c100s_get_vsize(int32_t* vwidth, int32_t* vheight)
+{
+  fb_f1c100s_get_panel();
+  *vwidth = fb_f1c100s_priv_object.vwidth;
+  *vheight = fb_f1c100s_priv_object.vheight;
 }
 
 void fb_f1c100s_init(framebuffer_t* fb)
@@ -419,28 +1078,25 @@ void fb_f1c100s_init(framebuffer_t* fb)
   pdat->rstdefe = 46;
   pdat->rstdebe = 44;
   pdat->rsttcon = 36;
-  pdat->width = FB_LCD_XSIZE;
-  pdat->height = FB_LCD_YSIZE;
-  pdat->pwidth = 216;
-  pdat->pheight = 135;
-  pdat->bits_per_pixel = 18;
-  pdat->bytes_per_pixel = 4;
+  fb_f1c100s_get_panel();
   pdat->index = 0;
-  pdat->vram[0] = fb_mem[0];
-  pdat->vram[1] = fb_mem[1];
-
-  pdat->timing.pixel_clock_hz = 12000000;
-  pdat->timing.h_front_porch = 40;
-  pdat->timing.h_back_porch = 87;
-  pdat->timing.h_sync_len = 1;
-  pdat->timing.v_front_porch = 13;
-  pdat->timing.v_back_porch = 31;
-  pdat->timing.v_sync_len = 1;
-  pdat->timing.h_sync_active = false;
-  pdat->timing.v_sync_active = false;
-  pdat->timing.den_active = false;
-  pdat->timing.clk_active = false;
+  pdat->base = pdat->splash ? pdat->splash : pdat->vram[0];
+  pdat->xorg = 0;
+  pdat->yorg = 0;
+  pdat->ovl_x = 0;
+  pdat->ovl_y = 0;
+  pdat->ovl_on = 1;
+  pdat->ovl_key = 0;
+  pdat->key_min = 0;
+  pdat->key_max = 0;
+  CSC_Identity(&pdat->csc);
+  pdat->csc_en = 0;
+  pdat->next.flags = 0;
+  pdat->ncb = 0;
+  pdat->nload = 0;
+  pdat->refresh_div = 1;
   pdat->backlight = &led_pwm_bl;
+  fb_panel_check_budget(pdat->panel, pdat->bytes_per_pixel, pdat->ovl != NULL);
 
   fb->name = "fb-f1c100s";
   fb->width = pdat->width;
@@ -459,20 +1115,25 @@ void fb_f1c100s_init(framebuffer_t* fb)
     reset_f1c100s_deassert(&reset_2, pdat->rstdebe - reset_2.base);
   if (pdat->rsttcon >= 0)
     reset_f1c100s_deassert(&reset_2, pdat->rsttcon - reset_2.base);
-  for (i = 0x0800; i < 0x1000; i += 4)
-    write32(pdat->virtdebe + i, 0);
-  fb_f1c100s_init_hw(pdat);
-  f1c100s_debe_set_address(pdat, pdat->vram[0]);
+  if (pdat->splash) {
+    fb_f1c100s_takeover_hw(pdat);
+  } else {
+    for (i = 0x0800; i < 0x1000; i += 4)
+      write32(pdat->virtdebe + i, 0);
+    fb_f1c100s_init_hw(pdat);
+  }
+  f1c100s_debe_set_address(pdat, pdat->base);
+  f1c100s_debe_load(pdat);
 }
 
 void* fb_f1c100s_get_vram1(void)
 {
-  return fb_mem[0];
+  return fb_f1c100s_get_panel() ? fb_f1c100s_priv_object.vram[0] : NULL;
 }
 
 void* fb_f1c100s_get_vram2(void)
 {
-  return fb_mem[1];
+  return fb_f1c100s_get_panel() ? fb_f1c100s_priv_object.vram[1] : NULL;
 }
 
 void fb_f1c100s_remove(framebuffer_t* fb)
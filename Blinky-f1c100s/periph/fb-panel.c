@@ -0,0 +1,111 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include <stdio.h>
+#include <string.h>
+#include "framebuffer.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// ʱһΪȱʡʱȡPLL_VIDEO(198MHz)Ƶ
+// TCONȡƵʵʱӻȱֵߣʼʱӡʵʱӡ
+////////////////////////////////////////////////////////////////////////////////
+static fb_panel_t const fb_panels[] = {
+  {
+    .name = "480x272",          // 4.3
+    .width = 480, .height = 272, .pwidth = 216, .pheight = 135,
+    .bits_per_pixel = 18, .pixel_clock_hz = 12000000,
+    .h_front_porch = 40, .h_back_porch = 87, .h_sync_len = 1,
+    .v_front_porch = 13, .v_back_porch = 31, .v_sync_len = 1,
+  },
+  {
+    .name = "800x480",          // 5/7磬AT070TN92һ
+    .width = 800, .height = 480, .pwidth = 154, .pheight = 86,
+    .bits_per_pixel = 18, .pixel_clock_hz = 33000000,
+    .h_front_porch = 210, .h_back_porch = 45, .h_sync_len = 1,
+    .v_front_porch = 22, .v_back_porch = 22, .v_sync_len = 1,
+  },
+  {
+    .name = "1024x600",         // 7磬EK79001һ
+    .width = 1024, .height = 600, .pwidth = 154, .pheight = 86,
+    .bits_per_pixel = 18, .pixel_clock_hz = 49500000,
+    .h_front_porch = 160, .h_back_porch = 140, .h_sync_len = 20,
+    .v_front_porch = 12, .v_back_porch = 20, .v_sync_len = 3,
+  },
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: fb_panel_find
+//|  |: ֲʱ
+//|          |:
+//| б |: name: "800x480"NULLȡȱʡ
+//|          |:
+//|      |: ҲʱNULL
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+fb_panel_t const* fb_panel_find(char const* name)
+{
+  unsigned i;
+
+  if (name == NULL)
+    return &fb_panels[0];
+  for (i = 0; i < sizeof(fb_panels) / sizeof(fb_panels[0]); i++) {
+    if (!strcmp(fb_panels[i].name, name))
+      return &fb_panels[i];
+  }
+  return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: fb_panel_hz
+//|  |: ȫˢ(Hz)
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+uint32_t fb_panel_hz(fb_panel_t const* p)
+{
+  uint32_t htotal, vtotal;
+
+  htotal = p->width + p->h_front_porch + p->h_back_porch + p->h_sync_len;
+  vtotal = p->height + p->v_front_porch + p->v_back_porch + p->v_sync_len;
+  return (uint32_t)p->pixel_clock_hz / (htotal * vtotal);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: fb_panel_check_budget
+//|  |: ʾռõDRAMFB_DRAM_MBPSʱӡ
+//|          |:
+//| б |: bytes_per_pixel: layer0ÿֽ
+//|          |: overlay: 0ʾlayer1(ARGB8888)Ҳɨ
+//|          |:
+//|      |: ռFB_DRAM_MBPSİٷֱ
+//|          |:
+//| עϢ |: ɨ =  x  x ֽ x ˢʣGUIÿFB_GUI_FPSȫػ
+//|          |: ÿλ洢豸ش洢豸дԴ湲3ơ
+////////////////////////////////////////////////////////////////////////////////
+int32_t fb_panel_check_budget(fb_panel_t const* p, int32_t bytes_per_pixel, int32_t overlay)
+{
+  uint32_t frame, scan, gui, pct;
+
+  frame = (uint32_t)(p->width * p->height);
+  scan = frame * (bytes_per_pixel + (overlay ? 4 : 0)) / 1000 * fb_panel_hz(p) / 1000;
+  gui = frame * bytes_per_pixel / 1000 * 3 * FB_GUI_FPS / 1000;
+  pct = (scan + gui) * 100 / FB_DRAM_MBPS;
+  if (pct > 100) {
+    printf("fb: WARNING %s@%uHz %ubpp needs %uMB/s scanout + %uMB/s GUI, "
+           "%u%% of the %uMB/s DRAM budget\n",
+           p->name, (unsigned)fb_panel_hz(p), (unsigned)(bytes_per_pixel * 8),
+           (unsigned)scan, (unsigned)gui, (unsigned)pct, (unsigned)FB_DRAM_MBPS);
+  }
+  return (int32_t)pct;
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,44 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __FB_CSC_H__
+#define __FB_CSC_H__
+////////////////////////////////////////////////////////////////////////////////
+// ʾɫ(DEBE output color correction)Ķ㣬Ӳ
+// ̼ɼĴֵ˷͹CSC_Apply()ץ֡ͬ㡣
+//
+//  = m[i][0]*R + m[i][1]*G + m[i][2]*B + m[i][3]i = 0/1/2 Ӧ R/G/B
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+#define CSC_ONE         (1 << 10)   // ϵ1.0ĴΪ13λ
+#define CSC_OFS_ONE     (1 << 4)    // ƫ1ҶȼĴΪ14λ
+
+#define CSC_COEF_MIN    (-4096)
+#define CSC_COEF_MAX    (4095)
+#define CSC_OFS_MIN     (-8192)
+#define CSC_OFS_MAX     (8191)
+
+typedef struct {
+  int32_t m[3][4];
+} ColorMatrixType;
+
+void CSC_Identity(ColorMatrixType* cm);
+int  CSC_IsIdentity(ColorMatrixType const* cm);
+void CSC_Adjust(ColorMatrixType* cm, int32_t brightness, int32_t contrast, int32_t saturation);
+void CSC_Tint(ColorMatrixType* cm, int32_t r, int32_t g, int32_t b);
+void CSC_Fade(ColorMatrixType* cm, int32_t level);
+void CSC_Apply(ColorMatrixType const* cm, uint32_t* pixels, uint32_t count);
+
+/* <LCDConf.c>ļ */
+void LCDCONF_SetColorMatrix(ColorMatrixType const* cm);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __FB_CSC_H__ */
@@ -6,6 +6,134 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include "fb-csc.h"
+
+/* Panel used when none was selected at boot, see fb_panels[] in fb-panel.c */
+#ifndef FB_PANEL
+#define FB_PANEL        "480x272"
+#endif
+
+/* Virtual screen in panel sizes, the panel shows a window of it at the origin */
+#ifndef FB_VIRT_XPAGES
+#define FB_VIRT_XPAGES  (1)
+#endif
+#ifndef FB_VIRT_YPAGES
+#define FB_VIRT_YPAGES  (2)
+#endif
+
+/* DRAM region the framebuffers are allocated from, ER_FBMEM in F1C100s.sct */
+#ifndef FB_MEM_BASE
+#define FB_MEM_BASE     (0x81800000)
+#endif
+#ifndef FB_MEM_SIZE
+#define FB_MEM_SIZE     (0x00800000)
+#endif
+
+/* Cache policy of that region: 0 uncached, 1 buffered, 2 write-through, 3 write-back */
+#ifndef FB_MEM_CACHE
+#define FB_MEM_CACHE    (2)
+#endif
+
+/* Sustainable 16-bit DDR throughput (624MB/s peak at 156MHz) in MB/s */
+#ifndef FB_DRAM_MBPS
+#define FB_DRAM_MBPS    (370)
+#endif
+
+/* Full screen GUI redraws per second assumed by the bandwidth budget */
+#ifndef FB_GUI_FPS
+#define FB_GUI_FPS      (30)
+#endif
+
+/* Layer0 framebuffers, 1 when the GUI races the beam instead of flipping */
+#ifndef FB_NUM_BUFFERS
+#define FB_NUM_BUFFERS  (2)
+#endif
+
+/* Layer0 pixel depth: 32 (XRGB8888) or 8 (index into the DEBE palette) */
+#ifndef FB_LAYER0_BPP
+#define FB_LAYER0_BPP   (32)
+#endif
+
+/* Layer1 overlay: panel sized ARGB8888, blended over layer0 by pixel alpha */
+#ifndef FB_OVERLAY_EN
+#define FB_OVERLAY_EN   (0)
+#endif
+
+/* Largest dot clock divider of the refresh governor, 4 gives 15Hz */
+#ifndef FB_REFRESH_DIV_MAX
+#define FB_REFRESH_DIV_MAX  (4)
+#endif
+
+/* Flags returned by fb_f1c100s_irq_ack() */
+#define FB_IRQ_VBLANK   (1 << 15)
+#define FB_IRQ_LINE     (1 << 13)
+
+/* Fields of fb_state_t staged by a commit */
+#define FB_STATE_BASE     (1 << 0)
+#define FB_STATE_ORIGIN   (1 << 1)
+#define FB_STATE_OVL_SHOW (1 << 2)
+#define FB_STATE_OVL_POS  (1 << 3)
+#define FB_STATE_OVL_KEY  (1 << 4)
+#define FB_STATE_CSC      (1 << 5)
+
+/* Completion callbacks that may wait for the same vblank */
+#ifndef FB_COMMIT_CB_MAX
+#define FB_COMMIT_CB_MAX  (4)
+#endif
+
+/* Called from the frame interrupt once a commit is latched */
+typedef void (*fb_commit_cb_t)(void* arg);
+
+/*
+ * Display state transaction, see fb_f1c100s_begin() and fb_f1c100s_commit().
+ * Only the fields named in @flags are applied, all of them in one vblank.
+ */
+typedef struct {
+  uint32_t flags;             /* FB_STATE_xxx */
+  void* base;                 /* layer0 virtual screen */
+  int32_t xorg, yorg;         /* panel window in the virtual screen */
+  int32_t ovl_on;
+  int32_t ovl_x, ovl_y;       /* overlay position, may be partly off screen */
+  int32_t key_on;
+  uint32_t key_min, key_max;  /* 0x00RRGGBB, inclusive per channel */
+  int32_t csc_en;             /* 0 bypasses the output color matrix */
+  ColorMatrixType csc;
+} fb_state_t;
+
+/* Scanout timing, for estimating the beam position between interrupts */
+typedef struct {
+  int32_t vtotal;       /* lines per frame, blanking included */
+  int32_t vstart;       /* lines from the vblank irq to active line 0 */
+  uint32_t line_ns;     /* line period in nanoseconds */
+} fb_scan_t;
+
+/* Panel timing */
+typedef struct {
+  char const* name;
+  int32_t width, height;      /* in pixel */
+  int32_t pwidth, pheight;    /* in millimeter */
+  int32_t bits_per_pixel;     /* RGB bus width: 16, 18 or 24 */
+  int32_t pixel_clock_hz;
+  int32_t h_front_porch;
+  int32_t h_back_porch;
+  int32_t h_sync_len;
+  int32_t v_front_porch;
+  int32_t v_back_porch;
+  int32_t v_sync_len;
+  int32_t h_sync_active;
+  int32_t v_sync_active;
+  int32_t den_active;
+  int32_t clk_active;
+} fb_panel_t;
+
+/* Refresh governor report, see LCDCONF_GetRefreshStats() */
+typedef struct {
+  int32_t hz;             /* current refresh rate */
+  int32_t div;            /* current dot clock divider, 1 at full rate */
+  uint32_t frames;        /* frames scanned out since init */
+  uint32_t saved_frames;  /* full rate frames that were not scanned out */
+  uint32_t frame_bytes;   /* DRAM bytes read by DEBE per frame */
+} fb_refresh_stats_t;
 
 typedef struct framebuffer_st {
   /* Framebuffer name */
@@ -24,6 +152,18 @@ typedef struct framebuffer_st {
   void* priv;
 } framebuffer_t;
 
+fb_panel_t const* fb_panel_find(char const* name);
+
+uint32_t fb_panel_hz(fb_panel_t const* p);
+
+int32_t fb_panel_check_budget(fb_panel_t const* p, int32_t bytes_per_pixel, int32_t overlay);
+
+fb_panel_t const* fb_f1c100s_select_panel(char const* name);
+
+fb_panel_t const* fb_f1c100s_get_panel(void);
+
+void    fb_f1c100s_get_vsize(int32_t* vwidth, int32_t* vheight);
+
 void    fb_f1c100s_setbl(framebuffer_t* fb, int32_t brightness);
 
 int32_t fb_f1c100s_getbl(framebuffer_t* fb);
@@ -42,6 +182,55 @@ void*   fb_f1c100s_get_vram2(void);
 
 void    fb_f1c100s_present(framebuffer_t* fb, int index);
 
+void    fb_f1c100s_set_vram(framebuffer_t* fb, void* vram);
+
+void    fb_f1c100s_set_origin(framebuffer_t* fb, int32_t x, int32_t y);
+
+void    fb_f1c100s_vsync(framebuffer_t* fb);
+
+void    fb_f1c100s_begin(framebuffer_t* fb, fb_state_t* st);
+
+int32_t fb_f1c100s_commit(framebuffer_t* fb, fb_state_t const* st, fb_commit_cb_t cb, void* arg);
+
+int32_t fb_f1c100s_commit_pending(framebuffer_t* fb);
+
+void*   fb_f1c100s_get_splash(void);
+
+void    fb_f1c100s_end_splash(framebuffer_t* fb);
+
+void    fb_f1c100s_set_palette(framebuffer_t* fb, int32_t index, uint32_t argb);
+
+void*   fb_f1c100s_get_overlay(void);
+
+void    fb_f1c100s_overlay_show(framebuffer_t* fb, int32_t on);
+
+void    fb_f1c100s_overlay_move(framebuffer_t* fb, int32_t x, int32_t y);
+
+void    fb_f1c100s_overlay_colorkey(framebuffer_t* fb, uint32_t min, uint32_t max);
+
+void    fb_f1c100s_overlay_colorkey_enable(framebuffer_t* fb, int32_t on);
+
+void    fb_f1c100s_set_csc(framebuffer_t* fb, ColorMatrixType const* cm);
+
+uint32_t fb_f1c100s_irq_ack(framebuffer_t* fb);
+
+void    fb_f1c100s_set_line_irq(framebuffer_t* fb, int32_t line);
+
+void    fb_f1c100s_get_scan(framebuffer_t* fb, fb_scan_t* scan);
+
+int32_t fb_f1c100s_set_refresh_div(framebuffer_t* fb, int32_t div);
+
+/* Refresh governor, in LCDConf.c */
+void    LCDCONF_Invalidate(void);
+
+void    LCDCONF_GetRefreshStats(fb_refresh_stats_t* stats);
+
+void    LCDCONF_ReportRefresh(void);
+
+framebuffer_t* LCDCONF_GetFramebuffer(void);
+
+void    LCDCONF_EndSplash(void);
+
 #ifdef __cplusplus
 }
 #endif
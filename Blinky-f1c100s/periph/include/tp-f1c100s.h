@@ -0,0 +1,31 @@
+#ifndef __TP_F1C100S_H__
+#define __TP_F1C100S_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define F1C100S_TP_BASE   (0x01c24800)
+
+/* event bits returned by tp_f1c100s_get_event() */
+#define TP_EVENT_DATA     (1 << 0)
+#define TP_EVENT_UP       (1 << 1)
+#define TP_EVENT_DOWN     (1 << 2)
+
+typedef struct {
+  uint32_t virt;
+  int32_t sensitive;    /* 0..15, higher is more sensitive */
+  int32_t ignore_data;  /* the first sample after pen-up is unreliable */
+} tp_f1c100s_t;
+
+void     tp_f1c100s_init(tp_f1c100s_t* tp);
+void     tp_f1c100s_exit(tp_f1c100s_t* tp);
+uint32_t tp_f1c100s_get_event(tp_f1c100s_t* tp, uint16_t* x, uint16_t* y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TP_F1C100S_H__ */
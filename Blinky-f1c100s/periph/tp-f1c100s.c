@@ -0,0 +1,82 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "tp-f1c100s.h"
+#include "io.h"
+
+#define TP_CTRL0        (0x00)
+#define TP_CTRL1        (0x04)
+#define TP_CTRL2        (0x08)
+#define TP_CTRL3        (0x0c)
+#define TP_INT_FIFOC    (0x10)
+#define TP_INT_FIFOS    (0x14)
+#define TP_DATA         (0x24)
+
+/* TP_INT_FIFOS */
+#define FIFO_DATA_PENDING (1 << 16)
+#define TP_UP_PENDING     (1 << 1)
+#define TP_DOWN_PENDING   (1 << 0)
+
+/*
+* ʼģʽӲֵ˲FIFOÿյһXYж
+* @tp: 
+* @return: none
+*/
+void tp_f1c100s_init(tp_f1c100s_t* tp)
+{
+  // ADCʱ=24M/6=4Mhz=4M/2^13Լ488Hzɼʱ63ADCʱ
+  write32(tp->virt + TP_CTRL0, (0 << 22) | (2 << 20) | (7 << 16) | (63 << 0));
+  // ȣģʽ0()
+  write32(tp->virt + TP_CTRL2, ((tp->sensitive & 0xf) << 28) | (0 << 26));
+  // Ӳ˲ʹܣֵ˲Ϊ5
+  write32(tp->virt + TP_CTRL3, (1 << 2) | (1 << 0));
+  // ̧ȥʹܣģʽ
+  write32(tp->virt + TP_CTRL1, (5 << 12) | (1 << 9) | (1 << 4));
+  // жϡ̧/жϣFIFOΪ1FIFO
+  write32(tp->virt + TP_INT_FIFOC, (1 << 16) | (1 << 8) | (1 << 4) | (1 << 1) | (1 << 0));
+  tp->ignore_data = 0;
+}
+
+/*
+* رյж
+* @tp: 
+* @return: none
+*/
+void tp_f1c100s_exit(tp_f1c100s_t* tp)
+{
+  write32(tp->virt + TP_INT_FIFOC, 0);
+  write32(tp->virt + TP_CTRL1, 0);
+}
+
+/*
+* TPжãӦй¼
+* @tp: 
+* @x/@y: ԭʼADCֵ(TP_EVENT_DATAʱЧ)
+* @return: TP_EVENT_xxx
+*/
+uint32_t tp_f1c100s_get_event(tp_f1c100s_t* tp, uint16_t* x, uint16_t* y)
+{
+  uint32_t sta = read32(tp->virt + TP_INT_FIFOS);
+  uint32_t evt = 0;
+  uint32_t vx, vy;
+
+  if (sta & FIFO_DATA_PENDING) {
+    vx = read32(tp->virt + TP_DATA);
+    vy = read32(tp->virt + TP_DATA);
+    if (tp->ignore_data) {
+      tp->ignore_data = 0;
+    } else {
+      *x = (uint16_t)(vx & 0xfff);
+      *y = (uint16_t)(vy & 0xfff);
+      evt |= TP_EVENT_DATA;
+    }
+  }
+  if (sta & TP_DOWN_PENDING) {
+    evt |= TP_EVENT_DOWN;
+  }
+  if (sta & TP_UP_PENDING) {
+    tp->ignore_data = 1;
+    evt |= TP_EVENT_UP;
+  }
+  write32(tp->virt + TP_INT_FIFOS, sta);
+  return evt;
+}
@@ -37,10 +37,13 @@ Licensed platform:        ARM7/9, Cortex-M/R4
 Licensed number of seats: -
 ----------------------------------------------------------------------
 File        : LCDConf.c
-Purpose     : Display controller configuration (single layer)
+Purpose     : Display controller configuration (base layer + overlay)
 ---------------------------END-OF-HEADER------------------------------
 */
 
+#include <stdio.h>
+#include <string.h>
+#include "RTL.h"
 #include "GUI.h"
 #include "GUIDRV_Lin.h"
 #include "framebuffer.h"
@@ -49,6 +52,7 @@ Purpose     : Display controller configuration (single layer)
 #include "target.h"
 #include "mmu.h"
 #include "io.h"
+#include "ftrace.h"
 
 /*********************************************************************
 *
@@ -57,20 +61,70 @@ Purpose     : Display controller configuration (single layer)
 **********************************************************************
 */
 //
-// Physical display size
+// Physical and virtual display size, taken from the panel selected at
+// boot by fb_f1c100s_select_panel(). The virtual display is panned by
+// _SetOrg() without copying.
 //
-#define XSIZE_PHYS  (480)
-#define YSIZE_PHYS  (272)
+#define XSIZE_PHYS  (_xSize)
+#define YSIZE_PHYS  (_ySize)
+#define VXSIZE_PHYS (_vxSize)
+#define VYSIZE_PHYS (_vySize)
 
 //
 // Color conversion
 //
-#define COLOR_CONVERSION GUICC_8888
+#if (FB_LAYER0_BPP == 8)
+  #define COLOR_CONVERSION GUICC_8666
+#else
+  #define COLOR_CONVERSION GUICC_8888
+#endif
 
 //
 // Display driver
 //
-#define DISPLAY_DRIVER GUIDRV_LIN_32
+#if (FB_LAYER0_BPP == 8)
+  #define DISPLAY_DRIVER GUIDRV_LIN_8
+#else
+  #define DISPLAY_DRIVER GUIDRV_LIN_32
+#endif
+
+//
+// Overlay layer, ARGB with inverted alpha (0xFF = opaque) as DEBE expects
+//
+#if FB_OVERLAY_EN
+  #define COLOR_CONVERSION_1 GUICC_M8888I
+  #define DISPLAY_DRIVER_1   GUIDRV_LIN_32
+#endif
+
+//
+// Beam racing: with a single buffer, memory device copies to the display
+// are split into strips and each strip is written only where the beam
+// has already passed, so the output does not tear without a back buffer
+//
+#ifndef   BEAM_RACE_EN
+  #define BEAM_RACE_EN   ((FB_NUM_BUFFERS == 1) && (FB_LAYER0_BPP == 32))
+#endif
+#define BEAM_STRIP       (16)        // Lines copied per beam check
+#define BEAM_EVT         (0x8000)    // Event flag of the waiting GUI task
+#define BEAM_OFF         (-0x8000)   // _GetScanLine() while the display is off
+
+//
+// Refresh governor: after REFRESH_IDLE vertical blanks without a display
+// update the dot clock is halved, down to 1/FB_REFRESH_DIV_MAX, so a static
+// screen costs less DRAM bandwidth. The next update or touch restores the
+// full rate. Updates are display driver commands, memory device copies
+// and LCDCONF_Invalidate() calls; direct drawing is not seen.
+//
+#ifndef   REFRESH_GOV_EN
+  #define REFRESH_GOV_EN (1)
+#endif
+#define REFRESH_IDLE     (60)        // Idle vblanks before each halving
+
+//
+// Memory device copies go through _DrawBitmap32bpp() for beam racing
+// and for waking up the refresh governor
+//
+#define DRAWBMP_HOOK_EN  ((BEAM_RACE_EN || REFRESH_GOV_EN) && (FB_LAYER0_BPP == 32))
 
 /*********************************************************************
 *
@@ -78,20 +132,36 @@ Purpose     : Display controller configuration (single layer)
 *
 **********************************************************************
 */
-#ifndef   XSIZE_PHYS
-#error Physical X size of display is not defined!
-#endif
-#ifndef   YSIZE_PHYS
-#error Physical Y size of display is not defined!
-#endif
 #ifndef   COLOR_CONVERSION
 #error Color conversion not defined!
 #endif
 #ifndef   DISPLAY_DRIVER
 #error No display driver defined!
 #endif
+#if BEAM_RACE_EN && (FB_LAYER0_BPP != 32)
+#error Beam racing needs a 32bpp layer 0!
+#endif
 
 static framebuffer_t fb_f1c100s;
+static int32_t _xSize, _ySize;
+static int32_t _vxSize, _vySize;
+
+#if BEAM_RACE_EN
+static fb_scan_t _Scan;
+static volatile U32 _VBlankStamp;
+static OS_TID volatile _BeamTask;
+#endif
+#if DRAWBMP_HOOK_EN
+static U32* _pVRAM;
+static int _yOrg;
+#endif
+#if REFRESH_GOV_EN
+static volatile int _RefreshDiv = 1;
+static volatile int _Invalid;
+static int _IdleFrames;
+static volatile U32 _Frames;
+static volatile U32 _SavedFrames;
+#endif
 
 /*********************************************************************
 *
@@ -99,10 +169,178 @@ static framebuffer_t fb_f1c100s;
 *
 **********************************************************************
 */
+#if REFRESH_GOV_EN
+/*********************************************************************
+*
+*       _SetRefreshDiv
+*
+* Purpose:
+*   Changes the dot clock divider, the beam estimate follows it
+*/
+static void _SetRefreshDiv(int Div)
+{
+  _RefreshDiv = fb_f1c100s_set_refresh_div(&fb_f1c100s, Div);
+#if BEAM_RACE_EN
+  fb_f1c100s_get_scan(&fb_f1c100s, &_Scan);
+#endif
+}
+
+/*********************************************************************
+*
+*       _RefreshGovernor
+*
+* Purpose:
+*   Called every vertical blank, slows the refresh down step by step
+*   while nothing is updated. The frame that just ended took _RefreshDiv
+*   full rate frame times, all but one of them were not scanned out.
+*/
+static void _RefreshGovernor(void)
+{
+  _Frames++;
+  _SavedFrames += _RefreshDiv - 1;
+  if (_Invalid) {
+    _Invalid = 0;
+    _IdleFrames = 0;
+    return;
+  }
+  if ((++_IdleFrames < REFRESH_IDLE) || (_RefreshDiv >= FB_REFRESH_DIV_MAX)) {
+    return;
+  }
+  _IdleFrames = 0;
+  _SetRefreshDiv(_RefreshDiv * 2);
+}
+#endif
+
 static void lcd_frame_irq(void)
 {
-  write32(F1C100S_TCON_BASE + 0x04, (1U << 31));
-  MMU_TestCleanDCache();
+  U32 irqs;
+
+  irqs = fb_f1c100s_irq_ack(&fb_f1c100s);
+  if (irqs & FB_IRQ_VBLANK) {
+    TRACE0(TRC_LCD_VBLANK);
+#if BEAM_RACE_EN
+    _VBlankStamp = target_hrt_read();
+#endif
+#if REFRESH_GOV_EN
+    _RefreshGovernor();
+#endif
+    fb_f1c100s_vsync(&fb_f1c100s);
+    MMU_TestCleanDCache();
+  }
+#if BEAM_RACE_EN
+  if (_BeamTask) {
+    isr_evt_set(BEAM_EVT, _BeamTask);
+  }
+#endif
+}
+
+#if BEAM_RACE_EN
+/*********************************************************************
+*
+*       _GetScanLine
+*
+* Purpose:
+*   Estimates the active line being scanned out from the time since the
+*   last vertical blank, negative while in vertical blanking, BEAM_OFF
+*   when there is no beam to race
+*/
+static int _GetScanLine(void)
+{
+  U32 t, Line;
+
+  t = target_hrt_read() - _VBlankStamp;
+  if (t >= TARGET_HRT_FREQ) {
+    return BEAM_OFF;  // No vblank for a second, the display is off
+  }
+  Line = TARGET_HRT_US(t) * 1000 / _Scan.line_ns;
+  Line %= (U32)_Scan.vtotal;
+  return (int)Line - _Scan.vstart;
+}
+
+/*********************************************************************
+*
+*       _WaitBeam
+*
+* Purpose:
+*   Waits until lines y0..y1-1 can be written without tearing: the beam
+*   has passed them in this frame, or is far enough above them that the
+*   copy finishes first. Sleeps on the TCON line interrupt meanwhile.
+*   Returns at once while the display is off, nothing can tear then.
+*/
+static void _WaitBeam(int y0, int y1)
+{
+  int Line;
+
+  for (;;) {
+    Line = _GetScanLine();
+    if ((Line == BEAM_OFF) || (Line >= y1) || (Line < y0 - (y1 - y0))) {
+      return;
+    }
+    os_evt_clr(BEAM_EVT, os_tsk_self());
+    _BeamTask = os_tsk_self();
+    fb_f1c100s_set_line_irq(&fb_f1c100s, y1);  // The last strip waits for vblank
+    os_evt_wait_or(BEAM_EVT, 2);
+    _BeamTask = 0;
+    fb_f1c100s_set_line_irq(&fb_f1c100s, -1);
+  }
+}
+#endif
+
+#if DRAWBMP_HOOK_EN
+
+/*********************************************************************
+*
+*       _DrawBitmap32bpp
+*
+* Purpose:
+*   Custom routine for LCD_DEVFUNC_DRAWBMP_32BPP, used by the window
+*   manager when memory devices are copied to the display. With beam
+*   racing it copies strip by strip behind the beam and cleans the cache
+*   of each strip.
+*/
+static void _DrawBitmap32bpp(int LayerIndex, int x, int y, U32 const* p, int xSize, int ySize, int BytesPerLine)
+{
+  U32* pDst;
+  int i, j, n;
+#if BEAM_RACE_EN
+  U32 Addr;
+  int sy;
+#endif
+
+  (void)LayerIndex;
+  LCDCONF_Invalidate();
+  for (i = 0; i < ySize; i += n) {
+    n = (ySize - i < BEAM_STRIP) ? ySize - i : BEAM_STRIP;
+#if BEAM_RACE_EN
+    sy = y + i - _yOrg;
+    if ((sy + n > 0) && (sy < YSIZE_PHYS)) {
+      _WaitBeam((sy < 0) ? 0 : sy, (sy + n > YSIZE_PHYS) ? YSIZE_PHYS : sy + n);
+    }
+#endif
+    for (j = 0; j < n; j++) {
+      pDst = _pVRAM + (y + i + j) * VXSIZE_PHYS + x;
+      memcpy(pDst, (U8 const*)p + (i + j) * BytesPerLine, xSize * 4);
+#if BEAM_RACE_EN
+      Addr = (U32)pDst & ~(CACHE_ALIGN - 1);
+      MMU_CleanDCacheArray(Addr, (U32)(pDst + xSize) - Addr);
+#endif
+    }
+  }
+}
+#endif
+
+/*********************************************************************
+*
+*       _Color2RGB
+*
+* Purpose:
+*   LCD_COLOR is 0xBBGGRR, the DEBE palette and color key use 0xRRGGBB
+*/
+static U32 _Color2RGB(LCD_COLOR Color)
+{
+  return ((Color & 0x0000FF) << 16)
+       |  (Color & 0x00FF00)
+       | ((Color & 0xFF0000) >> 16);
 }
 
 /*********************************************************************
@@ -114,8 +352,17 @@ static void lcd_frame_irq(void)
 */
 static void _InitController(void)
 {
+  //
+  // The beam estimate and the GUI statistics time with TIMER1, which
+  // otherwise only runs when the task monitor or the trace is enabled
+  //
+  target_hrt_setup();
   f1c100s_intc_set_isr(F1C100S_IRQ_LCD, lcd_frame_irq);
   fb_f1c100s_init(&fb_f1c100s);
+#if BEAM_RACE_EN
+  fb_f1c100s_get_scan(&fb_f1c100s, &_Scan);
+  _VBlankStamp = target_hrt_read();
+#endif
   fb_f1c100s_present(&fb_f1c100s, 0);
   fb_f1c100s_setbl(&fb_f1c100s, 100);
   write32(F1C100S_TCON_BASE + 0x04, (1U << 31));
@@ -131,7 +378,10 @@ static void _InitController(void)
 */
 static void _SetVRAMAddr(void* pVRAM)
 {
-
+#if DRAWBMP_HOOK_EN
+  _pVRAM = (U32*)pVRAM;
+#endif
+  fb_f1c100s_set_vram(&fb_f1c100s, pVRAM);
 }
 
 /*********************************************************************
@@ -140,11 +390,15 @@ static void _SetVRAMAddr(void* pVRAM)
 *
 * Purpose:
 *   Should set the origin of the display typically by modifying the
-*   frame buffer base address register
+*   frame buffer base address register. The new address is latched
+*   by lcd_frame_irq(), so panning never tears mid-frame.
 */
 static void _SetOrg(int xPos, int yPos)
 {
-  /* TBD by customer */
+#if DRAWBMP_HOOK_EN
+  _yOrg = yPos;
+#endif
+  fb_f1c100s_set_origin(&fb_f1c100s, xPos, yPos);
 }
 
 /*********************************************************************
@@ -156,7 +410,7 @@ static void _SetOrg(int xPos, int yPos)
 */
 static void _SetLUTEntry(LCD_COLOR Color, U8 Pos)
 {
-  /* TBD by customer */
+  fb_f1c100s_set_palette(&fb_f1c100s, Pos, 0xFF000000 | _Color2RGB(Color));
 }
 /*********************************************************************
 *
@@ -175,6 +429,15 @@ static void _SetLUTEntry(LCD_COLOR Color, U8 Pos)
 */
 void LCD_X_Config(void)
 {
+  fb_panel_t const* pPanel;
+
+  //
+  // Panel and framebuffer sizes
+  //
+  pPanel = fb_f1c100s_get_panel();
+  _xSize = pPanel->width;
+  _ySize = pPanel->height;
+  fb_f1c100s_get_vsize(&_vxSize, &_vySize);
   //
   // Set display driver and color conversion for 1st layer
   //
@@ -184,18 +447,145 @@ void LCD_X_Config(void)
   //
   if (LCD_GetSwapXY()) {
     LCD_SetSizeEx(0, YSIZE_PHYS, XSIZE_PHYS);
-    LCD_SetVSizeEx(0, YSIZE_PHYS, XSIZE_PHYS);
+    LCD_SetVSizeEx(0, VYSIZE_PHYS, VXSIZE_PHYS);
   } else {
     LCD_SetSizeEx(0, XSIZE_PHYS, YSIZE_PHYS);
-    LCD_SetVSizeEx(0, XSIZE_PHYS, YSIZE_PHYS);
+    LCD_SetVSizeEx(0, VXSIZE_PHYS, VYSIZE_PHYS);
   }
   LCD_SetVRAMAddrEx(0, (void*)fb_f1c100s_get_vram1());
+#if DRAWBMP_HOOK_EN
+  _pVRAM = (U32*)fb_f1c100s_get_vram1();
+  LCD_SetDevFunc(0, LCD_DEVFUNC_DRAWBMP_32BPP, (void(*)(void))_DrawBitmap32bpp);
+#endif
   //
   // Set user palette data (only required if no fixed palette is used)
   //
 #if defined(PALETTE)
   LCD_SetLUTEx(0, PALETTE);
 #endif
+#if FB_OVERLAY_EN
+  //
+  // Overlay layer, always panel sized and not scrollable
+  //
+  GUI_DEVICE_CreateAndLink(DISPLAY_DRIVER_1, COLOR_CONVERSION_1, 0, 1);
+  if (LCD_GetSwapXY()) {
+    LCD_SetSizeEx(1, YSIZE_PHYS, XSIZE_PHYS);
+    LCD_SetVSizeEx(1, YSIZE_PHYS, XSIZE_PHYS);
+  } else {
+    LCD_SetSizeEx(1, XSIZE_PHYS, YSIZE_PHYS);
+    LCD_SetVSizeEx(1, XSIZE_PHYS, YSIZE_PHYS);
+  }
+  LCD_SetVRAMAddrEx(1, fb_f1c100s_get_overlay());
+#endif
+}
+
+/*********************************************************************
+*
+*       LCDCONF_SetColorMatrix
+*
+* Purpose:
+*   Sets the display output color matrix (brightness, contrast, fades,
+*   night mode...), it takes effect at the next vertical blank.
+*   Build the matrix with the CSC_xxx() helpers of fb-csc.h.
+*/
+void LCDCONF_SetColorMatrix(ColorMatrixType const* cm)
+{
+  LCDCONF_Invalidate();
+  fb_f1c100s_set_csc(&fb_f1c100s, cm);
+}
+
+/*********************************************************************
+*
+*       LCDCONF_Invalidate
+*
+* Purpose:
+*   Tells the refresh governor that the display content changes, the
+*   full refresh rate is restored at once. Call it before drawing that
+*   bypasses the display driver, the touch task calls it for input.
+*/
+void LCDCONF_Invalidate(void)
+{
+#if REFRESH_GOV_EN
+  CPU_SR_DECL;
+
+  CPU_ENTER_CRITICAL();
+  _Invalid = 1;
+  if (_RefreshDiv > 1) {
+    _SetRefreshDiv(1);
+  }
+  CPU_EXIT_CRITICAL();
+#endif
+}
+
+/*********************************************************************
+*
+*       LCDCONF_GetRefreshStats
+*
+* Purpose:
+*   Returns the current refresh rate and the scanout bandwidth saved
+*   by the refresh governor (layer 0 only)
+*/
+void LCDCONF_GetRefreshStats(fb_refresh_stats_t* stats)
+{
+  fb_scan_t Scan;
+
+  fb_f1c100s_get_scan(&fb_f1c100s, &Scan);
+  stats->hz = (int32_t)(1000000000UL / (Scan.line_ns * (U32)Scan.vtotal));
+#if REFRESH_GOV_EN
+  stats->div = _RefreshDiv;
+  stats->frames = _Frames;
+  stats->saved_frames = _SavedFrames;
+#else
+  stats->div = 1;
+  stats->frames = 0;
+  stats->saved_frames = 0;
+#endif
+  stats->frame_bytes = XSIZE_PHYS * YSIZE_PHYS * (FB_LAYER0_BPP / 8);
+}
+
+/*********************************************************************
+*
+*       LCDCONF_ReportRefresh
+*
+* Purpose:
+*   Prints the refresh governor statistics to stdout
+*/
+void LCDCONF_ReportRefresh(void)
+{
+  fb_refresh_stats_t Stats;
+
+  LCDCONF_GetRefreshStats(&Stats);
+  printf("LCD %dHz (1/%d), %u frames, %u MB DRAM reads saved\n",
+         Stats.hz, Stats.div, Stats.frames,
+         (U32)(((U64)Stats.saved_frames * Stats.frame_bytes) >> 20));
+}
+
+/*********************************************************************
+*
+*       LCDCONF_GetFramebuffer
+*
+* Purpose:
+*   Returns the framebuffer behind layer 0, for services that read the
+*   screen or commit display state (see fb_f1c100s_commit())
+*/
+framebuffer_t* LCDCONF_GetFramebuffer(void)
+{
+  return &fb_f1c100s;
+}
+
+/*********************************************************************
+*
+*       LCDCONF_EndSplash
+*
+* Purpose:
+*   The boot splash of the SPL stays on screen after GUI_Init() until
+*   this is called, the application calls it once its first screen is
+*   drawn. Does nothing when there was no splash.
+*/
+void LCDCONF_EndSplash(void)
+{
+  LCDCONF_Invalidate();
+  fb_f1c100s_end_splash(&fb_f1c100s);
 }
 
 /*********************************************************************
@@ -223,6 +613,9 @@ int LCD_X_DisplayDriver(unsigned LayerIndex, unsigned Cmd, void* pData)
 {
   int r;
 
+  if (Cmd != LCD_X_INITCONTROLLER) {
+    LCDCONF_Invalidate();  // Every other command changes what is shown
+  }
   switch (Cmd) {
     //
     // Required
@@ -234,7 +627,9 @@ int LCD_X_DisplayDriver(unsigned LayerIndex, unsigned Cmd, void* pData)
       // controller is not initialized by any external routine this needs
       // to be adapted by the customer...
       //
-      _InitController();
+      if (LayerIndex == 0) {
+        _InitController();
+      }
       return 0;
     }
     case LCD_X_SETVRAMADDR: {
@@ -244,7 +639,9 @@ int LCD_X_DisplayDriver(unsigned LayerIndex, unsigned Cmd, void* pData)
       //
       LCD_X_SETVRAMADDR_INFO* p;
       p = (LCD_X_SETVRAMADDR_INFO*)pData;
-      _SetVRAMAddr(p->pVRAM);
+      if (LayerIndex == 0) {
+        _SetVRAMAddr(p->pVRAM);
+      }
       return 0;
     }
     case LCD_X_SETORG: {
@@ -253,7 +650,9 @@ int LCD_X_DisplayDriver(unsigned LayerIndex, unsigned Cmd, void* pData)
       //
       LCD_X_SETORG_INFO* p;
       p = (LCD_X_SETORG_INFO*)pData;
-      _SetOrg(p->xPos, p->yPos);
+      if (LayerIndex == 0) {
+        _SetOrg(p->xPos, p->yPos);
+      }
       return 0;
     }
     case LCD_X_SETLUTENTRY: {
@@ -269,15 +668,69 @@ int LCD_X_DisplayDriver(unsigned LayerIndex, unsigned Cmd, void* pData)
       //
       // Required if the display controller should support switching on and off
       //
+      if (LayerIndex == 1) {
+        fb_f1c100s_overlay_show(&fb_f1c100s, 1);
+      }
       return 0;
     }
     case LCD_X_OFF: {
       //
       // Required if the display controller should support switching on and off
       //
-      // ...
+      if (LayerIndex == 1) {
+        fb_f1c100s_overlay_show(&fb_f1c100s, 0);
+      }
       return 0;
     }
+    case LCD_X_SETVIS: {
+      //
+      // Required for setting the layer visibility which is passed in the 'OnOff' element of pData
+      //
+      LCD_X_SETVIS_INFO* p;
+      p = (LCD_X_SETVIS_INFO*)pData;
+      if (LayerIndex == 1) {
+        fb_f1c100s_overlay_show(&fb_f1c100s, p->OnOff);
+        return 0;
+      }
+      return -1;
+    }
+    case LCD_X_SETCHROMAMODE: {
+      //
+      // Required for switching the color key of the overlay, so opaque
+      // drawings (dialogs etc.) on a key background need no CPU blending
+      //
+      LCD_X_SETCHROMAMODE_INFO* p;
+      p = (LCD_X_SETCHROMAMODE_INFO*)pData;
+      if (LayerIndex == 1) {
+        fb_f1c100s_overlay_colorkey_enable(&fb_f1c100s, p->ChromaMode);
+        return 0;
+      }
+      return -1;
+    }
+    case LCD_X_SETCHROMA: {
+      //
+      // Required for setting the color key range which is passed in the 'ChromaMin' and 'ChromaMax' element of pData
+      //
+      LCD_X_SETCHROMA_INFO* p;
+      p = (LCD_X_SETCHROMA_INFO*)pData;
+      if (LayerIndex == 1) {
+        fb_f1c100s_overlay_colorkey(&fb_f1c100s, _Color2RGB(p->ChromaMin), _Color2RGB(p->ChromaMax));
+        return 0;
+      }
+      return -1;
+    }
+    case LCD_X_SETPOS: {
+      //
+      // Required for setting the layer position which is passed in the 'xPos' and 'yPos' element of pData
+      //
+      LCD_X_SETPOS_INFO* p;
+      p = (LCD_X_SETPOS_INFO*)pData;
+      if (LayerIndex == 1) {
+        fb_f1c100s_overlay_move(&fb_f1c100s, p->xPos, p->yPos);
+        return 0;
+      }
+      return -1;
+    }
     default:
       r = -1;
   }
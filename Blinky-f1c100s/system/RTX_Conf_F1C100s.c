@@ -272,10 +272,12 @@ __task void os_idle_demon(void)
 }
 
 /*--------------------------- os_tmr_call -----------------------------------*/
-#if OS_TIMERCNT > 0
-/* os_tmr_call()TickжϻTaskִ߳УӲˡ*/
-static void UFX_PostTaskTimer(U16 info);
+// OS_TIMERCNTΪ0ʱos_tmr_create()ʧܣUFX_AddTaskTimer()֮false
+// UFX_TIMERCNTĶʱֱӵos_tmr_create()Ĵ룬infoҪUFX_TIMERCNT
+#if (OS_TIMERCNT > 0) && (OS_TIMERCNT < UFX_TIMERCNT)
+#error OS_TIMERCNTС<efxinc.h>еUFX_TIMERCNT
 #endif
+
 void os_tmr_call(U16 info)
 {
   /* This function is called when the user timer has expired. Parameter   */
@@ -283,6 +285,7 @@ void os_tmr_call(U16 info)
 
   /* HERE: include optional user code to be executed on timeout. */
 #if OS_TIMERCNT > 0
+  /* os_tmr_call()TickжϻTaskִ߳УӲˡ*/
   UFX_PostTaskTimer(info);
 #endif
 }
@@ -314,128 +317,6 @@ void os_error(U32 err_code)
 }
 
 
-/*--------------------------- os_timer --------------------------------------*/
-
-#if OS_TIMERCNT > 0
-
-#if OS_TIMERCNT > 255
-#error OS_TIMERCNTȡֵܴ255
-#endif
-
-typedef struct {
-  void* parg;
-  void (*pfn)(void*);
-} TskTmrType;
-
-static TskTmrType tsktmr_pool[OS_TIMERCNT];
-static os_mbx_declare(mb_tsktmr, OS_TIMERCNT);
-#define HDL_MAX OS_TIMERCNT
-#include "halloc.h"
-
-static __task void __ThreadTimerWaiter(void)
-{
-  CPU_SR_DECL;
-  void (*pfn)(void*);
-  void* parg;
-  U32 uival;
-  U16 info;
-  void* msg;
-
-  for (;;) {
-    if (os_mbx_wait(&mb_tsktmr, &msg, TWAIT_FOREVER) != OS_R_TMO) {
-      uival = (U32)msg;
-      if (uival & (1UL << 31)) {
-        info = (U16)uival;
-        if (info > 0) {
-          parg = tsktmr_pool[info - 1].parg;
-          pfn = tsktmr_pool[info - 1].pfn;
-          CPU_ENTER_CRITICAL();
-          __hdl_free(info);
-          CPU_EXIT_CRITICAL();
-          if (pfn) {
-            pfn(parg);
-          }
-        }
-      }
-    }
-  }
-}
-
-/* ̶߳ʱĻʩúBSPһ */
-void UFX_SetupTaskTimer(void)
-{
-  static U64 __StackTimerWaiter[1024 / 8] MEM_PI_STACK;
-  CPU_SR_DECL;
-  OS_TID task_id;
-
-  CPU_ENTER_CRITICAL();
-  __hdl_pool_init();
-  CPU_EXIT_CRITICAL();
-
-  os_mbx_init(&mb_tsktmr, sizeof(mb_tsktmr));
-
-  task_id = os_tsk_create_user(
-                __ThreadTimerWaiter,
-                TSK_PRIO_HIGHEST,
-                __StackTimerWaiter,
-                sizeof(__StackTimerWaiter));
-
-  if (task_id == 0) {
-    sys_suspend();
-    return;
-  }
-}
-
-/* һ̶߳ʱ */
-bool_t UFX_AddTaskTimer(U16 dly, void (*pfn)(void*), void* parg)
-{
-  CPU_SR_DECL;
-  OS_ID tmr_id = 0;
-  U16 info = 0;
-
-  CPU_ENTER_CRITICAL();
-  info = __hdl_alloc();
-  CPU_EXIT_CRITICAL();
-  if (info == 0) {
-    return false;
-  }
-  tsktmr_pool[info - 1].parg = parg;
-  tsktmr_pool[info - 1].pfn = pfn;
-  tmr_id = os_tmr_create(dly, info);
-  if (tmr_id == NULL) {
-    CPU_ENTER_CRITICAL();
-    __hdl_free(info);
-    CPU_EXIT_CRITICAL();
-    return false;
-  }
-  return true;
-}
-
-/* RTXos_tmr_call()еü */
-void UFX_PostTaskTimer(U16 info)
-{
-  int nfree;
-  CPU_SR_DECL;
-
-  if (info > 0) {
-    nfree = isr_mbx_check(&mb_tsktmr);
-    if (nfree > 0) {
-      // Ͷʱ¼ʱר̡߳
-      isr_mbx_send(&mb_tsktmr, (void*)((1UL << 31) | info));
-    } else {
-      // ֻܶöʱ¼
-      CPU_ENTER_CRITICAL();
-      __hdl_free(info);
-      CPU_EXIT_CRITICAL();
-      os_error(OS_ERR_MBX_OVF);
-    }
-  }
-}
-
-#else
-#warning OS_TIMERCNTΪֵUFX_AddTaskTimer()ܣ
-#endif
-
 /*----------------------------------------------------------------------------
  *      RTX Configuration Functions
  *---------------------------------------------------------------------------*/
@@ -11,8 +11,13 @@
 #include <stdio.h>
 #include <time.h>
 #include <rt_misc.h>
+#include "target.h"
 
-extern void sys_uart_putc(char c);
+/* stdout keeps every character by default; it only waits when the UART */
+/* ring buffer is full. Define as UART_TX_DROP to never stall callers.   */
+#ifndef STDOUT_TX_FLAGS
+#define STDOUT_TX_FLAGS   UART_TX_BLOCK
+#endif
 
 #pragma import(__use_no_semihosting)
 #pragma import(__use_no_semihosting_swi)
@@ -23,10 +28,9 @@ FILE __stdin;
 
 static void sendchar(int c)
 {
-  if (c == '\n')  {
-    sys_uart_putc('\r');
-  }
-  sys_uart_putc(c);
+  char ch = (char)c;
+
+  f1c100s_uart_write(&ch, 1, STDOUT_TX_FLAGS);
 }
 
 int fputc(int ch, FILE* f)
@@ -37,7 +41,9 @@ int fputc(int ch, FILE* f)
 
 int fgetc(FILE* f)
 {
-  return (0);
+  int c = f1c100s_uart_getc();
+
+  return (c < 0) ? EOF : c;
 }
 
 
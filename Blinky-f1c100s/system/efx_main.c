@@ -20,9 +20,15 @@ static __task void __ThreadStartup(void);
 ////////////////////////////////////////////////////////////////////////////////
 int main(void)
 {
-  // stdout
+  // stdout(UART0ѸΪжϷַͣдֻǽλ)
   setbuf(stdout, NULL);
   f1c100s_intc_init();
+  f1c100s_uart_init();
+  // Ԥstartup̵߳ջ
+  TSKMON_Init();
+  TSKMON_PaintStack(__StackStartup, sizeof(__StackStartup));
+  // Ƹ
+  TRACE_Init();
 
   // startup̣߳û򶼴Ӹ߳
   util_enable_interrupt();
@@ -48,6 +54,7 @@ int main(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void __ThreadStartup(void)
 {
+  TSKMON_Register(os_tsk_self(), "startup", __StackStartup, sizeof(__StackStartup));
   // Ϊstdoutӿ
   DBG_INIT();
   // timeṛ߳RTXϵͳ
@@ -11,6 +11,7 @@
 #include "f1c100s-irq.h"
 #include "f1c100s-reset.h"
 #include "target.h"
+#include "ftrace.h"
 #include "sizes.h"
 
 #ifndef __IO
@@ -80,8 +81,11 @@ uint8_t f1c100s_intc_get_nirq(void)
 void f1c100s_intc_dispatch(uint8_t nIRQ)
 {
   IRQHandleTypeDef handle = irq_table[nIRQ];
-  if (handle)
+  if (handle) {
+    TRACE1(TRC_IRQ_ENTER, nIRQ);
     handle();
+    TRACE1(TRC_IRQ_EXIT, nIRQ);
+  }
 }
 
 /*
@@ -0,0 +1,300 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include <stdint.h>
+#include "target.h"
+#include "fdebug.h"
+#include "f1c100s-irq.h"
+#include "io.h"
+#include "RTL.h"
+
+// UART0SPLsys_uart_init()Ϊ115200-8-1-0ѴFIFO
+#define UART0_BASE      (0x01c25000)
+#define UART_RBR        (0x00)
+#define UART_THR        (0x00)
+#define UART_IER        (0x04)
+#define UART_IIR        (0x08)
+#define UART_LSR        (0x14)
+#define UART_USR        (0x7c)
+
+#define IER_ERBFI       (1 << 0)
+#define IER_ETBEI       (1 << 1)
+#define IIR_NONE        (0x1)
+#define IIR_THRE        (0x2)
+#define IIR_RDA         (0x4)
+#define IIR_RLS         (0x6)
+#define IIR_BUSY        (0x7)
+#define IIR_TIMEOUT     (0xc)
+#define LSR_DR          (1 << 0)
+#define USR_TFNF        (1 << 1)
+#define USR_TFE         (1 << 2)
+#define PSR_I_BIT       (1 << 7)
+#define PSR_MODE_MASK   (0x1f)
+#define PSR_MODE_USR    (0x10)
+#define PSR_MODE_SYS    (0x1f)
+
+// С2
+#ifndef UART_TXBUF_SIZE
+#define UART_TXBUF_SIZE (4096)
+#endif
+#ifndef UART_RXBUF_SIZE
+#define UART_RXBUF_SIZE (256)
+#endif
+// ÿιж࿽ֽдʱĹжʱ
+#define UART_TX_CHUNK   (64)
+
+extern void sys_uart_putc(char c);
+
+static uint8_t _txbuf[UART_TXBUF_SIZE];
+static volatile uint32_t _tx_head = 0;
+static volatile uint32_t _tx_tail = 0;
+static uint8_t _rxbuf[UART_RXBUF_SIZE];
+static volatile uint32_t _rx_head = 0;
+static volatile uint32_t _rx_tail = 0;
+static volatile uint32_t _tx_dropped = 0;
+static volatile bool_t _irq_mode = false;
+// ʱ˯жڳռѡÿǼǵĵȴ
+// ֻһźŲжעźﲻܶ
+static OS_SEM _tx_sem;
+static volatile uint32_t _tx_waiters = 0;
+
+/*
+* ѷͻеݰӲFIFOֱFIFO򻺳
+* ڹжϻUARTж
+* @return: none
+*/
+static void __tx_pump(void)
+{
+  uint32_t ier;
+
+  while (_tx_tail != _tx_head && (read32(UART0_BASE + UART_USR) & USR_TFNF)) {
+    write32(UART0_BASE + UART_THR, _txbuf[_tx_tail & (UART_TXBUF_SIZE - 1)]);
+    _tx_tail++;
+  }
+  // ﻹʱŴ򿪷Ϳж
+  ier = read32(UART0_BASE + UART_IER);
+  if (_tx_tail != _tx_head) {
+    ier |= IER_ETBEI;
+  } else {
+    ier &= ~IER_ETBEI;
+  }
+  write32(UART0_BASE + UART_IER, ier);
+}
+
+static void uart0_irq(void)
+{
+  uint32_t iid;
+  uint8_t c;
+
+  for (;;) {
+    iid = read32(UART0_BASE + UART_IIR) & 0x0f;
+    if (iid == IIR_NONE)
+      break;
+    switch (iid) {
+    case IIR_THRE:
+      __tx_pump();
+      while (_tx_waiters) {
+        _tx_waiters--;
+        isr_sem_send(&_tx_sem);
+      }
+      break;
+    case IIR_RDA:
+    case IIR_TIMEOUT:
+      while (read32(UART0_BASE + UART_LSR) & LSR_DR) {
+        c = (uint8_t)read32(UART0_BASE + UART_RBR);
+        if ((_rx_head - _rx_tail) < UART_RXBUF_SIZE) {
+          _rxbuf[_rx_head & (UART_RXBUF_SIZE - 1)] = c;
+          _rx_head++;
+        }
+#if defined(FDEBUG_EN) && (FDEBUG_EN > 0)
+        fdbg_rxchar((char)c);
+#endif
+      }
+      break;
+    case IIR_RLS:
+      read32(UART0_BASE + UART_LSR);
+      break;
+    case IIR_BUSY:
+      read32(UART0_BASE + UART_USR);
+      break;
+    default:
+      return;
+    }
+  }
+}
+
+/*
+* ܷ˯ߵȴRTXѾУ(SYS/USRģʽ)ûйж
+* @return: ʱtrue
+*/
+static bool_t __can_sleep(void)
+{
+  ubase_t cpsr = util_getCPSR();
+
+  if (cpsr & PSR_I_BIT)
+    return false;
+  if ((cpsr & PSR_MODE_MASK) != PSR_MODE_SYS && (cpsr & PSR_MODE_MASK) != PSR_MODE_USR)
+    return false;
+  return (os_tsk_self() != 0) ? true : false;
+}
+
+/*
+* лж+λ巽ʽ֮ķͲѯȴӲFIFO
+* ظ
+* @return: none
+*/
+void f1c100s_uart_init(void)
+{
+  CPU_SR_DECL;
+
+  if (_irq_mode)
+    return;
+  os_sem_init(&_tx_sem, 0);
+  CPU_ENTER_CRITICAL();
+  f1c100s_intc_set_isr(F1C100S_IRQ_UART0, uart0_irq);
+  write32(UART0_BASE + UART_IER, IER_ERBFI);
+  _irq_mode = true;
+  __tx_pump();
+  CPU_EXIT_CRITICAL();
+  f1c100s_intc_enable_irq(F1C100S_IRQ_UART0);
+}
+
+/*
+* 껺еݺصѯʽ(縴λתǰ)
+* @return: none
+*/
+void f1c100s_uart_exit(void)
+{
+  if (!_irq_mode)
+    return;
+  f1c100s_uart_flush();
+  f1c100s_intc_disable_irq(F1C100S_IRQ_UART0);
+  write32(UART0_BASE + UART_IER, 0);
+  _irq_mode = false;
+}
+
+/*
+* дݵͻ塣BLOCKʽ»ʱ˯ߵжڳռ䣬ת
+* ռCPUжжʱRTX֮ǰֻԼӲFIFO
+* @buf/@num: 
+* @flags: UART_TX_DROPUART_TX_BLOCKٻUART_TX_RAW
+* @return: ʵдֽ(DROPʽ»ʱСnum)
+*/
+uint32_t f1c100s_uart_write(void const* buf, uint32_t num, uint32_t flags)
+{
+  uint8_t const* p = (uint8_t const*)buf;
+  uint32_t n = 0, k;
+  bool_t full;
+  CPU_SR_DECL;
+
+  if (!_irq_mode) {
+    // ûлжϷʽSPLѯ
+    for (; n < num; n++) {
+      if (p[n] == '\n' && !(flags & UART_TX_RAW))
+        sys_uart_putc('\r');
+      sys_uart_putc(p[n]);
+    }
+    return n;
+  }
+
+  while (n < num) {
+    full = false;
+    CPU_ENTER_CRITICAL();
+    for (k = 0; k < UART_TX_CHUNK && n < num; k++) {
+      if (p[n] == '\n' && !(flags & UART_TX_RAW)) {
+        if (UART_TXBUF_SIZE - (_tx_head - _tx_tail) < 2) {
+          full = true;
+          break;
+        }
+        _txbuf[_tx_head & (UART_TXBUF_SIZE - 1)] = '\r';
+        _tx_head++;
+      } else if (UART_TXBUF_SIZE - (_tx_head - _tx_tail) < 1) {
+        full = true;
+        break;
+      }
+      _txbuf[_tx_head & (UART_TXBUF_SIZE - 1)] = p[n];
+      _tx_head++;
+      n++;
+    }
+    __tx_pump();
+    CPU_EXIT_CRITICAL();
+
+    if (full) {
+      if (!(flags & UART_TX_BLOCK)) {
+        _tx_dropped += num - n;
+        break;
+      }
+      if (__can_sleep()) {
+        // ͬһжǼǣжϲ©λ
+        CPU_ENTER_CRITICAL();
+        full = (UART_TXBUF_SIZE - (_tx_head - _tx_tail) < 2) ? true : false;
+        if (full)
+          _tx_waiters++;
+        CPU_EXIT_CRITICAL();
+        if (full)
+          os_sem_wait(&_tx_sem, 0xffff);
+      } else {
+        // ߿ܴڹж״̬Լ˶ǵж
+        CPU_ENTER_CRITICAL();
+        __tx_pump();
+        CPU_EXIT_CRITICAL();
+      }
+    }
+  }
+  return n;
+}
+
+/*
+* ӽջһַ
+* @return: ûʱ-1
+*/
+int f1c100s_uart_getc(void)
+{
+  int c;
+
+  if (!_irq_mode) {
+    if (read32(UART0_BASE + UART_LSR) & LSR_DR)
+      return (int)(read32(UART0_BASE + UART_RBR) & 0xff);
+    return -1;
+  }
+  if (_rx_tail == _rx_head)
+    return -1;
+  c = _rxbuf[_rx_tail & (UART_RXBUF_SIZE - 1)];
+  _rx_tail++;
+  return c;
+}
+
+/*
+* ȴͻӲFIFOȫ
+* @return: none
+*/
+void f1c100s_uart_flush(void)
+{
+  CPU_SR_DECL;
+
+  while (_tx_tail != _tx_head) {
+    CPU_ENTER_CRITICAL();
+    __tx_pump();
+    CPU_EXIT_CRITICAL();
+  }
+  while (!(read32(UART0_BASE + UART_USR) & USR_TFE));
+}
+
+/*
+* ȡͻĿֽ߾ݴ˾ǷҪ˯ߵȴ
+* @return: ֽ(ûлжϷʽʱǿд)
+*/
+uint32_t f1c100s_uart_txfree(void)
+{
+  if (!_irq_mode)
+    return UART_TXBUF_SIZE;
+  return UART_TXBUF_SIZE - (_tx_head - _tx_tail);
+}
+
+/*
+* ȡ򻺳ֽ
+* @return: ۼƶ
+*/
+uint32_t f1c100s_uart_dropped(void)
+{
+  return _tx_dropped;
+}
@@ -0,0 +1,203 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "efxinc.h"
+#include <stdio.h>
+
+#if defined(FDEBUG_EN) && (FDEBUG_EN > 0)
+
+#if (FDEBUG_DLOG_EN > 0)
+typedef struct {
+  char const* fmt;
+  u32_t arg[4];
+} DlogEntryType;
+
+static DlogEntryType _dlog[FDEBUG_DLOG_SIZE];
+static volatile u32_t _dlog_head = 0;
+static volatile u32_t _dlog_tail = 0;
+static volatile u32_t _dlog_dropped = 0;
+
+static U64 __StackDlog[1024 / 8] MEM_PI_STACK;
+static __task void __ThreadDlog(void);
+static OS_TID _dlog_tid = 0;
+
+static void __dlog_drain(void)
+{
+  DlogEntryType e;
+  char buf[128];
+  u32_t dropped;
+  int len;
+  CPU_SR_DECL;
+
+  for (;;) {
+    // fdbg_flush()Ҳڱ߳ȡ־ԳҪж
+    CPU_ENTER_CRITICAL();
+    if (_dlog_tail == _dlog_head) {
+      CPU_EXIT_CRITICAL();
+      break;
+    }
+    e = _dlog[_dlog_tail & (FDEBUG_DLOG_SIZE - 1)];
+    _dlog_tail++;
+    CPU_EXIT_CRITICAL();
+    len = snprintf(buf, sizeof(buf), e.fmt, e.arg[0], e.arg[1], e.arg[2], e.arg[3]);
+    if (len > (int)sizeof(buf) - 1)
+      len = sizeof(buf) - 1;
+    if (len > 0)
+      f1c100s_uart_write(buf, len, UART_TX_BLOCK);
+  }
+  if (_dlog_dropped) {
+    CPU_ENTER_CRITICAL();
+    dropped = _dlog_dropped;
+    _dlog_dropped = 0;
+    CPU_EXIT_CRITICAL();
+    len = snprintf(buf, sizeof(buf), "[dlog] %u dropped\n", dropped);
+    f1c100s_uart_write(buf, len, UART_TX_BLOCK);
+  }
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: fdbg_init
+//|  |: ʼ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: RTX߳ãᴴӳ־̡߳
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void fdbg_init(void)
+{
+  f1c100s_uart_init();
+#if (FDEBUG_DLOG_EN > 0)
+  if (_dlog_tid == 0) {
+    _dlog_tid = TSKMON_CreateTask(
+                    "dlog",
+                    __ThreadDlog,
+                    TSK_PRIO_LOLIMIT,
+                    __StackDlog,
+                    sizeof(__StackDlog));
+  }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: fdbg_flush
+//|  |: леĵϢ
+//|          |:
+//| б |: bClose Ϊtrueʱصѯʽ
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void fdbg_flush(bool_t bClose)
+{
+#if (FDEBUG_DLOG_EN > 0)
+  __dlog_drain();
+#endif
+  f1c100s_uart_flush();
+  if (bClose) {
+    f1c100s_uart_exit();
+  }
+}
+
+void fdbg_putc(int c)
+{
+  char ch = (char)c;
+
+  f1c100s_uart_write(&ch, 1, FDEBUG_TX_FLAGS);
+}
+
+void fdbg_puts(char const s[])
+{
+  f1c100s_uart_write(s, strlen(s), FDEBUG_TX_FLAGS);
+}
+
+void fdbg_output(void const* bin, unsigned num)
+{
+  f1c100s_uart_write(bin, num, FDEBUG_TX_FLAGS | UART_TX_RAW);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: fdbg_write
+//|  |: ָʽд
+//|          |:
+//| б |: flags UART_TX_DROP/UART_TX_BLOCKٻUART_TX_RAW
+//|          |:
+//|      |: ʵдֽ
+//|          |:
+//| עϢ |: ҪξʱǶǵȴĳϡ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+unsigned fdbg_write(void const* buf, unsigned num, unsigned flags)
+{
+  return f1c100s_uart_write(buf, num, flags);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: fdbg_rxchar
+//|  |: UART0ÿյһַøú(ж)
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ĬʲôҲַͬʱڽջ﹩fgetc()ȡ
+//|          |: Ҫʵֵʱڱ¶
+////////////////////////////////////////////////////////////////////////////////
+__weak void fdbg_rxchar(char c)
+{
+  (void)c;
+}
+
+#if (FDEBUG_DLOG_EN > 0)
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: fdbg_dlog
+//|  |: ¼һӳٸʽ־
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ֻʽָ4жã
+//|          |: ־ʱͨDBG_LOGn()á
+////////////////////////////////////////////////////////////////////////////////
+void fdbg_dlog(char const* fmt, u32_t a0, u32_t a1, u32_t a2, u32_t a3)
+{
+  DlogEntryType* e;
+  CPU_SR_DECL;
+
+  CPU_ENTER_CRITICAL();
+  if ((_dlog_head - _dlog_tail) >= FDEBUG_DLOG_SIZE) {
+    _dlog_dropped++;
+  } else {
+    e = &_dlog[_dlog_head & (FDEBUG_DLOG_SIZE - 1)];
+    e->fmt = fmt;
+    e->arg[0] = a0;
+    e->arg[1] = a1;
+    e->arg[2] = a2;
+    e->arg[3] = a3;
+    _dlog_head++;
+  }
+  CPU_EXIT_CRITICAL();
+}
+
+static __task void __ThreadDlog(void)
+{
+  for (;;) {
+    os_dly_wait(FDEBUG_DLOG_PERIOD);
+    __dlog_drain();
+  }
+}
+#endif
+
+#endif /* FDEBUG_EN */
+
+////////////////////////////////////////////////////////////////////////////////
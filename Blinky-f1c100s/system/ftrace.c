@@ -0,0 +1,112 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "efxinc.h"
+
+#if (TRACE_EN > 0)
+
+// ʹλͼֻ32λ
+typedef char __trace_evt_check[(TRC_COUNT <= 32) ? 1 : -1];
+
+TraceBufType TRACE_Buffer;
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: TRACE_Init
+//|  |: ոٻ岢ʹȫ¼
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: Ӧڴж֮ǰá
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void TRACE_Init(void)
+{
+  target_hrt_setup();
+  TRACE_Buffer.mask = 0;
+  TRACE_Buffer.magic = TRACE_MAGIC;
+  TRACE_Buffer.version = TRACE_VERSION;
+  TRACE_Buffer.freq = TARGET_HRT_FREQ;
+  TRACE_Buffer.size = TRACE_BUF_SIZE;
+  TRACE_Buffer.head = 0;
+  TRACE_Buffer.mask = 0xFFFFFFFFUL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: TRACE_SetMask
+//|  |: ¼ʹλͼ
+//|          |:
+//| б |: mask nλΪ1ʾ¼¼IDΪn¼
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ֻлTRACE_SetMask(1UL << TRC_TASK_SWITCH)
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void TRACE_SetMask(u32_t mask)
+{
+  TRACE_Buffer.mask = mask;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: TRACE_Record
+//|  |: дһټ¼ͨTRACEn()
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ARM926ûLDREX/STREXռòλȡʱʱжϼָ
+//|          |: д¼ʱжҲжﶼԵá
+////////////////////////////////////////////////////////////////////////////////
+void TRACE_Record(u32_t id, u32_t nargs, u32_t a0, u32_t a1, u32_t a2, u32_t a3)
+{
+  TraceRecType* r;
+  u32_t idx, ts;
+  CPU_SR_DECL;
+
+  if (!(TRACE_Buffer.mask & (1UL << id)))
+    return;
+  CPU_ENTER_CRITICAL();
+  idx = TRACE_Buffer.head++;
+  ts = target_hrt_read();
+  CPU_EXIT_CRITICAL();
+
+  r = &TRACE_Buffer.rec[idx & (TRACE_BUF_SIZE - 1)];
+  r->ts = ts;
+  r->id = (u16_t)id;
+  r->nargs = (u16_t)nargs;
+  r->arg[0] = a0;
+  r->arg[1] = a1;
+  r->arg[2] = a2;
+  r->arg[3] = a3;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: TRACE_Dump
+//|  |: ͣ¼ٻԭUART0ȥȻָ¼
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ˰Ѵյݴļtrace_decodeɣ
+//|          |: ǰӵıᱻԶ
+////////////////////////////////////////////////////////////////////////////////
+void TRACE_Dump(void)
+{
+  u32_t mask = TRACE_Buffer.mask;
+
+  TRACE_Buffer.mask = 0;
+  f1c100s_uart_write(&TRACE_Buffer, sizeof(TRACE_Buffer), UART_TX_BLOCK | UART_TX_RAW);
+  f1c100s_uart_flush();
+  TRACE_Buffer.mask = mask;
+}
+
+#endif /* TRACE_EN */
+
+////////////////////////////////////////////////////////////////////////////////
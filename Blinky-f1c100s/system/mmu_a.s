@@ -122,6 +122,16 @@ MMU_DisableMMU
 MMU_SetTTBase 
             MCR         p15,0,R0,c2,c0,0
             BX          LR
+
+;///////////////////////////////////////////////////////////////////////////////
+;// unsigned long MMU_GetTTBase(void);
+;///////////////////////////////////////////////////////////////////////////////
+            AREA        |.text|, CODE, READONLY
+            ARM
+            EXPORT      MMU_GetTTBase
+MMU_GetTTBase 
+            MRC         p15,0,R0,c2,c0,0
+            BX          LR
         
 ;//=========================
 ;// Set Domain
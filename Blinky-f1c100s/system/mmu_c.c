@@ -51,3 +51,33 @@ void MMU_InvalidateDCacheArray(unsigned long mva, unsigned long num)
   }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: MMU_SetSectionAttr
+//|  |: ޸һ1MBӳ(ַ=ַ)ԣcache
+//|          |:
+//| б |: mva: ʼַ1MBȡ
+//|          |: size: ֽ1MBȡ
+//|          |: attr: ĵ20λMMU_ATTRIB_CNB|MMU_ATTRIB_RW|...
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ҳSPL(sys-mmu.c)0ΪȨޡ
+//|          |: ֮ǰдزdcacheµٱд
+////////////////////////////////////////////////////////////////////////////////
+void MMU_SetSectionAttr(unsigned long mva, unsigned long size, unsigned long attr)
+{
+  unsigned long* ttb = (unsigned long*)(MMU_GetTTBase() & ~0x3fffUL);
+  unsigned long i, first, last;
+
+  first = mva >> 20;
+  last = (mva + size + 0xfffff) >> 20;
+  MMU_TestCleanAndInvalidateDCache();
+  for (i = first; i < last; i++) {
+    ttb[i] = (i << 20) | (attr & 0xfffff);
+  }
+  MMU_CleanDCacheArray((unsigned long)&ttb[first] & ~(CACHE_ALIGN - 1),
+                       CACHE_ALIGN_SIZ((unsigned long)&ttb[last] - ((unsigned long)&ttb[first] & ~(CACHE_ALIGN - 1))));
+  MMU_InvalidateTLB();
+}
+
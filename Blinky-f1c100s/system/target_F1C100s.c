@@ -35,3 +35,35 @@ void target_wdt_feed(void)
   }
 }
 
+
+////////////////////////////////////////////////////////////////////////////////
+// ߾ȼʱTIMER124Mhzʱݼжϡ
+// TIMER0ѱRTXϵͳtickTIMER2û
+////////////////////////////////////////////////////////////////////////////////
+#define HRT_REG_BASE  (0x01C20C00UL)
+#define HRT_CTRL      (HRT_REG_BASE + 0x20)
+#define HRT_INTV      (HRT_REG_BASE + 0x24)
+#define HRT_CUR       (HRT_REG_BASE + 0x28)
+
+void target_hrt_setup(void)
+{
+  static bool_t bInited = false;
+  CPU_SR_DECL;
+
+  CPU_ENTER_CRITICAL();
+  if (!bInited) {
+    bInited = true;
+    *(volatile u32_t*)HRT_INTV = 0xFFFFFFFFUL;
+    *(volatile u32_t*)HRT_CTRL = 0x04;  // ʱԴOSC24MԤƵ1ģʽ
+    *(volatile u32_t*)HRT_CTRL |= (1 << 1);
+    while (*(volatile u32_t*)HRT_CTRL & (1 << 1));
+    *(volatile u32_t*)HRT_CTRL |= (1 << 0);
+  }
+  CPU_EXIT_CRITICAL();
+}
+
+u32_t target_hrt_read(void)
+{
+  // ǵݼģȡɵֵ
+  return ~(*(volatile u32_t*)HRT_CUR);
+}
@@ -0,0 +1,277 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "efxinc.h"
+#include <stdio.h>
+
+#if (TSKMON_EN > 0)
+
+typedef struct {
+  char const* name;
+  u32_t* stk;           // ջ(͵ַ)
+  u32_t stk_words;
+  u32_t cycles;
+  u32_t cycles_last;    // ϸͳƴڽʱcycles
+  u32_t permille;
+  u32_t switches;
+} TaskSlotType;
+
+// ±0idle(ԼRTXǰʱ)±꼴ΪID
+static TaskSlotType _slots[TSKMON_MAXTASK + 1];
+static u32_t _cur_slot = 0;
+static u32_t _hrt_last = 0;
+static u32_t _hrt_window = 0;
+static volatile bool_t _running = false;
+
+static void __tskmon_switch(U32 task_id)
+{
+  u32_t now;
+
+  if (!_running)
+    return;
+  now = target_hrt_read();
+  _slots[_cur_slot].cycles += (now - _hrt_last);
+  _hrt_last = now;
+  _cur_slot = (task_id <= TSKMON_MAXTASK) ? task_id : 0;
+  _slots[_cur_slot].switches++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: TSKMON_Init
+//|  |: ߾ȼʱʼͳ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: Ӧos_sys_init_user()֮ǰá
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void TSKMON_Init(void)
+{
+  CPU_SR_DECL;
+
+  target_hrt_setup();
+  CPU_ENTER_CRITICAL();
+  memset(_slots, 0, sizeof(_slots));
+  _slots[0].name = "idle";
+  _cur_slot = 0;
+  _hrt_last = target_hrt_read();
+  _hrt_window = _hrt_last;
+  _running = true;
+  CPU_EXIT_CRITICAL();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: TSKMON_PaintStack
+//|  |: TSKMON_STK_MAGICջ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ڴ֮ǰãƻֳ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void TSKMON_PaintStack(void* stk, u32_t size)
+{
+  u32_t* p = (u32_t*)stk;
+  u32_t n = size / 4;
+
+  while (n--) {
+    *p++ = TSKMON_STK_MAGIC;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: TSKMON_Register
+//|  |: ǼջԱ㱨ջ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ջTSKMON_PaintStack()
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void TSKMON_Register(OS_TID tid, char const* name, void* stk, u32_t size)
+{
+  CPU_SR_DECL;
+
+  if (tid == 0 || tid > TSKMON_MAXTASK)
+    return;
+  CPU_ENTER_CRITICAL();
+  _slots[tid].name = name;
+  _slots[tid].stk = (u32_t*)stk;
+  _slots[tid].stk_words = size / 4;
+  CPU_EXIT_CRITICAL();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: TSKMON_CreateTask
+//|  |: ջ񲢵Ǽǣ÷ͬos_tsk_create_user()
+//|          |:
+//| б |:
+//|          |:
+//|      |: IDʧܷ0
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+OS_TID TSKMON_CreateTask(char const* name, void (*task)(void), U8 prio, void* stk, U16 size)
+{
+  OS_TID tid;
+
+  TSKMON_PaintStack(stk, size);
+  tid = os_tsk_create_user(task, prio, stk, size);
+  if (tid != 0) {
+    TSKMON_Register(tid, name, stk, size);
+  }
+  return tid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: TSKMON_Sample
+//|  |: ǰͳƴڣڴڵCPUռ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ڳȲóHRTĻ(Լ178)
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void TSKMON_Sample(void)
+{
+  static u32_t delta[TSKMON_MAXTASK + 1];
+  u32_t now, total, i;
+  CPU_SR_DECL;
+
+  CPU_ENTER_CRITICAL();
+  now = target_hrt_read();
+  _slots[_cur_slot].cycles += (now - _hrt_last);
+  _hrt_last = now;
+  total = now - _hrt_window;
+  _hrt_window = now;
+  for (i = 0; i <= TSKMON_MAXTASK; i++) {
+    delta[i] = _slots[i].cycles - _slots[i].cycles_last;
+    _slots[i].cycles_last = _slots[i].cycles;
+  }
+  CPU_EXIT_CRITICAL();
+
+  if (total == 0)
+    total = 1;
+  for (i = 0; i <= TSKMON_MAXTASK; i++) {
+    _slots[i].permille = (u32_t)(((u64_t)delta[i] * 1000) / total);
+  }
+}
+
+static u32_t __stack_used(TaskSlotType const* slot)
+{
+  u32_t n = 1;
+
+  if (slot->stk == NULL)
+    return 0;
+  // ջջ׿ʼԱֵĵԪRTXʱstk[0]
+  // дԼջ(MAGIC_WORD)ãstk[1]
+  while (n < slot->stk_words && slot->stk[n] == TSKMON_STK_MAGIC) {
+    n++;
+  }
+  return (slot->stk_words - (n - 1)) * 4;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: TSKMON_GetInfo
+//|  |: ȡָͳϢGUIڻshellʾ
+//|          |:
+//| б |: tid ID0Ϊidle
+//|          |:
+//|      |: δйδǼ򷵻false
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+bool_t TSKMON_GetInfo(u32_t tid, TaskMonInfoType* info)
+{
+  TaskSlotType const* slot;
+
+  if (tid > TSKMON_MAXTASK)
+    return false;
+  slot = &_slots[tid];
+  if (slot->name == NULL && slot->switches == 0)
+    return false;
+  info->name = slot->name;
+  info->tid = tid;
+  info->cpu_permille = slot->permille;
+  info->cycles = slot->cycles;
+  info->switches = slot->switches;
+  info->stk_size = slot->stk_words * 4;
+  info->stk_used = __stack_used(slot);
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: TSKMON_Report
+//|  |: ѸͳϢӡstdout
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ȵTSKMON_Sample()ܵõµCPUռʡ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void TSKMON_Report(void)
+{
+  TaskMonInfoType info;
+  u32_t i;
+
+  printf("TID NAME         CPU%%   SWITCHES  STACK\n");
+  for (i = 0; i <= TSKMON_MAXTASK; i++) {
+    if (!TSKMON_GetInfo(i, &info))
+      continue;
+    printf("%3u %-12s %3u.%u %9u  ",
+           info.tid,
+           info.name ? info.name : "?",
+           info.cpu_permille / 10,
+           info.cpu_permille % 10,
+           info.switches);
+    if (info.stk_size) {
+      printf("%u/%u\n", info.stk_used, info.stk_size);
+    } else {
+      printf("-\n");
+    }
+  }
+}
+
+#endif /* TSKMON_EN */
+
+#if (TSKMON_EN > 0) || (TRACE_EN > 0)
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: rt_post_taskswitch
+//|  |: RTXÿлĹӣһʱǵͷϣ
+//|          |: ¼һлĸ¼
+//| б |: task_id еID
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: RTXõøú(ԭǸRTAõ)
+//|          |: SWI/IRQģضСRTAʱرձģ顣
+////////////////////////////////////////////////////////////////////////////////
+void rt_post_taskswitch(U32 task_id)
+{
+  TRACE1(TRC_TASK_SWITCH, task_id);
+#if (TSKMON_EN > 0)
+  __tskmon_switch(task_id);
+#endif
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,167 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "efxinc.h"
+
+// ̶߳ʱRTXos_tmr_call()ֻתʱ¼صͳһtimerִ߳С
+// ģֻRTXĹAPILinux(host-sim)Ҳֱӱ
+
+#if (UFX_TIMERCNT > 0)
+
+#if (UFX_TIMERCNT > 255)
+#error UFX_TIMERCNTȡֵܴ255
+#endif
+
+typedef struct {
+  void* parg;
+  void (*pfn)(void*);
+} TskTmrType;
+
+static TskTmrType tsktmr_pool[UFX_TIMERCNT];
+static os_mbx_declare(mb_tsktmr, UFX_TIMERCNT);
+#define HDL_MAX UFX_TIMERCNT
+#include "halloc.h"
+
+static __task void __ThreadTimerWaiter(void)
+{
+  CPU_SR_DECL;
+  void (*pfn)(void*);
+  void* parg;
+  U32 uival;
+  U16 info;
+  void* msg;
+
+  for (;;) {
+    if (os_mbx_wait(&mb_tsktmr, &msg, TWAIT_FOREVER) != OS_R_TMO) {
+      uival = (U32)(ubase_t)msg;
+      if (uival & (1UL << 31)) {
+        info = (U16)uival;
+        if (info > 0) {
+          parg = tsktmr_pool[info - 1].parg;
+          pfn = tsktmr_pool[info - 1].pfn;
+          CPU_ENTER_CRITICAL();
+          __hdl_free(info);
+          CPU_EXIT_CRITICAL();
+          if (pfn) {
+            TRACE2(TRC_UFX_TMR_RUN, pfn, parg);
+            pfn(parg);
+            TRACE1(TRC_UFX_TMR_DONE, pfn);
+          }
+        }
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: UFX_SetupTaskTimer
+//|  |: ̶߳ʱĻʩ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: úBSPһΡ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void UFX_SetupTaskTimer(void)
+{
+  static U64 __StackTimerWaiter[1024 / 8] MEM_PI_STACK;
+  CPU_SR_DECL;
+  OS_TID task_id;
+
+  CPU_ENTER_CRITICAL();
+  __hdl_pool_init();
+  CPU_EXIT_CRITICAL();
+
+  os_mbx_init(&mb_tsktmr, sizeof(mb_tsktmr));
+
+  task_id = TSKMON_CreateTask(
+                "timer",
+                __ThreadTimerWaiter,
+                TSK_PRIO_HIGHEST,
+                __StackTimerWaiter,
+                sizeof(__StackTimerWaiter));
+
+  if (task_id == 0) {
+    sys_suspend();
+    return;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: UFX_AddTaskTimer
+//|  |: һε̶߳ʱ
+//|          |:
+//| б |: dly  ʱtick
+//|          |: pfn  ںtimerִ߳еĻص
+//|          |: parg صĲ
+//|      |: ʱԴʱfalse
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+bool_t UFX_AddTaskTimer(U16 dly, void (*pfn)(void*), void* parg)
+{
+  CPU_SR_DECL;
+  OS_ID tmr_id = 0;
+  U16 info = 0;
+
+  CPU_ENTER_CRITICAL();
+  info = __hdl_alloc();
+  CPU_EXIT_CRITICAL();
+  if (info == 0) {
+    return false;
+  }
+  tsktmr_pool[info - 1].parg = parg;
+  tsktmr_pool[info - 1].pfn = pfn;
+  tmr_id = os_tmr_create(dly, info);
+  if (tmr_id == NULL) {
+    CPU_ENTER_CRITICAL();
+    __hdl_free(info);
+    CPU_EXIT_CRITICAL();
+    return false;
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: UFX_PostTaskTimer
+//|  |: ѵڵĶʱ¼תtimer߳
+//|          |:
+//| б |: info ʱʱinfoֵ
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: RTXos_tmr_call()еüɣinfoUFX_TIMERCNTĲ
+//|          |: ̶߳ʱֱӺԡ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void UFX_PostTaskTimer(U16 info)
+{
+  int nfree;
+  CPU_SR_DECL;
+
+  if (info > 0 && info <= UFX_TIMERCNT) {
+    TRACE1(TRC_UFX_TMR_POST, info);
+    nfree = isr_mbx_check(&mb_tsktmr);
+    if (nfree > 0) {
+      // Ͷʱ¼ʱר̡߳
+      isr_mbx_send(&mb_tsktmr, (void*)((1UL << 31) | info));
+    } else {
+      // ֻܶöʱ¼
+      CPU_ENTER_CRITICAL();
+      __hdl_free(info);
+      CPU_EXIT_CRITICAL();
+      os_error(OS_ERR_MBX_OVF);
+    }
+  }
+}
+
+#else
+#warning UFX_TIMERCNTΪֵUFX_AddTaskTimer()ܣ
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
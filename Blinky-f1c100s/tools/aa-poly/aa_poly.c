@@ -0,0 +1,409 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+////////////////////////////////////////////////////////////////////////////////
+// ݶɨ˲ȶԣֱӱ̼GUI_AARaster.c
+// ͼ˫ȰѶβõÿ(򵥶εľȷ)
+// ⰴemWinfactor x factorϲԱͺʱ
+//
+// 룺gcc -O2 -I../../users/task-gui -o aa_poly aa_poly.c ../../users/task-gui/GUI_AARaster.c -lm
+// ÷aa_poly [-t] [-n ] [-s ] [-e ݲ] [-p ǰ׺]
+//   -t ȶΡϸС顢ֳĶκǱָ룬
+//      һͼݲ(ȱʡ2/255)ʧܣ˳Ϊ1
+//   -n εĸȱʡ500
+//   -p ǱָĶͼͲֵͼ(Ŵ32)дǰ׺_fix.pgmǰ׺_ref.pgmǰ׺_diff.pgm
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "GUI_AARaster.h"
+
+#define W             (160)
+#define H             (160)
+#define MAX_POINTS    (64)
+
+typedef struct {
+  double x;
+  double y;
+} PointType;
+
+static uint8_t _fix[W * H];
+static uint8_t _ref[W * H];
+static int32_t _work[W + 3];
+
+static void __span(void* p, int32_t y, int32_t x, int32_t n, uint32_t alpha)
+{
+  uint8_t* img = (uint8_t*)p;
+
+  while (n-- > 0)
+    img[y * W + x++] = (uint8_t)alpha;
+}
+
+/*
+* ɨ裬üΪͼ
+* @return: Ķ
+*/
+static int __fill_fix(PointType const* pts, int n, uint8_t* img)
+{
+  AARasterPointType a[MAX_POINTS];
+  int i;
+
+  for (i = 0; i < n; i++) {
+    a[i].x = (int32_t)floor(pts[i].x * AARASTER_ONE + 0.5);
+    a[i].y = (int32_t)floor(pts[i].y * AARASTER_ONE + 0.5);
+  }
+  memset(img, 0, W * H);
+  return AARASTER_Fill(a, n, 0, 0, W - 1, H - 1, _work, W + 3, __span, img);
+}
+
+// Sutherland-Hodgmanβõһ߽һ(keep>0Ϊ>=v<0Ϊ<=v)
+static int __clip(PointType const* src, int n, PointType* dst, int axis, double v, int keep)
+{
+  int i, m = 0;
+  double c0, c1, t;
+  PointType const *a, *b;
+
+  for (i = 0; i < n; i++) {
+    a = &src[i];
+    b = &src[(i + 1) % n];
+    c0 = ((axis ? a->y : a->x) - v) * keep;
+    c1 = ((axis ? b->y : b->x) - v) * keep;
+    if (c0 >= 0)
+      dst[m++] = *a;
+    if ((c0 >= 0) != (c1 >= 0)) {
+      t = c0 / (c0 - c1);
+      dst[m].x = a->x + (b->x - a->x) * t;
+      dst[m].y = a->y + (b->y - a->y) * t;
+      m++;
+    }
+  }
+  return m;
+}
+
+static double __area(PointType const* p, int n)
+{
+  double s = 0;
+  int i;
+
+  for (i = 0; i < n; i++)
+    s += p[i].x * p[(i + 1) % n].y - p[(i + 1) % n].x * p[i].y;
+  return fabs(s) / 2;
+}
+
+/*
+* ͼÿذѶβõ[x,x+1)x[y,y+1)
+* @return:
+*/
+static void __fill_ref(PointType const* pts, int n, uint8_t* img)
+{
+  PointType a[4 * MAX_POINTS + 8], b[4 * MAX_POINTS + 8];
+  double xmin = 1e9, xmax = -1e9, ymin = 1e9, ymax = -1e9, c;
+  int i, x, y, m;
+
+  memset(img, 0, W * H);
+  for (i = 0; i < n; i++) {
+    xmin = fmin(xmin, pts[i].x);
+    xmax = fmax(xmax, pts[i].x);
+    ymin = fmin(ymin, pts[i].y);
+    ymax = fmax(ymax, pts[i].y);
+  }
+  for (y = (int)fmax(floor(ymin), 0); y < H && y < ymax; y++) {
+    for (x = (int)fmax(floor(xmin), 0); x < W && x < xmax; x++) {
+      m = __clip(pts, n, a, 0, x, 1);
+      m = __clip(a, m, b, 0, x + 1, -1);
+      m = __clip(b, m, a, 1, y, 1);
+      m = __clip(a, m, b, 1, y + 1, -1);
+      c = (m >= 3) ? __area(b, m) : 0;
+      img[y * W + x] = (uint8_t)floor(fmin(c, 1.0) * 255 + 0.5);
+    }
+  }
+}
+
+/*
+* emWinÿطֳfactor x factorءֻɨεӾΣ
+* ÿɨߵĽ㲢򣬰㻷ưѽ֮ؼ
+* @return:
+*/
+static void __fill_ss(PointType const* pts, int n, int factor, uint8_t* img)
+{
+  static uint16_t acc[W];
+  double xs[MAX_POINTS], ymin = 1e9, ymax = -1e9, xmin = 1e9, xmax = -1e9, sy, x;
+  int dir[MAX_POINTS], d, wn, x0, x1, y0, y1, y, j, i, k, m, s0, s1;
+  PointType const *a, *b;
+
+  memset(img, 0, W * H);
+  for (i = 0; i < n; i++) {
+    xmin = fmin(xmin, pts[i].x);
+    xmax = fmax(xmax, pts[i].x);
+    ymin = fmin(ymin, pts[i].y);
+    ymax = fmax(ymax, pts[i].y);
+  }
+  x0 = (int)fmax(floor(xmin), 0);
+  x1 = (int)fmin(ceil(xmax), W);
+  y0 = (int)fmax(floor(ymin), 0);
+  y1 = (int)fmin(ceil(ymax), H);
+  for (y = y0; y < y1; y++) {
+    memset(acc + x0, 0, (x1 - x0) * sizeof(acc[0]));
+    for (j = 0; j < factor; j++) {
+      sy = y + (j + 0.5) / factor;
+      // 㰴xͬʱ±ߵķ
+      for (i = m = 0; i < n; i++) {
+        a = &pts[i];
+        b = &pts[(i + 1) % n];
+        if (a->y <= sy && b->y > sy)
+          d = 1;
+        else if (b->y <= sy && a->y > sy)
+          d = -1;
+        else
+          continue;
+        x = a->x + (sy - a->y) * (b->x - a->x) / (b->y - a->y);
+        for (k = m++; k > 0 && xs[k - 1] > x; k--) {
+          xs[k] = xs[k - 1];
+          dir[k] = dir[k - 1];
+        }
+        xs[k] = x;
+        dir[k] = d;
+      }
+      // [xs[k],xs[k+1])ļ
+      for (k = wn = 0; k + 1 < m; k++) {
+        wn += dir[k];
+        if (wn == 0)
+          continue;
+        s0 = (int)fmax(ceil(xs[k] * factor - 0.5), x0 * factor);
+        s1 = (int)fmin(ceil(xs[k + 1] * factor - 0.5), x1 * factor);
+        for (i = s0; i < s1; i++)
+          acc[i / factor]++;
+      }
+    }
+    for (i = x0; i < x1; i++)
+      img[y * W + i] = (uint8_t)((acc[i] * 255 + factor * factor / 2) / (factor * factor));
+  }
+}
+
+static void __diff(uint8_t const* a, uint8_t const* b, int* pmax, double* psum)
+{
+  int i, d;
+
+  for (i = 0; i < W * H; i++) {
+    d = abs((int)a[i] - (int)b[i]);
+    if (d > *pmax)
+      *pmax = d;
+    *psum += d;
+  }
+}
+
+static double __rand(void)
+{
+  return rand() / (RAND_MAX + 1.0);
+}
+
+/*
+* (ǶźõĶ㣬Ǽ򵥶)kindѡϸС顢
+* ֳȼ
+* @return: 
+*/
+static int __random_poly(PointType* p, int kind)
+{
+  double cx, cy, r, a, a0, len, wid;
+  int i, n;
+
+  switch (kind) {
+  case 0:   // 
+  default:
+    n = 3 + rand() % (MAX_POINTS - 3);
+    cx = __rand() * W;
+    cy = __rand() * H;
+    r = 2 + __rand() * 60;
+    a0 = __rand() * 6.2832;
+    for (i = 0; i < n; i++) {
+      a = a0 + 6.2832 * (i + __rand() * 0.9) / n;
+      p[i].x = cx + cos(a) * r * (0.2 + __rand() * 0.8);
+      p[i].y = cy + sin(a) * r * (0.2 + __rand() * 0.8);
+    }
+    return n;
+  case 1:   // ϸ
+  case 2:   // С
+    cx = 10 + __rand() * (W - 20);
+    cy = 10 + __rand() * (H - 20);
+    a = __rand() * 6.2832;
+    len = (kind == 1) ? 5 + __rand() * 60 : __rand() * 0.9;
+    wid = (kind == 1) ? 0.05 + __rand() * 1.5 : __rand() * 0.9;
+    p[0].x = cx;
+    p[0].y = cy;
+    p[1].x = cx + cos(a) * len;
+    p[1].y = cy + sin(a) * len;
+    p[2].x = p[1].x - sin(a) * wid;
+    p[2].y = p[1].y + cos(a) * wid;
+    p[3].x = cx - sin(a) * wid;
+    p[3].y = cy + cos(a) * wid;
+    return 4;
+  }
+}
+
+// GUIDEMO_Speedometerָ(Ŵ6)תaͼм
+static int __needle(PointType* p, double a)
+{
+  static const int aNeedle[][2] = {
+    { 6 * 10, -10 }, { 6 * 75, -3 }, { 6 * 65, 0 }, { 6 * 75, 3 }, { 6 * 10, 10 },
+  };
+  int i, n = sizeof(aNeedle) / sizeof(aNeedle[0]);
+
+  for (i = 0; i < n; i++) {
+    p[i].x = W / 2 + (aNeedle[i][0] * cos(a) + aNeedle[i][1] * sin(a)) / 6.0;
+    p[i].y = H / 2 + (-aNeedle[i][0] * sin(a) + aNeedle[i][1] * cos(a)) / 6.0;
+  }
+  return n;
+}
+
+static int __write_pgm(char const* prefix, char const* name, uint8_t const* img)
+{
+  char path[256];
+  FILE* fp;
+
+  snprintf(path, sizeof(path), "%s_%s.pgm", prefix, name);
+  fp = fopen(path, "wb");
+  if (fp == NULL) {
+    fprintf(stderr, "aa_poly: can't write %s\n", path);
+    return -1;
+  }
+  fprintf(fp, "P5\n%d %d\n255\n", W, H);
+  fwrite(img, 1, W * H, fp);
+  fclose(fp);
+  return 0;
+}
+
+static double __now(void)
+{
+  return (double)clock() / CLOCKS_PER_SEC;
+}
+
+/*
+* ȶһΣݲʱӡ
+* @return: 0ͨ-1ʧ
+*/
+static int __check(char const* name, int idx, PointType const* p, int n, int tol, int* pmax, double* psum)
+{
+  int max = 0, i;
+
+  __fill_fix(p, n, _fix);
+  __fill_ref(p, n, _ref);
+  __diff(_fix, _ref, &max, psum);
+  if (max > *pmax)
+    *pmax = max;
+  if (max <= tol)
+    return 0;
+  printf("FAIL %s #%d: max diff %d, %d points:", name, idx, max, n);
+  for (i = 0; i < n; i++)
+    printf(" (%.4f,%.4f)", p[i].x, p[i].y);
+  printf("\n");
+  return -1;
+}
+
+static int __test(int count, int tol)
+{
+  static char const* const names[] = { "star", "sliver", "subpixel", "clipped" };
+  PointType p[MAX_POINTS];
+  int kind, i, j, n, max, bad = 0;
+  double sum;
+
+  for (kind = 0; kind < 4; kind++) {
+    max = 0;
+    sum = 0;
+    for (i = 0; i < count; i++) {
+      n = __random_poly(p, (kind == 3) ? 0 : kind);
+      if (kind == 3) {
+        for (j = 0; j < n; j++) {
+          p[j].x = p[j].x * 2 - W / 2;
+          p[j].y = p[j].y * 2 - H / 2;
+        }
+      }
+      bad += (__check(names[kind], i, p, n, tol, &max, &sum) != 0);
+    }
+    printf("%-9s %5d polygons  max diff %3d  mean %.4f\n", names[kind], count, max, sum / ((double)count * W * H));
+  }
+  max = 0;
+  sum = 0;
+  for (i = 0; i <= 240; i++) {
+    n = __needle(p, (210 - i) * 3.14159265 / 180);
+    bad += (__check("needle", i, p, n, tol, &max, &sum) != 0);
+  }
+  printf("%-9s %5d angles    max diff %3d  mean %.4f\n", "needle", 241, max, sum / (241.0 * W * H));
+  return bad;
+}
+
+/*
+* ǱָԱȶɨemWinʽزʱ
+* @return:
+*/
+static void __bench(void)
+{
+  static const int afactor[] = { 2, 3, 4, 6, 8 };
+  PointType p[MAX_POINTS];
+  double t0, t;
+  int i, k, n, max;
+  double sum;
+
+  t0 = __now();
+  for (i = 0; i <= 240; i++) {
+    n = __needle(p, (210 - i) * 3.14159265 / 180);
+    __fill_fix(p, n, _fix);
+  }
+  t = __now() - t0;
+  printf("fixed     %8.1f us/needle\n", t * 1e6 / 241);
+  for (k = 0; k < (int)(sizeof(afactor) / sizeof(afactor[0])); k++) {
+    max = 0;
+    sum = 0;
+    t = 0;
+    for (i = 0; i <= 240; i += 8) {
+      n = __needle(p, (210 - i) * 3.14159265 / 180);
+      __fill_ref(p, n, _ref);
+      t0 = __now();
+      __fill_ss(p, n, afactor[k], _fix);
+      t += __now() - t0;
+      __diff(_fix, _ref, &max, &sum);
+    }
+    printf("factor %d  %8.1f us/needle  max diff %3d  mean %.4f\n", afactor[k], t * 1e6 / 31, max, sum / (31.0 * W * H));
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  char const* prefix = NULL;
+  PointType p[MAX_POINTS];
+  uint8_t diff[W * H];
+  int i, n, test = 0, count = 500, tol = 2, bad;
+
+  for (i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-t"))
+      test = 1;
+    else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+      count = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+      srand((unsigned)atoi(argv[++i]));
+    else if (!strcmp(argv[i], "-e") && i + 1 < argc)
+      tol = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-p") && i + 1 < argc)
+      prefix = argv[++i];
+    else {
+      fprintf(stderr, "usage: aa_poly [-t] [-n count] [-s seed] [-e tolerance] [-p prefix]\n");
+      return 2;
+    }
+  }
+  if (prefix != NULL) {
+    n = __needle(p, 30 * 3.14159265 / 180);
+    __fill_fix(p, n, _fix);
+    __fill_ref(p, n, _ref);
+    for (i = 0; i < W * H; i++)
+      diff[i] = (uint8_t)(abs((int)_fix[i] - (int)_ref[i]) * 32 > 255 ? 255 : abs((int)_fix[i] - (int)_ref[i]) * 32);
+    if (__write_pgm(prefix, "fix", _fix) || __write_pgm(prefix, "ref", _ref) || __write_pgm(prefix, "diff", diff))
+      return 1;
+  }
+  __bench();
+  if (!test)
+    return 0;
+  bad = __test(count, tol);
+  printf("%s: %d failed\n", bad ? "FAIL" : "PASS", bad);
+  return bad ? 1 : 0;
+}
@@ -0,0 +1,969 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+////////////////////////////////////////////////////////////////////////////////
+// ͼƬԴߣPNG(emWinGUI_DRAW_BMP8888 C)ָ
+// ʽѹһԴ(ʽGUI_AssetDec.h)ơC±ͷļ
+// ֱӱ̼GUI_AssetDec.c-tʱԭͼȽϡ
+//
+// 룺gcc -O2 -I../../users/task-gui -o asset_pack asset_pack.c ../../users/task-gui/GUI_AssetDec.c
+// ÷asset_pack [-o assets.bin] [-c assets.c] [-H assets.h] [-n ] [-t] =ʽ:ļ[@] ...
+//   ʽraw argb pal premul 565a8 auto(argbpalȡСʽ)
+//   ļ.pngΪPNG(8λ).cΪCԴļȡΪ""unsigned long飬
+//         ȡGUI_BITMAPrawʽԭļ(JPEG/GIF/BMP/PNG/emWinλͼ)
+//   -n Cķȱʡasset_dataͷļ±Ϊ"_"Ĵд
+//   -t ضУ飬argb/pal/premulҪһ£565a8ÿͨ7
+// asset_pack -c GUIDEMO_ZoomAssets.c -H GUIDEMO_ZoomAssets.h -n GUIDEMO_ZoomAssets -t logo=auto:GUIDEMO_ZoomAndRotate.c@_acSeggerLogo_300x181
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+#include "GUI_AssetDec.h"
+
+#define MAX_ASSETS    (256)
+
+typedef struct {
+  char name[ASSET_NAME_MAX];
+  int format;                 // ASSET_FMT_xxx-1Ϊauto
+  int width, height;
+  uint32_t* pix;              // M8888IRAWΪNULL
+  uint8_t* data;              // 
+  uint32_t size;
+  uint32_t srcsize;           // δѹֽ
+  int ncolors;
+  int flags;
+} AssetSrcType;
+
+static AssetSrcType _assets[MAX_ASSETS];
+static int _nassets = 0;
+
+static void __put16(uint8_t* p, uint32_t v)
+{
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void __put32(uint8_t* p, uint32_t v)
+{
+  __put16(p, v);
+  __put16(p + 2, v >> 16);
+}
+
+static uint32_t __get32be(uint8_t const* p)
+{
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static uint8_t* __load(char const* path, uint32_t* size)
+{
+  FILE* fp;
+  uint8_t* buf;
+  long n;
+
+  fp = fopen(path, "rb");
+  if (fp == NULL)
+    return NULL;
+  fseek(fp, 0, SEEK_END);
+  n = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  buf = (uint8_t*)malloc((size_t)n + 1);
+  if (buf != NULL && fread(buf, 1, (size_t)n, fp) != (size_t)n) {
+    free(buf);
+    buf = NULL;
+  }
+  fclose(fp);
+  if (buf != NULL) {
+    buf[n] = 0;
+    *size = (uint32_t)n;
+  }
+  return buf;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// inflate(RFC1951)ֻڶPNG׷ٶ
+typedef struct {
+  uint8_t const* in;
+  uint32_t inlen, pos;
+  uint32_t bitbuf, bitcnt;
+  uint8_t* out;
+  uint32_t outlen, outmax;
+} InflateType;
+
+typedef struct {
+  uint16_t count[16];
+  uint16_t symbol[288];
+} HuffType;
+
+static int __bits(InflateType* s, int n)
+{
+  uint32_t v;
+
+  while (s->bitcnt < (uint32_t)n) {
+    if (s->pos >= s->inlen)
+      return -1;
+    s->bitbuf |= (uint32_t)s->in[s->pos++] << s->bitcnt;
+    s->bitcnt += 8;
+  }
+  v = s->bitbuf & ((1UL << n) - 1);
+  s->bitbuf >>= n;
+  s->bitcnt -= (uint32_t)n;
+  return (int)v;
+}
+
+static void __huff_build(HuffType* h, uint8_t const* len, int n)
+{
+  uint16_t offs[16];
+  int i;
+
+  memset(h->count, 0, sizeof(h->count));
+  for (i = 0; i < n; i++)
+    h->count[len[i]]++;
+  h->count[0] = 0;
+  offs[1] = 0;
+  for (i = 1; i < 15; i++)
+    offs[i + 1] = offs[i] + h->count[i];
+  for (i = 0; i < n; i++) {
+    if (len[i])
+      h->symbol[offs[len[i]]++] = (uint16_t)i;
+  }
+}
+
+static int __huff_decode(InflateType* s, HuffType const* h)
+{
+  int code = 0, first = 0, index = 0, len, b;
+
+  for (len = 1; len < 16; len++) {
+    b = __bits(s, 1);
+    if (b < 0)
+      return -1;
+    code |= b;
+    if (code - h->count[len] < first)
+      return h->symbol[index + (code - first)];
+    index += h->count[len];
+    first += h->count[len];
+    first <<= 1;
+    code <<= 1;
+  }
+  return -1;
+}
+
+static int __emit(InflateType* s, uint8_t c)
+{
+  if (s->outlen >= s->outmax)
+    return -1;
+  s->out[s->outlen++] = c;
+  return 0;
+}
+
+static int __inflate_block(InflateType* s, HuffType const* lit, HuffType const* dist)
+{
+  static const uint16_t lbase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+  static const uint8_t lext[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+  static const uint16_t dbase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+  static const uint8_t dext[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+  int sym, len, d, e;
+
+  for (;;) {
+    sym = __huff_decode(s, lit);
+    if (sym < 0)
+      return -1;
+    if (sym < 256) {
+      if (__emit(s, (uint8_t)sym) != 0)
+        return -1;
+      continue;
+    }
+    if (sym == 256)
+      return 0;
+    sym -= 257;
+    if (sym >= 29)
+      return -1;
+    e = __bits(s, lext[sym]);
+    if (e < 0)
+      return -1;
+    len = lbase[sym] + e;
+    sym = __huff_decode(s, dist);
+    if (sym < 0 || sym >= 30)
+      return -1;
+    e = __bits(s, dext[sym]);
+    if (e < 0)
+      return -1;
+    d = dbase[sym] + e;
+    if ((uint32_t)d > s->outlen)
+      return -1;
+    while (len--) {
+      if (__emit(s, s->out[s->outlen - d]) != 0)
+        return -1;
+    }
+  }
+}
+
+static int __inflate_dynamic(InflateType* s)
+{
+  static const uint8_t order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+  uint8_t len[320];
+  HuffType lit, dist;
+  int nlen, ndist, ncode, i, sym, rep, v;
+
+  nlen = __bits(s, 5) + 257;
+  ndist = __bits(s, 5) + 1;
+  ncode = __bits(s, 4) + 4;
+  if (ncode < 4 || nlen > 286 || ndist > 30)
+    return -1;
+  memset(len, 0, sizeof(len));
+  for (i = 0; i < ncode; i++) {
+    v = __bits(s, 3);
+    if (v < 0)
+      return -1;
+    len[order[i]] = (uint8_t)v;
+  }
+  __huff_build(&lit, len, 19);
+  for (i = 0; i < nlen + ndist;) {
+    sym = __huff_decode(s, &lit);
+    if (sym < 0)
+      return -1;
+    if (sym < 16) {
+      len[i++] = (uint8_t)sym;
+      continue;
+    }
+    if (sym == 16) {
+      if (i == 0)
+        return -1;
+      v = len[i - 1];
+      rep = 3 + __bits(s, 2);
+    } else if (sym == 17) {
+      v = 0;
+      rep = 3 + __bits(s, 3);
+    } else {
+      v = 0;
+      rep = 11 + __bits(s, 7);
+    }
+    if (i + rep > nlen + ndist)
+      return -1;
+    while (rep--)
+      len[i++] = (uint8_t)v;
+  }
+  __huff_build(&lit, len, nlen);
+  __huff_build(&dist, len + nlen, ndist);
+  return __inflate_block(s, &lit, &dist);
+}
+
+static int __inflate_fixed(InflateType* s)
+{
+  uint8_t len[320];
+  HuffType lit, dist;
+  int i;
+
+  for (i = 0; i < 144; i++)
+    len[i] = 8;
+  for (; i < 256; i++)
+    len[i] = 9;
+  for (; i < 280; i++)
+    len[i] = 7;
+  for (; i < 288; i++)
+    len[i] = 8;
+  __huff_build(&lit, len, 288);
+  for (i = 0; i < 30; i++)
+    len[i] = 5;
+  __huff_build(&dist, len, 30);
+  return __inflate_block(s, &lit, &dist);
+}
+
+/*
+* zlib(2ֽͷУadler32)
+* @return: ֽʧܷ-1
+*/
+static long __inflate(uint8_t const* in, uint32_t inlen, uint8_t* out, uint32_t outmax)
+{
+  InflateType s;
+  int last, type, r;
+  uint32_t n;
+
+  if (inlen < 2 || (in[0] & 0x0f) != 8)
+    return -1;
+  memset(&s, 0, sizeof(s));
+  s.in = in;
+  s.inlen = inlen;
+  s.pos = 2;
+  s.out = out;
+  s.outmax = outmax;
+  do {
+    last = __bits(&s, 1);
+    type = __bits(&s, 2);
+    if (last < 0 || type < 0)
+      return -1;
+    if (type == 0) {
+      s.bitbuf = 0;
+      s.bitcnt = 0;
+      if (s.pos + 4 > s.inlen)
+        return -1;
+      n = (uint32_t)s.in[s.pos] | ((uint32_t)s.in[s.pos + 1] << 8);
+      s.pos += 4;
+      if (s.pos + n > s.inlen || s.outlen + n > s.outmax)
+        return -1;
+      memcpy(s.out + s.outlen, s.in + s.pos, n);
+      s.pos += n;
+      s.outlen += n;
+      r = 0;
+    } else if (type == 1) {
+      r = __inflate_fixed(&s);
+    } else if (type == 2) {
+      r = __inflate_dynamic(&s);
+    } else {
+      r = -1;
+    }
+    if (r != 0)
+      return -1;
+  } while (!last);
+  return (long)s.outlen;
+}
+
+static int __paeth(int a, int b, int c)
+{
+  int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+
+  if (pa <= pb && pa <= pc)
+    return a;
+  return (pb <= pc) ? b : c;
+}
+
+/*
+* 8λеPNGתΪM8888I(A=0xFFΪȫ͸)
+* @return: ʧܷNULL
+*/
+static uint32_t* __read_png(char const* path, int* w, int* h)
+{
+  static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+  static const int channels[7] = {1, 0, 3, 1, 2, 0, 4};
+  uint8_t *file, *z = NULL, *raw = NULL, *p, *prev, *cur;
+  uint32_t size, pos, len, zlen = 0, pal[256], stride, i, a, r, g, b;
+  uint32_t* pix = NULL;
+  int type = -1, depth = 0, bpp, x, y, f, left, up, ul;
+  int trns_gray = -1, trns_r = -1, trns_g = -1, trns_b = -1;
+
+  file = __load(path, &size);
+  if (file == NULL || size < 8 || memcmp(file, sig, 8)) {
+    free(file);
+    return NULL;
+  }
+  for (i = 0; i < 256; i++)
+    pal[i] = 0xff000000UL;
+  for (pos = 8; pos + 12 <= size; pos += len + 12) {
+    len = __get32be(file + pos);
+    p = file + pos + 8;
+    if (pos + 12 + len > size)
+      break;
+    if (!memcmp(file + pos + 4, "IHDR", 4) && len >= 13) {
+      *w = (int)__get32be(p);
+      *h = (int)__get32be(p + 4);
+      depth = p[8];
+      type = p[9];
+      if (depth != 8 || type > 6 || channels[type] == 0 || p[12] != 0) {
+        fprintf(stderr, "asset_pack: %s: only 8-bit non-interlaced PNG is supported\n", path);
+        type = -1;
+        break;
+      }
+    } else if (!memcmp(file + pos + 4, "PLTE", 4)) {
+      for (i = 0; i < len / 3 && i < 256; i++)
+        pal[i] = ((uint32_t)p[i * 3] << 16) | ((uint32_t)p[i * 3 + 1] << 8) | p[i * 3 + 2];
+    } else if (!memcmp(file + pos + 4, "tRNS", 4)) {
+      if (type == 3) {
+        for (i = 0; i < len && i < 256; i++)
+          pal[i] = (pal[i] & 0x00ffffffUL) | ((uint32_t)(255 - p[i]) << 24);
+      } else if (type == 0 && len >= 2) {
+        trns_gray = p[1];
+      } else if (type == 2 && len >= 6) {
+        trns_r = p[1];
+        trns_g = p[3];
+        trns_b = p[5];
+      }
+    } else if (!memcmp(file + pos + 4, "IDAT", 4)) {
+      z = (uint8_t*)realloc(z, zlen + len);
+      memcpy(z + zlen, p, len);
+      zlen += len;
+    } else if (!memcmp(file + pos + 4, "IEND", 4)) {
+      break;
+    }
+  }
+  if (type < 0 || z == NULL || *w <= 0 || *h <= 0)
+    goto done;
+
+  bpp = channels[type];
+  stride = (uint32_t)*w * bpp;
+  raw = (uint8_t*)malloc((stride + 1) * *h);
+  if (raw == NULL || __inflate(z, zlen, raw, (stride + 1) * *h) != (long)((stride + 1) * *h))
+    goto done;
+  prev = NULL;
+  for (y = 0; y < *h; y++) {
+    cur = raw + y * (stride + 1) + 1;
+    f = cur[-1];
+    for (i = 0; i < stride; i++) {
+      left = (i >= (uint32_t)bpp) ? cur[i - bpp] : 0;
+      up = prev ? prev[i] : 0;
+      ul = (prev && i >= (uint32_t)bpp) ? prev[i - bpp] : 0;
+      if (f == 1)
+        cur[i] = (uint8_t)(cur[i] + left);
+      else if (f == 2)
+        cur[i] = (uint8_t)(cur[i] + up);
+      else if (f == 3)
+        cur[i] = (uint8_t)(cur[i] + ((left + up) >> 1));
+      else if (f == 4)
+        cur[i] = (uint8_t)(cur[i] + __paeth(left, up, ul));
+      else if (f != 0)
+        goto done;
+    }
+    prev = cur;
+  }
+
+  pix = (uint32_t*)malloc((size_t)*w * *h * 4);
+  for (y = 0; pix && y < *h; y++) {
+    cur = raw + y * (stride + 1) + 1;
+    for (x = 0; x < *w; x++, cur += bpp) {
+      a = 255;
+      switch (type) {
+      case 0:
+        r = g = b = cur[0];
+        if (cur[0] == trns_gray)
+          a = 0;
+        break;
+      case 2:
+        r = cur[0];
+        g = cur[1];
+        b = cur[2];
+        if ((int)r == trns_r && (int)g == trns_g && (int)b == trns_b)
+          a = 0;
+        break;
+      case 3:
+        pix[y * *w + x] = pal[cur[0]];
+        continue;
+      case 4:
+        r = g = b = cur[0];
+        a = cur[1];
+        break;
+      default:
+        r = cur[0];
+        g = cur[1];
+        b = cur[2];
+        a = cur[3];
+        break;
+      }
+      pix[y * *w + x] = ((255 - a) << 24) | (r << 16) | (g << 8) | b;
+    }
+  }
+done:
+  free(file);
+  free(z);
+  free(raw);
+  return pix;
+}
+
+// հסź//עͣȡһ
+static long __next_int(char** s)
+{
+  while (**s && !isdigit((unsigned char)**s)) {
+    if ((*s)[0] == '/' && (*s)[1] == '/') {
+      while (**s && **s != '\n')
+        (*s)++;
+    } else {
+      (*s)++;
+    }
+  }
+  return strtol(*s, s, 0);
+}
+
+/*
+* emWinCļȡΪsymunsigned long飬ȡGUI_BITMAP
+* @return: ʧܷNULL
+*/
+static uint32_t* __read_carray(char const* path, char const* sym, int* w, int* h)
+{
+  uint8_t* file;
+  char *s, *e, *ref, key[128];
+  uint32_t size, n = 0;
+  uint32_t* pix;
+
+  file = __load(path, &size);
+  if (file == NULL)
+    return NULL;
+  snprintf(key, sizeof(key), "%s[] = {", sym);
+  s = strstr((char*)file, key);
+  snprintf(key, sizeof(key), "(unsigned char *)%s", sym);
+  ref = strstr((char*)file, key);
+  if (s == NULL || ref == NULL) {
+    free(file);
+    return NULL;
+  }
+  // GUI_BITMAPǰΪXSizeYSize
+  for (e = ref; e > (char*)file && *e != '{'; e--)
+    ;
+  *w = (int)__next_int(&e);
+  *h = (int)__next_int(&e);
+  pix = (*w > 0 && *h > 0) ? (uint32_t*)malloc((size_t)*w * *h * 4) : NULL;
+  for (s = strchr(s, '{') + 1; pix && *s && *s != '}';) {
+    if (isxdigit((unsigned char)*s)) {
+      if (n >= (uint32_t)(*w * *h))
+        break;
+      pix[n++] = (uint32_t)strtoul(s, &s, 0);
+    } else {
+      s++;
+    }
+  }
+  free(file);
+  if (pix && n != (uint32_t)(*w * *h)) {
+    fprintf(stderr, "asset_pack: %s: %s has %u pixels, expected %dx%d\n", path, sym, n, *w, *h);
+    free(pix);
+    pix = NULL;
+  }
+  return pix;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// 룬GUI_AssetDec.cĽӦ
+static uint32_t __to_premul(uint32_t c)
+{
+  uint32_t a = 255 - (c >> 24), r, g, b;
+
+  if (a == 255)
+    return 0xff000000UL | (c & 0x00ffffffUL);
+  if (a == 0)
+    return 0;
+  r = (((c >> 16) & 0xff) * a + 127) / 255;
+  g = (((c >> 8) & 0xff) * a + 127) / 255;
+  b = ((c & 0xff) * a + 127) / 255;
+  return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+// ȫ͸صɫû壬ͳһһֵRLE
+static uint32_t __canon(uint32_t c)
+{
+  return ((c >> 24) == 0xff) ? 0xff000000UL : c;
+}
+
+static uint8_t* __put_value(uint8_t* p, uint32_t v, int bytes)
+{
+  while (bytes--) {
+    *p++ = (uint8_t)v;
+    v >>= 8;
+  }
+  return p;
+}
+
+/*
+* RLEbit7=1Ϊ(t&0x7f)+1ֵͬΪ(t&0x7f)+1ֵÿֵbytesֽ
+* @return: ѹֽ
+*/
+static uint32_t __rle(uint32_t const* v, uint32_t n, int bytes, uint8_t* out)
+{
+  uint8_t* p = out;
+  uint32_t i = 0, k, lit;
+
+  while (i < n) {
+    for (k = 1; i + k < n && k < 128 && v[i + k] == v[i]; k++)
+      ;
+    if (k >= 2) {
+      *p++ = (uint8_t)(0x80 | (k - 1));
+      p = __put_value(p, v[i], bytes);
+      i += k;
+      continue;
+    }
+    for (lit = 1; i + lit < n && lit < 128; lit++) {
+      if (i + lit + 1 < n && v[i + lit] == v[i + lit + 1])
+        break;
+    }
+    *p++ = (uint8_t)(lit - 1);
+    for (k = 0; k < lit; k++)
+      p = __put_value(p, v[i + k], bytes);
+    i += lit;
+  }
+  return (uint32_t)(p - out);
+}
+
+static uint32_t __encode_argb(AssetSrcType* a, int premul, uint8_t* out)
+{
+  uint32_t i, n = (uint32_t)(a->width * a->height), size;
+  uint32_t* tmp = (uint32_t*)malloc(n * 4);
+
+  for (i = 0; i < n; i++)
+    tmp[i] = premul ? __to_premul(a->pix[i]) : __canon(a->pix[i]);
+  size = __rle(tmp, n, 4, out);
+  free(tmp);
+  return size;
+}
+
+/*
+* ɫ+±RLE256ɫ0
+*/
+static uint32_t __encode_pal(AssetSrcType* a, uint8_t* out)
+{
+  uint32_t pal[256], i, k, c, n = (uint32_t)(a->width * a->height), size;
+  uint32_t* idx = (uint32_t*)malloc(n * 4);
+  uint8_t* p = out;
+  int ncolors = 0;
+
+  for (i = 0; i < n; i++) {
+    c = __canon(a->pix[i]);
+    for (k = 0; k < (uint32_t)ncolors && pal[k] != c; k++)
+      ;
+    if (k == (uint32_t)ncolors) {
+      if (ncolors == 256) {
+        free(idx);
+        return 0;
+      }
+      pal[ncolors++] = c;
+    }
+    idx[i] = k;
+  }
+  for (k = 0; k < (uint32_t)ncolors; k++)
+    p = __put_value(p, pal[k], 4);
+  size = __rle(idx, n, 1, p);
+  free(idx);
+  a->ncolors = ncolors;
+  return (uint32_t)(p - out) + size;
+}
+
+static uint32_t __encode_565a8(AssetSrcType* a, uint8_t* out)
+{
+  uint8_t* p = out;
+  uint32_t c;
+  int x, y;
+
+  for (y = 0; y < a->height; y++) {
+    for (x = 0; x < a->width; x++) {
+      c = a->pix[y * a->width + x];
+      c = ((c >> 8) & 0xf800) | ((c >> 5) & 0x07e0) | ((c >> 3) & 0x001f);
+      p = __put_value(p, c, 2);
+    }
+    for (x = 0; x < a->width; x++)
+      *p++ = (uint8_t)(255 - (a->pix[y * a->width + x] >> 24));
+  }
+  return (uint32_t)(p - out);
+}
+
+static char const* _fmtnames[ASSET_FMT_NUM] = {"raw", "argb", "pal", "premul", "565a8"};
+
+static int __encode(AssetSrcType* a)
+{
+  uint32_t n = (uint32_t)(a->width * a->height), size, i;
+  uint8_t* buf;
+
+  // ȫΪأÿ1281ֽڣӵɫ
+  buf = (uint8_t*)malloc(n * 5 + 1024 + 1);
+  if (buf == NULL)
+    return -1;
+  a->srcsize = n * 4;
+  for (i = 0; i < n; i++) {
+    if (a->pix[i] >> 24)
+      a->flags |= ASSET_FLAG_ALPHA;
+  }
+  if (a->format < 0) {
+    a->format = ASSET_FMT_ARGB_RLE;
+    a->size = __encode_argb(a, 0, buf);
+    size = __encode_pal(a, buf);
+    if (size != 0 && size < a->size)
+      a->format = ASSET_FMT_PAL_RLE;
+  }
+  switch (a->format) {
+  case ASSET_FMT_ARGB_RLE:
+    a->size = __encode_argb(a, 0, buf);
+    break;
+  case ASSET_FMT_PREMUL_RLE:
+    a->size = __encode_argb(a, 1, buf);
+    break;
+  case ASSET_FMT_PAL_RLE:
+    a->size = __encode_pal(a, buf);
+    if (a->size == 0) {
+      fprintf(stderr, "asset_pack: %s has more than 256 colors\n", a->name);
+      free(buf);
+      return -1;
+    }
+    break;
+  default:
+    a->size = __encode_565a8(a, buf);
+    break;
+  }
+  if (a->format != ASSET_FMT_PAL_RLE)
+    a->ncolors = 0;
+  a->data = buf;
+  return 0;
+}
+
+/*
+* "=ʽ:ļ[@]"
+* @return: 0ɹ
+*/
+static int __add(char* spec)
+{
+  AssetSrcType* a = &_assets[_nassets];
+  char *fmt, *path, *sym, *ext;
+  int i;
+
+  fmt = strchr(spec, '=');
+  path = fmt ? strchr(fmt, ':') : NULL;
+  if (path == NULL || _nassets >= MAX_ASSETS || fmt - spec >= ASSET_NAME_MAX || fmt == spec)
+    return -1;
+  *fmt++ = 0;
+  *path++ = 0;
+  memset(a, 0, sizeof(*a));
+  strcpy(a->name, spec);
+  a->format = -1;
+  for (i = 0; i < ASSET_FMT_NUM; i++) {
+    if (!strcmp(fmt, _fmtnames[i]))
+      a->format = i;
+  }
+  if (a->format < 0 && strcmp(fmt, "auto"))
+    return -1;
+
+  sym = strchr(path, '@');
+  if (sym != NULL)
+    *sym++ = 0;
+  if (a->format == ASSET_FMT_RAW) {
+    a->data = __load(path, &a->size);
+    a->srcsize = a->size;
+  } else {
+    ext = strrchr(path, '.');
+    if (ext && !strcmp(ext, ".c") && sym)
+      a->pix = __read_carray(path, sym, &a->width, &a->height);
+    else if (ext && !strcmp(ext, ".png"))
+      a->pix = __read_png(path, &a->width, &a->height);
+    if (a->pix == NULL || a->width > ASSET_MAX_WIDTH || a->height > 0xffff) {
+      fprintf(stderr, "asset_pack: cannot read %s%s%s\n", path, sym ? "@" : "", sym ? sym : "");
+      return -1;
+    }
+    if (__encode(a) != 0)
+      return -1;
+  }
+  if (a->data == NULL) {
+    fprintf(stderr, "asset_pack: cannot read %s\n", path);
+    return -1;
+  }
+  _nassets++;
+  return 0;
+}
+
+static uint8_t* __build(uint32_t* total)
+{
+  uint32_t off, i;
+  uint8_t *arc, *e;
+
+  off = 16 + (uint32_t)_nassets * 32;
+  for (i = 0; i < (uint32_t)_nassets; i++)
+    off = ((off + 3) & ~3UL) + _assets[i].size;
+  arc = (uint8_t*)calloc(1, off);
+  *total = off;
+  __put32(arc + 0, ASSET_MAGIC);
+  __put16(arc + 4, ASSET_VERSION);
+  __put16(arc + 6, (uint32_t)_nassets);
+  __put32(arc + 8, *total);
+
+  off = 16 + (uint32_t)_nassets * 32;
+  for (i = 0; i < (uint32_t)_nassets; i++) {
+    off = (off + 3) & ~3UL;
+    e = arc + 16 + i * 32;
+    memcpy(e, _assets[i].name, strlen(_assets[i].name));
+    __put32(e + 16, off);
+    __put32(e + 20, _assets[i].size);
+    __put16(e + 24, (uint32_t)_assets[i].width);
+    __put16(e + 26, (uint32_t)_assets[i].height);
+    e[28] = (uint8_t)_assets[i].format;
+    e[29] = (uint8_t)_assets[i].flags;
+    __put16(e + 30, (uint32_t)_assets[i].ncolors);
+    memcpy(arc + off, _assets[i].data, _assets[i].size);
+    off += _assets[i].size;
+  }
+  return arc;
+}
+
+static int __same(uint32_t a, uint32_t b, int tol)
+{
+  int i, d;
+
+  if ((a >> 24) == 0xff && (b >> 24) == 0xff)
+    return 1;
+  for (i = 0; i < 32; i += 8) {
+    d = (int)((a >> i) & 0xff) - (int)((b >> i) & 0xff);
+    if (d > ((i == 24) ? 0 : tol) || -d > ((i == 24) ? 0 : tol))
+      return 0;
+  }
+  return 1;
+}
+
+/*
+* ù̼ĽԴԭͼȽ
+* @return: һµԴ
+*/
+static int __verify(uint8_t* data)
+{
+  static uint32_t line[ASSET_MAX_WIDTH];
+  static AssetDecoderType d;
+  AssetArchiveType arc;
+  AssetEntryType e;
+  AssetSrcType* a;
+  uint32_t want;
+  int i, x, y, premul, bad = 0;
+
+  if (ASSET_Open(&arc, ASSET_GetDataMem, data, 0) != 0 || arc.count != _nassets)
+    return _nassets;
+  for (i = 0; i < _nassets; i++) {
+    a = &_assets[i];
+    if (ASSET_GetEntry(&arc, i, &e) != 0 || strcmp(e.name, a->name) || e.size != a->size) {
+      fprintf(stderr, "asset_pack: %s: bad index entry\n", a->name);
+      bad++;
+      continue;
+    }
+    if (e.format == ASSET_FMT_RAW)
+      continue;
+    premul = (e.format == ASSET_FMT_PREMUL_RLE);
+    if (ASSET_DecodeBegin(&d, &arc, &e, premul ? ASSET_OUT_PREMUL : ASSET_OUT_M8888I) != 0) {
+      fprintf(stderr, "asset_pack: %s: decode failed\n", a->name);
+      bad++;
+      continue;
+    }
+    for (y = 0; y < a->height; y++) {
+      if (ASSET_DecodeLine(&d, line) != 0) {
+        fprintf(stderr, "asset_pack: %s: line %d truncated\n", a->name, y);
+        break;
+      }
+      for (x = 0; x < a->width; x++) {
+        want = a->pix[y * a->width + x];
+        if (premul ? (line[x] != __to_premul(want))
+                   : !__same(line[x], want, (e.format == ASSET_FMT_565A8) ? 7 : 0))
+          break;
+      }
+      if (x < a->width) {
+        fprintf(stderr, "asset_pack: %s: mismatch at (%d,%d) %08x != %08x\n",
+                a->name, x, y, line[x], want);
+        break;
+      }
+    }
+    if (y < a->height)
+      bad++;
+  }
+  return bad;
+}
+
+static void __write_cmdline(FILE* fp, int argc, char* argv[])
+{
+  int i;
+
+  fprintf(fp, "// tools/asset-packɣֹ޸ģ\n//  ");
+  for (i = 0; i < argc; i++)
+    fprintf(fp, " %s", argv[i]);
+  fprintf(fp, "\n");
+}
+
+static void __write_c(FILE* fp, uint8_t const* data, uint32_t size, char const* sym)
+{
+  uint32_t i;
+
+  fprintf(fp, "// Դ%uֽڣ%dԴ\n", size, _nassets);
+  fprintf(fp, "const unsigned char %s[%u] = {", sym, size);
+  for (i = 0; i < size; i++)
+    fprintf(fp, "%s0x%02x,", (i % 32) ? " " : "\n  ", data[i]);
+  fprintf(fp, "\n};\n");
+}
+
+static void __write_h(FILE* fp, char const* sym)
+{
+  char up[128];
+  int i, k;
+
+  for (k = 0; sym[k] && k < 63; k++)
+    up[k] = (char)toupper((unsigned char)sym[k]);
+  up[k] = 0;
+  fprintf(fp, "#ifndef __%s_H__\n#define __%s_H__\n\n", up, up);
+  fprintf(fp, "extern const unsigned char %s[];\n\n", sym);
+  for (i = 0; i < _nassets; i++) {
+    fprintf(fp, "#define %s_", up);
+    for (k = 0; _assets[i].name[k]; k++)
+      fputc(toupper((unsigned char)_assets[i].name[k]), fp);
+    fprintf(fp, "%*s(%d)   // %dx%d %s\n", (int)(20 - strlen(_assets[i].name)), "", i,
+            _assets[i].width, _assets[i].height, _fmtnames[_assets[i].format]);
+  }
+  fprintf(fp, "#define %s_NUM%*s(%d)\n\n#endif\n", up, 17, "", _nassets);
+}
+
+int main(int argc, char* argv[])
+{
+  char const *bin = NULL, *csrc = NULL, *hdr = NULL, *sym = "asset_data";
+  uint32_t total, raw = 0, packed = 0;
+  uint8_t* data;
+  int i, test = 0, bad;
+  FILE* fp;
+
+  for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+    if (!strcmp(argv[i], "-o") && i + 1 < argc)
+      bin = argv[++i];
+    else if (!strcmp(argv[i], "-c") && i + 1 < argc)
+      csrc = argv[++i];
+    else if (!strcmp(argv[i], "-H") && i + 1 < argc)
+      hdr = argv[++i];
+    else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+      sym = argv[++i];
+    else if (!strcmp(argv[i], "-t"))
+      test = 1;
+    else
+      break;
+  }
+  if (i >= argc) {
+    fprintf(stderr, "usage: asset_pack [-o assets.bin] [-c assets.c] [-H assets.h] [-n symbol] [-t] name=fmt:file[@array] ...\n");
+    fprintf(stderr, "       fmt: raw argb pal premul 565a8 auto\n");
+    return 2;
+  }
+  for (; i < argc; i++) {
+    if (__add(strdup(argv[i])) != 0) {
+      fprintf(stderr, "asset_pack: bad asset %s\n", argv[i]);
+      return 1;
+    }
+  }
+  data = __build(&total);
+
+  printf("%-16s %-7s %9s %9s %9s\n", "name", "format", "size", "raw", "packed");
+  for (i = 0; i < _nassets; i++) {
+    printf("%-16s %-7s %4dx%-4d %9u %9u %3u%%\n", _assets[i].name, _fmtnames[_assets[i].format],
+           _assets[i].width, _assets[i].height, _assets[i].srcsize, _assets[i].size,
+           (unsigned)(_assets[i].srcsize ? (uint64_t)_assets[i].size * 100 / _assets[i].srcsize : 100));
+    raw += _assets[i].srcsize;
+    packed += _assets[i].size;
+  }
+  printf("%-16s %-7s %9s %9u %9u, archive %u bytes\n", "total", "", "", raw, packed, total);
+
+  if (test) {
+    bad = __verify(data);
+    printf("asset_pack: verify %s\n", bad ? "FAILED" : "ok");
+    if (bad)
+      return 1;
+  }
+  if (bin != NULL) {
+    fp = fopen(bin, "wb");
+    if (fp == NULL) {
+      perror(bin);
+      return 1;
+    }
+    fwrite(data, 1, total, fp);
+    fclose(fp);
+  }
+  if (csrc != NULL) {
+    fp = fopen(csrc, "w");
+    if (fp == NULL) {
+      perror(csrc);
+      return 1;
+    }
+    __write_cmdline(fp, argc, argv);
+    __write_c(fp, data, total, sym);
+    fclose(fp);
+  }
+  if (hdr != NULL) {
+    fp = fopen(hdr, "w");
+    if (fp == NULL) {
+      perror(hdr);
+      return 1;
+    }
+    __write_cmdline(fp, argc, argv);
+    __write_h(fp, sym);
+    fclose(fp);
+  }
+  free(data);
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,112 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+////////////////////////////////////////////////////////////////////////////////
+// ɫģֱͣӱ̼fb-csc.c/Աȶ/
+// Ͷ/ɫ/ɾ󣬴ӡDEBEĴֵץ֡ͬĶ㣬
+// ͰĵĻȶԡ
+//
+// 룺gcc -O2 -I../../periph/include -o csc_model csc_model.c ../../periph/fb-csc.c
+// ÷csc_model [-b ] [-c Աȶ%] [-s Ͷ%] [-t R%,G%,B%] [-f 0~256]
+//                 [-w ] [-h ] [in.raw out.raw]
+//   in.rawΪXRGB8888֡(SIM_RAWֱãֻһ֡)
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fb-csc.h"
+
+// <fb-f1c100s.c>һ£ĴG/R/B
+static int const _map[3] = { 1, 0, 2 };
+
+static void __print_regs(ColorMatrixType const* cm)
+{
+  int r, c;
+
+  printf("output_color_ctrl = 0x%08x\n", CSC_IsIdentity(cm) ? 0 : 1);
+  for (r = 0; r < 3; r++) {
+    for (c = 0; c < 3; c++)
+      printf("output_color_coef[%2d] = 0x%04x\n", r * 4 + c, (unsigned)cm->m[_map[r]][_map[c]] & 0x1fff);
+    printf("output_color_coef[%2d] = 0x%04x\n", r * 4 + 3, (unsigned)cm->m[_map[r]][3] & 0x3fff);
+  }
+}
+
+static int __process(ColorMatrixType const* cm, char const* in, char const* out, int w, int h)
+{
+  size_t n = (size_t)w * h;
+  uint32_t* frame;
+  FILE* fp;
+
+  frame = (uint32_t*)malloc(n * 4);
+  if (frame == NULL)
+    return -1;
+  fp = fopen(in, "rb");
+  if (fp == NULL || fread(frame, 4, n, fp) != n) {
+    fprintf(stderr, "csc_model: cannot read %ux%u frame from %s\n", w, h, in);
+    if (fp)
+      fclose(fp);
+    free(frame);
+    return -1;
+  }
+  fclose(fp);
+  CSC_Apply(cm, frame, (uint32_t)n);
+  fp = fopen(out, "wb");
+  if (fp == NULL || fwrite(frame, 4, n, fp) != n) {
+    fprintf(stderr, "csc_model: cannot write %s\n", out);
+    if (fp)
+      fclose(fp);
+    free(frame);
+    return -1;
+  }
+  fclose(fp);
+  free(frame);
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  int32_t brightness = 0, contrast = 100, saturation = 100, fade = 256;
+  int32_t tr = 100, tg = 100, tb = 100;
+  int w = 480, h = 272;
+  ColorMatrixType cm;
+  int i, r;
+
+  for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+    if (i + 1 >= argc)
+      break;
+    if (!strcmp(argv[i], "-b"))
+      brightness = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-c"))
+      contrast = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-s"))
+      saturation = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-f"))
+      fade = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-w"))
+      w = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-h"))
+      h = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-t")) {
+      if (sscanf(argv[++i], "%d,%d,%d", &tr, &tg, &tb) != 3) {
+        fprintf(stderr, "csc_model: bad tint %s\n", argv[i]);
+        return 2;
+      }
+    } else {
+      fprintf(stderr, "csc_model: unknown option %s\n", argv[i]);
+      return 2;
+    }
+  }
+
+  CSC_Adjust(&cm, brightness, contrast, saturation);
+  CSC_Tint(&cm, tr, tg, tb);
+  CSC_Fade(&cm, fade);
+  for (r = 0; r < 3; r++) {
+    printf("%c: %6d %6d %6d  %+6d\n", "RGB"[r], cm.m[r][0], cm.m[r][1], cm.m[r][2], cm.m[r][3]);
+  }
+  __print_regs(&cm);
+
+  if (i + 2 <= argc)
+    return __process(&cm, argv[i], argv[i + 1], w, h) ? 1 : 0;
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,290 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+////////////////////////////////////////////////////////////////////////////////
+// Զ̻˽/¼ƹߣ̼STREAM_Task.cӴڷķֿ
+// ̨ıУ鲻Եİᱻһ֡ʼġ
+//
+// 룺gcc -O2 -o fbstream_view fbstream_view.c
+// ÷fbstream_view [-r out.raw] [-o dir] [-e n] [-q] stream.bin|/dev/ttyUSB0|-
+//   -r ÿյһ֡XRGB8888׷дout.raw("-"Ϊstdout)ʽ
+//      SIM_RAWֱͬӽffplayʵʱۿعȶԣ
+//        stty -F /dev/ttyUSB0 115200 raw
+//        fbstream_view -q -r - /dev/ttyUSB0 | ffplay -f rawvideo -pixel_format bgr0 -video_size 480x272 -
+//   -o ÿn֡(-eĬ1)һPPMĿ¼
+//   -q ӡÿ֡Ϣ
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+// <STREAM_Task.c>һ
+#define STREAM_MAGIC      (0x54534246UL)
+#define STREAM_VERSION    (1)
+#define STREAM_PKT_TILE   (0)
+#define STREAM_PKT_FRAME  (1)
+#define STREAM_FLAG_KEY   (1 << 0)
+#define STREAM_OP_COPY    (0)
+#define STREAM_OP_FILL    (1)
+#define STREAM_OP_UP      (2)
+#define STREAM_HDR_SIZE   (16)
+#define STREAM_PKT_MAX    (STREAM_HDR_SIZE + 0x10000 + 4)
+
+typedef struct {
+  uint32_t* pixels;
+  int width;
+  int height;
+  int synced;               // յ֡
+  unsigned long frames;
+  unsigned long tiles;
+  unsigned long bad;        // УʽԵİ
+  unsigned long bytes;
+  uint32_t last_seq;
+  uint32_t last_ms;
+  uint32_t first_ms;
+} ViewerType;
+
+static uint32_t __le32(uint8_t const* p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t __le16(uint8_t const* p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t __adler32(uint8_t const* p, uint32_t n)
+{
+  uint32_t a = 1, b = 0;
+
+  while (n--) {
+    a = (a + *p++) % 65521;
+    b = (b + a) % 65521;
+  }
+  return (b << 16) | a;
+}
+
+static int __resize(ViewerType* v, int w, int h)
+{
+  if (v->pixels && v->width == w && v->height == h)
+    return 0;
+  free(v->pixels);
+  v->pixels = (uint32_t*)calloc((size_t)w * h, 4);
+  if (v->pixels == NULL)
+    return -1;
+  v->width = w;
+  v->height = h;
+  v->synced = 0;
+  return 0;
+}
+
+/*
+* һ鵽
+* @return: 0ɹԽʱ-1
+*/
+static int __decode_tile(ViewerType* v, uint8_t const* p, uint32_t len)
+{
+  uint8_t const* end = p + len;
+  uint32_t tile[256];
+  uint32_t c;
+  int x0, y0, w, h, n, i = 0, k, op, x, y;
+
+  if (len < 6)
+    return -1;
+  x0 = __le16(p);
+  y0 = __le16(p + 2);
+  w = p[4];
+  h = p[5];
+  n = w * h;
+  if (w == 0 || h == 0 || n > 256 || x0 + w > v->width || y0 + h > v->height)
+    return -1;
+  for (p += 6; p < end && i < n; ) {
+    op = *p >> 6;
+    k = (*p++ & 0x3f) + 1;
+    if (i + k > n)
+      return -1;
+    switch (op) {
+    case STREAM_OP_COPY:
+      if (p + 3 * k > end)
+        return -1;
+      for (; k > 0; k--, p += 3)
+        tile[i++] = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+      break;
+    case STREAM_OP_FILL:
+      if (p + 3 > end)
+        return -1;
+      c = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+      for (p += 3; k > 0; k--)
+        tile[i++] = c;
+      break;
+    case STREAM_OP_UP:
+      if (i < w)
+        return -1;
+      for (; k > 0; k--, i++)
+        tile[i] = tile[i - w];
+      break;
+    default:
+      return -1;
+    }
+  }
+  if (i != n || p != end)
+    return -1;
+  for (y = 0; y < h; y++) {
+    for (x = 0; x < w; x++)
+      v->pixels[(y0 + y) * v->width + x0 + x] = tile[y * w + x];
+  }
+  v->tiles++;
+  return 0;
+}
+
+static void __write_ppm(ViewerType const* v, char const* dir, unsigned long n)
+{
+  char path[512];
+  FILE* fp;
+  int i;
+
+  snprintf(path, sizeof(path), "%s/frame_%05lu.ppm", dir, n);
+  fp = fopen(path, "wb");
+  if (fp == NULL) {
+    fprintf(stderr, "fbstream_view: cannot write %s\n", path);
+    return;
+  }
+  fprintf(fp, "P6\n%d %d\n255\n", v->width, v->height);
+  for (i = 0; i < v->width * v->height; i++) {
+    fputc((v->pixels[i] >> 16) & 0xff, fp);
+    fputc((v->pixels[i] >> 8) & 0xff, fp);
+    fputc(v->pixels[i] & 0xff, fp);
+  }
+  fclose(fp);
+}
+
+/*
+* һУİ
+* @return: 1Ϊһ֡0Ϊ飬-1Ϊ
+*/
+static int __packet(ViewerType* v, uint8_t const* pkt, uint32_t len, int quiet)
+{
+  uint32_t seq = __le32(pkt + 8), ms;
+  int w = __le16(pkt + 12), h = __le16(pkt + 14), flags;
+
+  if (pkt[5] != STREAM_VERSION || w == 0 || h == 0 || __resize(v, w, h) != 0)
+    return -1;
+  if (pkt[4] == STREAM_PKT_TILE)
+    return __decode_tile(v, pkt + STREAM_HDR_SIZE, len);
+  if (pkt[4] != STREAM_PKT_FRAME || len < 8)
+    return -1;
+  flags = __le16(pkt + STREAM_HDR_SIZE + 2);
+  ms = __le32(pkt + STREAM_HDR_SIZE + 4);
+  if (flags & STREAM_FLAG_KEY)
+    v->synced = 1;
+  if (v->frames == 0)
+    v->first_ms = ms;
+  if (!quiet) {
+    fprintf(stderr, "frame %u: %u tiles%s, +%ums%s\n", seq, __le16(pkt + STREAM_HDR_SIZE),
+            (flags & STREAM_FLAG_KEY) ? " (key)" : "",
+            v->frames ? ms - v->last_ms : 0, v->synced ? "" : ", waiting for a key frame");
+  }
+  v->last_seq = seq;
+  v->last_ms = ms;
+  v->frames++;
+  return 1;
+}
+
+int main(int argc, char* argv[])
+{
+  static uint8_t buf[STREAM_PKT_MAX * 2];
+  char const* raw_path = NULL;
+  char const* ppm_dir = NULL;
+  unsigned long every = 1, saved = 0;
+  ViewerType v;
+  FILE* in, * raw = NULL;
+  size_t have = 0, got, pos, len;
+  int i, quiet = 0, r;
+
+  for (i = 1; i < argc && argv[i][0] == '-' && argv[i][1]; i++) {
+    if (!strcmp(argv[i], "-q"))
+      quiet = 1;
+    else if (!strcmp(argv[i], "-r") && i + 1 < argc)
+      raw_path = argv[++i];
+    else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+      ppm_dir = argv[++i];
+    else if (!strcmp(argv[i], "-e") && i + 1 < argc)
+      every = strtoul(argv[++i], NULL, 0);
+    else {
+      fprintf(stderr, "usage: fbstream_view [-r out.raw] [-o dir] [-e n] [-q] stream.bin|tty|-\n");
+      return 2;
+    }
+  }
+  if (i >= argc) {
+    fprintf(stderr, "usage: fbstream_view [-r out.raw] [-o dir] [-e n] [-q] stream.bin|tty|-\n");
+    return 2;
+  }
+  in = strcmp(argv[i], "-") ? fopen(argv[i], "rb") : stdin;
+  if (in == NULL) {
+    perror(argv[i]);
+    return 1;
+  }
+  if (raw_path) {
+    raw = strcmp(raw_path, "-") ? fopen(raw_path, "wb") : stdout;
+    if (raw == NULL) {
+      perror(raw_path);
+      return 1;
+    }
+  }
+  memset(&v, 0, sizeof(v));
+
+  for (;;) {
+    got = fread(buf + have, 1, sizeof(buf) - have, in);
+    if (got == 0 && have < STREAM_HDR_SIZE + 4)
+      break;
+    have += got;
+    v.bytes += got;
+    pos = 0;
+    // ħʱ´ζ
+    while (have - pos >= STREAM_HDR_SIZE + 4) {
+      if (__le32(buf + pos) != STREAM_MAGIC) {
+        pos++;
+        continue;
+      }
+      len = __le16(buf + pos + 6);
+      if (have - pos < STREAM_HDR_SIZE + len + 4)
+        break;
+      if (__adler32(buf + pos + 4, STREAM_HDR_SIZE - 4 + len) != __le32(buf + pos + STREAM_HDR_SIZE + len)) {
+        v.bad++;
+        pos++;
+        continue;
+      }
+      r = __packet(&v, buf + pos, (uint32_t)len, quiet);
+      pos += STREAM_HDR_SIZE + len + 4;
+      if (r < 0) {
+        v.bad++;
+      } else if (r > 0 && v.synced) {
+        if (raw) {
+          fwrite(v.pixels, 4, (size_t)v.width * v.height, raw);
+          fflush(raw);
+        }
+        if (ppm_dir && every && (v.frames % every) == 0)
+          __write_ppm(&v, ppm_dir, saved++);
+      }
+    }
+    memmove(buf, buf + pos, have - pos);
+    have -= pos;
+    if (got == 0)
+      break;
+  }
+
+  fprintf(stderr, "fbstream_view: %lu frames, %lu tiles, %lu bytes, %lu bad packets",
+          v.frames, v.tiles, v.bytes, v.bad);
+  if (v.frames > 1 && v.last_ms != v.first_ms)
+    fprintf(stderr, ", %.1f fps", (v.frames - 1) * 1000.0 / (v.last_ms - v.first_ms));
+  fprintf(stderr, "\n");
+  if (raw && raw != stdout)
+    fclose(raw);
+  if (in != stdin)
+    fclose(in);
+  free(v.pixels);
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
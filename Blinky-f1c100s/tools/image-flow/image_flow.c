@@ -0,0 +1,417 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+////////////////////////////////////////////////////////////////////////////////
+// ͸ͼ˱ȶʱֱӱ̼GUI_FlowMap.c
+// ֵ(x | y<<12)Ŀÿȡ
+// һ㣬˫͸ӳȣӰͽðɫȲ͸ȡ
+// ʱȽͬһ֡(һŲ棬480x272)ж
+// лҪãģGUI_MEMDEV_DrawPerspectiveX()һԤȷת
+// İ͸Ӱ޵Ӱͽ
+//
+// 룺gcc -O2 -I../../users/task-gui -o image_flow image_flow.c ../../users/task-gui/GUI_FlowMap.c -lm
+// ÷image_flow [-t] [-n ] [-s ] [-f ֡]
+//   -t ȶ(ֳü)Ӱmipһʧ˳Ϊ1
+//   -n εĸȱʡ2000
+//   -f ʱ֡ȱʡ200
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "GUI_FlowMap.h"
+
+#define W             (480)
+#define H             (272)
+#define TEX_MAX       (320)
+#define BK            (0xFFFFFFu)
+
+static uint32_t _dst[W * H];
+static uint32_t _tex[TEX_MAX * TEX_MAX];
+static uint32_t _mip[2][(TEX_MAX / 2) * (TEX_MAX / 2)];
+
+static double __rand(void)
+{
+  return rand() / (RAND_MAX + 1.0);
+}
+
+static int __irand(int lo, int hi)
+{
+  return lo + (int)(__rand() * (hi - lo + 1));
+}
+
+static void __fill(uint32_t v)
+{
+  int i;
+
+  for (i = 0; i < W * H; i++)
+    _dst[i] = v;
+}
+
+static void __clip_all(FlowMapDstType* d)
+{
+  d->pData = _dst;
+  d->stride = W;
+  d->x0 = 0;
+  d->y0 = 0;
+  d->x1 = W - 1;
+  d->y1 = H - 1;
+}
+
+/*
+* Σ뻭غ˫ӳ
+* @return: 0ͨӡһ󲢷1
+*/
+static int __check_map(int idx)
+{
+  FlowMapTexType t;
+  FlowMapDstType d;
+  FlowMapPoseType p;
+  int x, y, i, u, v, inside;
+  double tc, top, h, uref, vref, c;
+  uint32_t pix;
+
+  t.w = __irand(8, TEX_MAX);
+  t.h = __irand(8, TEX_MAX);
+  t.stride = t.w;
+  t.pData = _tex;
+  for (y = 0; y < t.h; y++) {
+    for (x = 0; x < t.w; x++)
+      _tex[y * t.w + x] = (uint32_t)x | ((uint32_t)y << 12);
+  }
+  p.dx = __irand(1, 400);
+  p.h0 = __irand(1, 400);
+  p.h1 = __irand(1, 400);
+  p.x = __irand(-200, W);
+  p.y = __irand(-200, H);
+  p.dy = __irand(-200, 200);
+  __clip_all(&d);
+  if (idx & 1) {
+    d.x0 = __irand(0, W - 1);
+    d.x1 = __irand(d.x0, W - 1);
+    d.y0 = __irand(0, H - 1);
+    d.y1 = __irand(d.y0, H - 1);
+  }
+  __fill(BK);
+  FLOWMAP_Draw(&d, &t, &p, 255, 0, 0);
+  for (y = 0; y < H; y++) {
+    for (x = 0; x < W; x++) {
+      pix = _dst[y * W + x];
+      i = x - p.x;
+      if (x < d.x0 || x > d.x1 || y < d.y0 || y > d.y1 || i < 0 || i >= p.dx) {
+        if (pix != BK)
+          goto fail;
+        continue;
+      }
+      tc = (i + 0.5) / p.dx;
+      top = p.y + p.dy * tc;
+      h = p.h0 + (p.h1 - p.h0) * tc;
+      c = y + 0.5 - top;
+      // ±̫
+      if (fabs(c) < 0.01 || fabs(c - h) < 0.01)
+        continue;
+      inside = (c > 0 && c < h);
+      if (!inside) {
+        if (pix != BK)
+          goto fail;
+        continue;
+      }
+      if (pix == BK)
+        goto fail;
+      uref = t.w * p.h1 * tc / ((1 - tc) * p.h0 + tc * p.h1);
+      vref = c * t.h / h;
+      u = (int)(pix & 0xFFF);
+      v = (int)(pix >> 12);
+      if (abs(u - (int)floor(uref)) > 1 || abs(v - (int)floor(vref)) > 1)
+        goto fail;
+    }
+  }
+  return 0;
+fail:
+  printf("FAIL map #%d at (%d,%d) pix %06X: tex %dx%d pose x %d y %d h0 %d h1 %d dx %d dy %d clip %d,%d-%d,%d\n",
+         idx, x, y, (unsigned)_dst[y * W + x], (int)t.w, (int)t.h, (int)p.x, (int)p.y, (int)p.h0, (int)p.h1,
+         (int)p.dx, (int)p.dy, (int)d.x0, (int)d.y0, (int)d.x1, (int)d.y1);
+  return 1;
+}
+
+/*
+* ɫںڵϣΪfadeӰkΪralpha*(rh-k)/rh
+* @return: 0ͨ
+*/
+static int __check_refl(int idx)
+{
+  FlowMapTexType t;
+  FlowMapDstType d;
+  FlowMapPoseType p;
+  int x, y, i, k, rh, got, want, fade, refl, ralpha;
+  double tc, top, h, bottom;
+
+  t.w = __irand(8, TEX_MAX);
+  t.h = __irand(8, TEX_MAX);
+  t.stride = t.w;
+  t.pData = _tex;
+  for (i = 0; i < t.w * t.h; i++)
+    _tex[i] = 0xFFFFFF;
+  p.dx = __irand(1, 200);
+  p.h0 = __irand(4, 180);
+  p.h1 = __irand(4, 180);
+  p.x = __irand(-50, W - 50);
+  p.y = __irand(-50, 120);
+  p.dy = __irand(-40, 40);
+  fade = (idx & 1) ? __irand(0, 254) : 255;
+  refl = __irand(1, 256);
+  ralpha = __irand(1, 255);
+  __clip_all(&d);
+  __fill(0);
+  FLOWMAP_Draw(&d, &t, &p, fade, refl, ralpha);
+  for (i = 0; i < p.dx; i++) {
+    x = p.x + i;
+    if (x < 0 || x >= W)
+      continue;
+    tc = (i + 0.5) / p.dx;
+    top = p.y + p.dy * tc;
+    h = p.h0 + (p.h1 - p.h0) * tc;
+    bottom = floor(top + h + 0.5);
+    rh = (int)floor(h * refl / 256);
+    if (fabs(top + h - floor(top + h) - 0.5) < 0.01 || rh < 1)
+      continue;
+    for (y = (int)bottom; y < H && y >= 0 && y < bottom + rh + 3; y++) {
+      k = y - (int)bottom;
+      got = (int)(_dst[y * W + x] & 0xFF);
+      if (k >= rh + 1) {
+        want = 0;
+      } else {
+        if (k >= rh - 1)
+          continue;
+        want = (int)floor(ralpha * (double)(rh - k) / rh * (fade == 255 ? 255 : fade * 255.0 / 256) / 256 + 0.5);
+      }
+      if (abs(got - want) > 3 + ralpha / rh) {
+        printf("FAIL refl #%d col %d row %d: got %d want %d (rh %d refl %d ralpha %d fade %d)\n",
+               idx, i, k, got, want, rh, refl, ralpha, fade);
+        return 1;
+      }
+    }
+    y = (int)floor(top + h * 0.5);
+    if (y >= 0 && y < H) {
+      got = (int)(_dst[y * W + x] & 0xFF);
+      want = (fade == 255) ? 255 : (255 * fade) >> 8;
+      if (got != want) {
+        printf("FAIL fade #%d col %d: got %d want %d\n", idx, i, got, want);
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+static int __check_mip(void)
+{
+  FlowMapTexType t;
+  int x, y, k, want, got, bad = 0;
+
+  t.w = 157;
+  t.h = 93;
+  t.stride = t.w;
+  t.pData = _tex;
+  for (k = 0; k < t.w * t.h; k++)
+    _tex[k] = (uint32_t)rand() & 0xFFFFFF;
+  if (FLOWMAP_Downsample(&t, _mip[0]) != 0)
+    return 1;
+  for (y = 0; y < t.h / 2; y++) {
+    for (x = 0; x < t.w / 2; x++) {
+      for (k = 0; k < 24; k += 8) {
+        want = (int)(((_tex[2 * y * t.w + 2 * x] >> k) & 0xFF) + ((_tex[2 * y * t.w + 2 * x + 1] >> k) & 0xFF) +
+                     ((_tex[(2 * y + 1) * t.w + 2 * x] >> k) & 0xFF) + ((_tex[(2 * y + 1) * t.w + 2 * x + 1] >> k) & 0xFF) + 2) / 4;
+        got = (int)((_mip[0][y * (t.w / 2) + x] >> k) & 0xFF);
+        if (got != want)
+          bad++;
+      }
+    }
+  }
+  t.w = 1;
+  if (FLOWMAP_Downsample(&t, _mip[0]) != -1)
+    bad++;
+  if (bad)
+    printf("FAIL mip: %d channels differ\n", bad);
+  return bad != 0;
+}
+
+static int __test(int count)
+{
+  int i, bad = 0;
+
+  for (i = 0; i < count; i++)
+    bad += __check_map(i);
+  printf("map      %5d poses  %s\n", count, bad ? "FAIL" : "ok");
+  for (i = 0; i < count / 4; i++)
+    bad += __check_refl(i);
+  printf("reflect  %5d poses  %s\n", count / 4, bad ? "FAIL" : "ok");
+  bad += __check_mip();
+  printf("mip      %5s        %s\n", "", bad ? "FAIL" : "ok");
+  return bad;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// лģͣGUI_MEMDEV_DrawPerspectiveX()һÿضβ
+// ͸ȡ(γ)ͬһѭϣӰҪȱһ·ת
+// alpha½䵽0(ARGBʱ)͸ӵػ·ػ
+// ϺͺһˣֻȡĿ
+static uint32_t __mix(uint32_t d, uint32_t s, uint32_t a, uint32_t fade)
+{
+  uint32_t rb = d & 0xFF00FF, g = d & 0xFF00;
+
+  s = ((((s & 0xFF00FF) * fade) >> 8) & 0xFF00FF) | ((((s & 0xFF00) * fade) >> 8) & 0xFF00);
+  rb = (rb + ((((s & 0xFF00FF) - rb) * a) >> 8)) & 0xFF00FF;
+  g = (g + ((((s & 0xFF00) - g) * a) >> 8)) & 0xFF00;
+  return rb | g;
+}
+
+static void __draw_generic(FlowMapTexType const* t, FlowMapTexType const* rt, FlowMapPoseType const* p,
+                           uint32_t fade, uint32_t refl)
+{
+  int i, y, x, top, h, rh, sx, sy, c;
+  uint32_t s;
+
+  for (i = 0; i < p->dx; i++) {
+    x = p->x + i;
+    if (x < 0 || x >= W)
+      continue;
+    top = p->y + p->dy * (2 * i + 1) / (2 * p->dx);
+    h = p->h0 + (p->h1 - p->h0) * (2 * i + 1) / (2 * p->dx);
+    rh = h * (int)refl / 256;
+    for (y = (top > 0) ? top : 0; y < top + h + rh && y < H; y++) {
+      c = 2 * i + 1;
+      sx = (int)((int64_t)t->w * p->h1 * c / ((int64_t)p->h0 * (2 * p->dx - c) + (int64_t)p->h1 * c));
+      if (y < top + h) {
+        sy = (y - top) * t->h / h;
+        s = t->pData[sy * t->stride + sx];
+        _dst[y * W + x] = (fade >= 255) ? s & 0xFFFFFF : __mix(0, s, 255, fade);
+      } else {
+        sy = (y - top - h) * rt->h / rh;
+        s = rt->pData[sy * rt->stride + sx];
+        _dst[y * W + x] = __mix(_dst[y * W + x], s, s >> 24, fade);
+      }
+    }
+  }
+}
+
+// GUIDEMO_ImageFlow480x272ϵһ֡мһ棬߸Ų
+static int __frame_poses(FlowMapPoseType* ap)
+{
+  static const int ax[] = { 40, 90, 140, 340, 290, 240 };
+  int k, S = 150;
+
+  for (k = 0; k < 6; k++) {
+    ap[k].dx = S * 2 / 5;
+    ap[k].h0 = (k < 3) ? S * 17 / 20 : S * 3 / 5;
+    ap[k].h1 = (k < 3) ? S * 3 / 5 : S * 17 / 20;
+    ap[k].x = ax[k] + ((k < 3) ? 0 : 40) - ((k < 3) ? 0 : ap[k].dx);
+    ap[k].y = 136 - 20 - ap[k].h0 / 2;
+    ap[k].dy = (ap[k].h0 - ap[k].h1) / 2;
+  }
+  ap[6].x = (W - S) / 2;
+  ap[6].y = 136 - 20 - S / 2;
+  ap[6].h0 = ap[6].h1 = ap[6].dx = S;
+  ap[6].dy = 0;
+  return 7;
+}
+
+static double __now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void __bench(int frames)
+{
+  static uint32_t aRefl[150 * 150];
+  FlowMapTexType t, m, rt;
+  FlowMapDstType d;
+  FlowMapPoseType ap[7];
+  int f, k, n, x, y, pixels = 0;
+  double t0, tg, tgr, tf, tr, tm;
+
+  t.w = t.h = t.stride = 150;
+  t.pData = _tex;
+  for (k = 0; k < t.w * t.h; k++)
+    _tex[k] = (uint32_t)(k * 2654435761u) & 0xFFFFFF;
+  FLOWMAP_Downsample(&t, _mip[0]);
+  m.w = m.h = m.stride = 75;
+  m.pData = _mip[0];
+  // תȡӰһ(85/256)ţalpha960
+  rt.w = rt.h = rt.stride = 150;
+  rt.pData = aRefl;
+  for (y = 0; y < rt.h; y++) {
+    for (x = 0; x < rt.w; x++)
+      aRefl[y * rt.w + x] = (_tex[(t.h - 1 - y * 85 / 256) * t.w + x] & 0xFFFFFF) | ((uint32_t)(96 * (rt.h - y) / rt.h) << 24);
+  }
+  n = __frame_poses(ap);
+  __clip_all(&d);
+  t0 = __now();
+  for (f = 0; f < frames; f++) {
+    for (k = 0; k < n; k++)
+      __draw_generic(&t, &rt, &ap[k], 255, 0);
+  }
+  tg = __now() - t0;
+  t0 = __now();
+  for (f = 0; f < frames; f++) {
+    for (k = 0; k < n; k++)
+      __draw_generic(&t, &rt, &ap[k], (k < n - 1) ? 200 : 255, 85);
+  }
+  tgr = __now() - t0;
+  t0 = __now();
+  for (f = 0; f < frames; f++) {
+    for (k = 0, pixels = 0; k < n; k++)
+      pixels += FLOWMAP_Draw(&d, &t, &ap[k], 255, 0, 0);
+  }
+  tf = __now() - t0;
+  t0 = __now();
+  for (f = 0; f < frames; f++) {
+    for (k = 0; k < n; k++)
+      FLOWMAP_Draw(&d, &t, &ap[k], (k < n - 1) ? 200 : 255, 85, 96);
+  }
+  tr = __now() - t0;
+  // ĸ߶Ȳԭͼðߴmip
+  t0 = __now();
+  for (f = 0; f < frames; f++) {
+    for (k = 0; k < n; k++)
+      FLOWMAP_Draw(&d, (k < n - 1) ? &m : &t, &ap[k], (k < n - 1) ? 200 : 255, 85, 96);
+  }
+  tm = __now() - t0;
+  printf("frame: %d covers, %d pixels\n", n, pixels);
+  printf("                   per-pixel   columns\n");
+  printf("covers only        %8.1f  %8.1f us/frame\n", tg * 1e6 / frames, tf * 1e6 / frames);
+  printf("  + reflect, fade  %8.1f  %8.1f us/frame\n", tgr * 1e6 / frames, tr * 1e6 / frames);
+  printf("  + mip                      %8.1f us/frame\n", tm * 1e6 / frames);
+}
+
+int main(int argc, char* argv[])
+{
+  int i, test = 0, count = 2000, frames = 200, bad = 0;
+  unsigned seed = 1;
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-t") == 0) {
+      test = 1;
+    } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      count = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+      seed = (unsigned)atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+      frames = atoi(argv[++i]);
+    } else {
+      fprintf(stderr, "usage: image_flow [-t] [-n count] [-s seed] [-f frames]\n");
+      return 2;
+    }
+  }
+  srand(seed);
+  if (test) {
+    bad = __test(count);
+    printf("%s: %d failed\n", bad ? "FAIL" : "PASS", bad);
+  }
+  __bench(frames > 0 ? frames : 1);
+  return bad ? 1 : 0;
+}
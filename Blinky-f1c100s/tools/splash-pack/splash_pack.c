@@ -0,0 +1,208 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+////////////////////////////////////////////////////////////////////////////////
+// ߣһPPMͼƬС(Ĳõɫ)
+// RLEѹͬʱдSPLʶĸʽ(<sys-splash.h>)ʱֱȡ
+// ̼fb-panel.cFB_PANELһ¼ɡ
+//
+// 룺gcc -O2 -I../../periph/include -I../../boot-spl/include -o splash_pack splash_pack.c ../../periph/fb-panel.c
+// ÷splash_pack [-p ] [-b RRGGBB] logo.ppm splash.bin
+//   -p "800x480"ȱʡΪfb-panel.cĵһ
+//   -b ɫȱʡ000000
+// ¼SPLASH_FLASH_OFFSET磺
+//   sunxi-fel -p spiflash-write 0xc00000 splash.bin
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "framebuffer.h"
+#include "sys-splash.h"
+
+static void __put16(uint8_t* p, uint32_t v)
+{
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void __put32(uint8_t* p, uint32_t v)
+{
+  __put16(p, v);
+  __put16(p + 2, v >> 16);
+}
+
+static int __ppm_token(FILE* fp)
+{
+  int c, v = 0;
+
+  do {
+    c = fgetc(fp);
+    if (c == '#') {
+      while (c != '\n' && c != EOF)
+        c = fgetc(fp);
+    }
+  } while (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+  if (c < '0' || c > '9')
+    return -1;
+  while (c >= '0' && c <= '9') {
+    v = v * 10 + c - '0';
+    c = fgetc(fp);
+  }
+  return v;
+}
+
+/*
+* P6ʽPPMشΪ0x00RRGGBB
+* @return: ʧܷNULL
+*/
+static uint32_t* __read_ppm(char const* path, int* w, int* h)
+{
+  FILE* fp;
+  uint32_t* pix;
+  uint8_t rgb[3];
+  int i, max;
+
+  fp = fopen(path, "rb");
+  if (fp == NULL)
+    return NULL;
+  if (fgetc(fp) != 'P' || fgetc(fp) != '6') {
+    fclose(fp);
+    return NULL;
+  }
+  *w = __ppm_token(fp);
+  *h = __ppm_token(fp);
+  max = __ppm_token(fp);
+  if (*w <= 0 || *h <= 0 || max != 255) {
+    fclose(fp);
+    return NULL;
+  }
+  pix = (uint32_t*)malloc((size_t)*w * *h * 4);
+  for (i = 0; pix && i < *w * *h; i++) {
+    if (fread(rgb, 1, 3, fp) != 3) {
+      free(pix);
+      pix = NULL;
+      break;
+    }
+    pix[i] = ((uint32_t)rgb[0] << 16) | ((uint32_t)rgb[1] << 8) | rgb[2];
+  }
+  fclose(fp);
+  return pix;
+}
+
+static uint8_t* __put_pixel(uint8_t* p, uint32_t c)
+{
+  *p++ = (uint8_t)c;
+  *p++ = (uint8_t)(c >> 8);
+  *p++ = (uint8_t)(c >> 16);
+  return p;
+}
+
+/*
+* RLEѹnأͬؾͳɶظ
+* @return: ѹֽ
+*/
+static uint32_t __rle(uint32_t const* pix, uint32_t n, uint8_t* out)
+{
+  uint8_t* p = out;
+  uint32_t i = 0, k, lit;
+
+  while (i < n) {
+    for (k = 1; i + k < n && k < 128 && pix[i + k] == pix[i]; k++)
+      ;
+    if (k >= 2) {
+      *p++ = (uint8_t)(0x80 | (k - 1));
+      p = __put_pixel(p, pix[i]);
+      i += k;
+      continue;
+    }
+    for (lit = 1; i + lit < n && lit < 128; lit++) {
+      if (i + lit + 1 < n && pix[i + lit] == pix[i + lit + 1])
+        break;
+    }
+    *p++ = (uint8_t)(lit - 1);
+    for (k = 0; k < lit; k++)
+      p = __put_pixel(p, pix[i + k]);
+    i += lit;
+  }
+  return (uint32_t)(p - out);
+}
+
+int main(int argc, char* argv[])
+{
+  char const* panel = NULL;
+  uint32_t bg = 0, n, size, *img, *src;
+  uint8_t hdr[sizeof(splash_header_t)], *rle;
+  fb_panel_t const* p;
+  int i, x, y, sx, sy, w, h;
+  FILE* fp;
+
+  for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+    if (!strcmp(argv[i], "-p") && i + 1 < argc)
+      panel = argv[++i];
+    else if (!strcmp(argv[i], "-b") && i + 1 < argc)
+      bg = strtoul(argv[++i], NULL, 16) & 0xffffff;
+    else
+      break;
+  }
+  if (i + 2 != argc) {
+    fprintf(stderr, "usage: splash_pack [-p panel] [-b RRGGBB] logo.ppm splash.bin\n");
+    return 2;
+  }
+  p = fb_panel_find(panel);
+  if (p == NULL) {
+    fprintf(stderr, "splash_pack: unknown panel %s\n", panel);
+    return 1;
+  }
+  src = __read_ppm(argv[i], &w, &h);
+  if (src == NULL) {
+    fprintf(stderr, "splash_pack: %s is not a binary PPM (P6, maxval 255)\n", argv[i]);
+    return 1;
+  }
+
+  n = (uint32_t)(p->width * p->height);
+  img = (uint32_t*)malloc(n * 4);
+  rle = (uint8_t*)malloc(n * 4);
+  if (img == NULL || rle == NULL)
+    return 1;
+  for (y = 0; y < p->height; y++) {
+    for (x = 0; x < p->width; x++) {
+      sx = x - (p->width - w) / 2;
+      sy = y - (p->height - h) / 2;
+      img[y * p->width + x] = (sx >= 0 && sx < w && sy >= 0 && sy < h) ? src[sy * w + sx] : bg;
+    }
+  }
+  size = __rle(img, n, rle);
+
+  memset(hdr, 0, sizeof(hdr));
+  __put32(hdr + 0, SPLASH_MAGIC);
+  __put16(hdr + 4, (uint32_t)p->width);
+  __put16(hdr + 6, (uint32_t)p->height);
+  __put32(hdr + 8, (uint32_t)p->pixel_clock_hz);
+  __put16(hdr + 12, (uint32_t)p->h_front_porch);
+  __put16(hdr + 14, (uint32_t)p->h_back_porch);
+  __put16(hdr + 16, (uint32_t)p->h_sync_len);
+  __put16(hdr + 18, (uint32_t)p->v_front_porch);
+  __put16(hdr + 20, (uint32_t)p->v_back_porch);
+  __put16(hdr + 22, (uint32_t)p->v_sync_len);
+  hdr[24] = (uint8_t)p->bits_per_pixel;
+  hdr[25] = (uint8_t)((p->h_sync_active ? SPLASH_FLAG_HSYNC_HI : 0) | (p->v_sync_active ? SPLASH_FLAG_VSYNC_HI : 0));
+  __put32(hdr + 28, size);
+
+  fp = fopen(argv[i + 1], "wb");
+  if (fp == NULL) {
+    perror(argv[i + 1]);
+    return 1;
+  }
+  fwrite(hdr, 1, sizeof(hdr), fp);
+  fwrite(rle, 1, size, fp);
+  fclose(fp);
+  printf("splash_pack: %s %dx%d from %dx%d, %u bytes (%u%% of raw)\n",
+         p->name, p->width, p->height, w, h, (unsigned)(sizeof(hdr) + size),
+         (unsigned)((uint64_t)size * 100 / (n * 3)));
+  free(src);
+  free(img);
+  free(rle);
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,244 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+////////////////////////////////////////////////////////////////////////////////
+// ߵ˻طŹߣֱӱ̼GUI_TouchFilter.c
+// ̵̼߳Ļѹ(ʱ¼ѣסʱÿ֡)طŲ
+// ͳ/̧ӳ١궶ϱʱط0
+//
+// 룺gcc -O2 -I../../users/task-gui -o touch_replay touch_replay.c ../../users/task-gui/GUI_TouchFilter.c -lm
+// ÷touch_replay [-g] [-f ֡ms] [-l ӳms] [-j 󶶶px] [trace.txt]
+//
+// traceļÿһ"ʱms ԭʼX ԭʼY (0/1)"'#'ͷΪעͣ
+// ̼TOUCH_TRACE_EN󴮿ľʽ
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "GUI_TouchFilter.h"
+
+#define MAX_SAMPLES   (200000)
+
+static TouchSampleType _samples[MAX_SAMPLES];
+static int _nsamples = 0;
+
+typedef struct {
+  uint32_t n;
+  double sum, sum2, max;
+} StatType;
+
+static void __stat_add(StatType* s, double v)
+{
+  s->n++;
+  s->sum += v;
+  s->sum2 += v * v;
+  if (v > s->max)
+    s->max = v;
+}
+
+static double __stat_mean(StatType const* s)
+{
+  return s->n ? s->sum / s->n : 0.0;
+}
+
+static double __stat_stddev(StatType const* s)
+{
+  double m;
+
+  if (s->n < 2)
+    return 0.0;
+  m = __stat_mean(s);
+  return sqrt(fabs(s->sum2 / s->n - m * m));
+}
+
+static void __add_sample(uint32_t t, int x, int y, int pressed)
+{
+  if (_nsamples >= MAX_SAMPLES) {
+    fprintf(stderr, "too many samples\n");
+    exit(2);
+  }
+  _samples[_nsamples].t = t;
+  _samples[_nsamples].x = (uint16_t)(x < 0 ? 0 : (x > 4095 ? 4095 : x));
+  _samples[_nsamples].y = (uint16_t)(y < 0 ? 0 : (y > 4095 ? 4095 : y));
+  _samples[_nsamples].pressed = (uint8_t)pressed;
+  _nsamples++;
+}
+
+static int __load_trace(char const* path)
+{
+  FILE* fp = fopen(path, "r");
+  char line[128];
+  unsigned t, x, y, p;
+
+  if (fp == NULL) {
+    perror(path);
+    return -1;
+  }
+  while (fgets(line, sizeof(line), fp)) {
+    if (line[0] == '#')
+      continue;
+    if (sscanf(line, "%u %u %u %u", &t, &x, &y, &p) == 4) {
+      __add_sample(t, x, y, p != 0);
+    }
+  }
+  fclose(fp);
+  return 0;
+}
+
+static int __noise(int amp)
+{
+  return (rand() % (2 * amp + 1)) - amp;
+}
+
+// ϳݣԼ488HzĲʣһεһδͼ϶
+static void __gen_trace(void)
+{
+  uint32_t t;
+  int i;
+
+  srand(1);
+  for (t = 100; t < 180; t += 2) {
+    __add_sample(t, 2000 + __noise(12), 2000 + __noise(12), 1);
+  }
+  __add_sample(182, 0, 0, 0);
+
+  for (i = 0, t = 400; t < 1400; t += 2, i++) {
+    int x = 600 + (int)((t - 400) * 2900 / 1000);
+    int y = 1800 + __noise(12);
+    if ((i % 97) == 50)
+      x += 600;   // ż
+    __add_sample(t, x + __noise(12), y, 1);
+  }
+  __add_sample(1402, 0, 0, 0);
+}
+
+int main(int argc, char* argv[])
+{
+  TouchCalibType cal = { 200, 3900, 350, 3750, 480, 272, 0 };
+  TouchFilterType f;
+  TouchStateType st, last_move;
+  StatType lat_down = { 0 }, lat_up = { 0 }, pos_jit = { 0 }, int_jit = { 0 };
+  uint32_t frame_ms = 16, wake = 0, t_contact = 0, t_up = 0, reports = 0;
+  double max_lat = 40.0, max_jit = 3.0;
+  int gen = 0, i, k, moves, max_moves = 0, have_move = 0, have_prev = 0, pen = 0, wait_down = 0;
+  int prev_dx = 0, prev_dy = 0;
+  char const* path = NULL;
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-g") == 0) {
+      gen = 1;
+    } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+      frame_ms = (uint32_t)atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc) {
+      max_lat = atof(argv[++i]);
+    } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      max_jit = atof(argv[++i]);
+    } else if (argv[i][0] != '-') {
+      path = argv[i];
+    } else {
+      fprintf(stderr, "usage: %s [-g] [-f frame_ms] [-l max_latency_ms] [-j max_jitter_px] [trace.txt]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (gen || path == NULL) {
+    __gen_trace();
+  } else if (__load_trace(path) != 0) {
+    return 2;
+  }
+  if (_nsamples == 0) {
+    fprintf(stderr, "no samples\n");
+    return 2;
+  }
+
+  TOUCH_FilterInit(&f, &cal);
+  memset(&last_move, 0, sizeof(last_move));
+  k = 0;
+  while (k < _nsamples || TOUCH_FilterIsActive(&f)) {
+    // __ThreadTouchͬĻѹ
+    if (TOUCH_FilterIsActive(&f)) {
+      wake += frame_ms;
+    } else {
+      wake = _samples[k].t;
+    }
+    for (; k < _nsamples && _samples[k].t <= wake; k++) {
+      if (_samples[k].pressed && !pen) {
+        t_contact = _samples[k].t;
+        wait_down = 1;
+      }
+      if (!_samples[k].pressed)
+        t_up = _samples[k].t;
+      pen = _samples[k].pressed;
+      TOUCH_FilterPut(&f, &_samples[k]);
+    }
+    if (k >= _nsamples && (f.is_down || f.down_cnt > 0)) {
+      // traceڰס״̬½һ̧
+      TouchSampleType up = { 0, 0, 0, 0 };
+      up.t = t_up = wake;
+      pen = 0;
+      TOUCH_FilterPut(&f, &up);
+    }
+
+    moves = 0;
+    while (TOUCH_FilterGet(&f, &st)) {
+      reports++;
+      if (st.pressed && wait_down) {
+        // ʱ
+        __stat_add(&lat_down, (double)(wake - t_contact));
+        wait_down = 0;
+        have_move = 0;
+        have_prev = 0;
+      } else if (!st.pressed) {
+        __stat_add(&lat_up, (double)(wake - t_up));
+        wait_down = 0;
+      } else {
+        moves++;
+        if (have_move) {
+          int dx = st.x - last_move.x;
+          int dy = st.y - last_move.y;
+          __stat_add(&int_jit, (double)(wake - last_move.t));
+          if (have_prev) {
+            // ײ֣ƶʱΪ0ƫ뼴Ϊ
+            double ax = dx - prev_dx, ay = dy - prev_dy;
+            __stat_add(&pos_jit, sqrt(ax * ax + ay * ay));
+          }
+          prev_dx = dx;
+          prev_dy = dy;
+          have_prev = 1;
+        }
+        last_move = st;
+        last_move.t = wake;
+        have_move = 1;
+      }
+    }
+    if (moves > max_moves)
+      max_moves = moves;
+  }
+
+  printf("samples            : %d\n", _nsamples);
+  printf("reports            : %u (edge overflow %u)\n", reports, f.dropped);
+  printf("down latency ms    : mean %.1f max %.1f (%u contacts)\n",
+         __stat_mean(&lat_down), lat_down.max, lat_down.n);
+  printf("up latency ms      : mean %.1f max %.1f\n", __stat_mean(&lat_up), lat_up.max);
+  printf("position jitter px : rms %.2f max %.2f\n",
+         pos_jit.n ? sqrt(pos_jit.sum2 / pos_jit.n) : 0.0, pos_jit.max);
+  printf("report interval ms : mean %.1f stddev %.2f\n",
+         __stat_mean(&int_jit), __stat_stddev(&int_jit));
+  printf("max moves per frame: %d\n", max_moves);
+
+  if (lat_down.max > max_lat || lat_up.max > max_lat) {
+    printf("FAIL: latency above %.1f ms\n", max_lat);
+    return 1;
+  }
+  if (pos_jit.n && sqrt(pos_jit.sum2 / pos_jit.n) > max_jit) {
+    printf("FAIL: jitter above %.2f px\n", max_jit);
+    return 1;
+  }
+  if (max_moves > 1) {
+    printf("FAIL: more than one move per frame\n");
+    return 1;
+  }
+  printf("PASS\n");
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,151 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+////////////////////////////////////////////////////////////////////////////////
+// ٻ˽빤ߡ¼͸ʽֱӴӹ̼<ftrace_evt.h>ɣ
+// Թ̼¼Ҫٸߡ
+//
+// 룺gcc -O2 -I../../include -o trace_decode trace_decode.c
+// ÷trace_decode [-r] dump.bin
+//   dump.bin TRACE_Dump()ʱյԭʼ(ǰıҲ)
+//   ҲǵTRACE_Bufferַڴӳ
+//   -r ʱʾΪһ¼ļ
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+// <ftrace.h>һ
+#define TRACE_MAGIC     (0x43525446UL)
+#define TRACE_VERSION   (1)
+#define HDR_SIZE        (24)
+#define REC_SIZE        (24)
+
+typedef struct {
+  char const* name;
+  char const* fmt;
+} EvtDescType;
+
+static EvtDescType const _evt_table[] = {
+  { "TRC_NONE", "" },
+#define TRACE_EVT(name, fmt)  { #name, fmt },
+#include "ftrace_evt.h"
+#undef TRACE_EVT
+};
+#define EVT_COUNT (sizeof(_evt_table) / sizeof(_evt_table[0]))
+
+static uint32_t __le32(uint8_t const* p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t __le16(uint8_t const* p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static int __decode(uint8_t const* buf, size_t len, int relative)
+{
+  uint32_t freq, size, head, first, i, id, nargs, ts, delta, ts_last = 0;
+  uint64_t t = 0;
+  uint8_t const* r;
+  char text[256];
+  int started = 0, n;
+
+  if (__le32(buf + 4) != TRACE_VERSION) {
+    fprintf(stderr, "unsupported version %u\n", __le32(buf + 4));
+    return -1;
+  }
+  freq = __le32(buf + 8);
+  size = __le32(buf + 12);
+  head = __le32(buf + 16);
+  if (freq == 0 || size == 0 || (size & (size - 1)) != 0) {
+    fprintf(stderr, "bad header\n");
+    return -1;
+  }
+  if (len < HDR_SIZE + (size_t)size * REC_SIZE) {
+    fprintf(stderr, "truncated dump: %lu of %lu bytes\n",
+            (unsigned long)len, (unsigned long)(HDR_SIZE + (size_t)size * REC_SIZE));
+    return -1;
+  }
+  first = (head > size) ? head - size : 0;
+  printf("# %u records (%u lost to wrap), %u Hz timestamps\n", head - first, first, freq);
+
+  for (i = first; i != head; i++) {
+    r = buf + HDR_SIZE + (size_t)(i & (size - 1)) * REC_SIZE;
+    ts = __le32(r);
+    id = __le16(r + 4);
+    nargs = __le16(r + 6);
+    if (id == 0)
+      continue;
+    // 32λʱƣֵۼ
+    delta = started ? (uint32_t)(ts - ts_last) : 0;
+    t += delta;
+    started = 1;
+    if (id < EVT_COUNT) {
+      n = snprintf(text, sizeof(text), "%-18s ", _evt_table[id].name);
+      snprintf(text + n, sizeof(text) - n, _evt_table[id].fmt,
+               __le32(r + 8), __le32(r + 12), __le32(r + 16), __le32(r + 20));
+    } else {
+      snprintf(text, sizeof(text), "unknown event %u (%u args) %08x %08x %08x %08x", id, nargs,
+               __le32(r + 8), __le32(r + 12), __le32(r + 16), __le32(r + 20));
+    }
+    if (relative) {
+      printf("%+12.3f us  %s\n", (double)delta * 1e6 / freq, text);
+    } else {
+      printf("%14.3f us  %s\n", (double)t * 1e6 / freq, text);
+    }
+    ts_last = ts;
+  }
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  char const* path = NULL;
+  int relative = 0, i;
+  uint8_t* buf;
+  size_t len = 0, cap = 1 << 20, n, off;
+  FILE* fp;
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-r") == 0)
+      relative = 1;
+    else
+      path = argv[i];
+  }
+  if (path == NULL) {
+    fprintf(stderr, "usage: %s [-r] dump.bin\n", argv[0]);
+    return 2;
+  }
+  fp = fopen(path, "rb");
+  if (fp == NULL) {
+    perror(path);
+    return 2;
+  }
+  buf = malloc(cap);
+  while (buf && (n = fread(buf + len, 1, cap - len, fp)) > 0) {
+    len += n;
+    if (len == cap)
+      buf = realloc(buf, cap *= 2);
+  }
+  fclose(fp);
+  if (buf == NULL) {
+    fprintf(stderr, "out of memory\n");
+    return 2;
+  }
+
+  // "FTRC"ץǰܻͨı
+  for (off = 0; off + HDR_SIZE <= len; off++) {
+    if (__le32(buf + off) == TRACE_MAGIC) {
+      i = __decode(buf + off, len - off, relative);
+      free(buf);
+      return i ? 1 : 0;
+    }
+  }
+  fprintf(stderr, "no trace header found\n");
+  free(buf);
+  return 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
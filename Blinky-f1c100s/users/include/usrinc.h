@@ -10,6 +10,8 @@ extern "C"  {
 
 
 bool_t APP_CreateGuiService(void);
+bool_t APP_CreateTouchService(void);
+bool_t APP_CreateStreamService(void);
 
 
 
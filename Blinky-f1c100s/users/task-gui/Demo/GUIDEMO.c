@@ -21,6 +21,7 @@ Purpose     : Several GUIDEMO routines
 */
 
 #include "GUIDEMO.h"
+#include "GUI_Retain.h"
 
 /*********************************************************************
 *
@@ -56,6 +57,12 @@ static   GUIDEMO_CONFIG _GUIDemoConfig;
   static WM_HWIN _hDialogControl;
   static WM_HWIN _hDialogInfo;
   static int     _iDemoMinor;
+  //
+  // Retained paint of the static windows, replayed while nothing changed
+  //
+  static RetainType _RetainBk;
+  static RetainType _RetainControl;
+  static RetainType _RetainInfo;
 #endif
 
 #if GUI_SUPPORT_MEMDEV
@@ -86,7 +93,10 @@ static void _cbBk(WM_MESSAGE * pMsg) {
 
   switch (pMsg->MsgId) {
   case WM_PAINT:
-    _pfDrawBk();
+    if (GUI_RETAIN_Begin(&_RetainBk, pMsg->hWin, &_DrawLogo, sizeof(_DrawLogo))) {
+      _pfDrawBk();
+      GUI_RETAIN_End(&_RetainBk);
+    }
     break;
   case WM_SET_FOCUS:
     pMsg->Data.v = 0;
@@ -165,9 +175,16 @@ static void _cbFrameWinControl(WM_MESSAGE * pMsg) {
     TEXT_SetFont(hItem, &GUI_Font8_ASCII);
     break;
   case WM_PAINT:
-    xSize = WM_GetWindowSizeX(pMsg->hWin);
-    ySize = WM_GetWindowSizeY(pMsg->hWin);
-    GUI_DrawGradientV(0, 0, xSize - 1, ySize - 1, 0xFFFFFF, 0xDCCEC0);
+    if (GUI_RETAIN_Begin(&_RetainControl, pMsg->hWin, NULL, 0)) {
+      xSize = WM_GetWindowSizeX(pMsg->hWin);
+      ySize = WM_GetWindowSizeY(pMsg->hWin);
+      GUI_RETAIN_DrawGradientV(0, 0, xSize - 1, ySize - 1, 0xFFFFFF, 0xDCCEC0);
+      GUI_RETAIN_End(&_RetainControl);
+    }
+    break;
+  case WM_DELETE:
+    GUI_RETAIN_Delete(&_RetainControl);
+    WM_DefaultProc(pMsg);
     break;
   case WM_NOTIFY_PARENT:
     Id    = WM_GetId(pMsg->hWinSrc);
@@ -223,9 +240,16 @@ static void _cbFrameWinInfo(WM_MESSAGE * pMsg) {
     WM_SetWindowPos(pMsg->hWin, xSize / 2, 0, xSize / 2, INFO_SIZE_Y);
     break;
   case WM_PAINT:
-    xSize = WM_GetWindowSizeX(pMsg->hWin);
-    ySize = WM_GetWindowSizeY(pMsg->hWin);
-    GUI_DrawGradientV(0, 0, xSize - 1, ySize - 1, 0xFFFFFF, 0xDCCEC0);
+    if (GUI_RETAIN_Begin(&_RetainInfo, pMsg->hWin, NULL, 0)) {
+      xSize = WM_GetWindowSizeX(pMsg->hWin);
+      ySize = WM_GetWindowSizeY(pMsg->hWin);
+      GUI_RETAIN_DrawGradientV(0, 0, xSize - 1, ySize - 1, 0xFFFFFF, 0xDCCEC0);
+      GUI_RETAIN_End(&_RetainInfo);
+    }
+    break;
+  case WM_DELETE:
+    GUI_RETAIN_Delete(&_RetainInfo);
+    WM_DefaultProc(pMsg);
     break;
   default:
     WM_DefaultProc(pMsg);
@@ -244,9 +268,9 @@ static void _DrawBk(void) {
 
   xSize = LCD_GetXSize();
   ySize = LCD_GetYSize();
-  GUI_DrawGradientV(0, 0, xSize, ySize, BK_COLOR_0, BK_COLOR_1);
+  GUI_RETAIN_DrawGradientV(0, 0, xSize, ySize, BK_COLOR_0, BK_COLOR_1);
   if (_DrawLogo) {
-    GUI_DrawBitmap(&bmSeggerLogo70x35, LOGO_DIST_BORDER, LOGO_DIST_BORDER);
+    GUI_RETAIN_DrawBitmap(&bmSeggerLogo70x35, LOGO_DIST_BORDER, LOGO_DIST_BORDER);
   }
 }
 #endif
@@ -303,9 +327,9 @@ static void _DrawBkCircle(void) {
     GUI_MEMDEV_Delete(hMemGradient);
     GUI_MEMDEV_Select(hMemOld);
   }
-  GUI_MEMDEV_Write(hMemStretch);
+  GUI_RETAIN_DrawMemdev(hMemStretch);
   if (_DrawLogo) {
-    GUI_DrawBitmap(&bmSeggerLogo70x35, LOGO_DIST_BORDER, LOGO_DIST_BORDER);
+    GUI_RETAIN_DrawBitmap(&bmSeggerLogo70x35, LOGO_DIST_BORDER, LOGO_DIST_BORDER);
   }
 }
 #endif
@@ -315,10 +339,10 @@ static void _DrawBkCircle(void) {
 *       _DrawBkSimple
 */
 static void _DrawBkSimple(void) {
-  GUI_SetBkColor(BK_COLOR_1);
-  GUI_Clear();
+  GUI_RETAIN_SetBkColor(BK_COLOR_1);
+  GUI_RETAIN_Clear();
   if (_DrawLogo) {
-    GUI_DrawBitmap(&bmSeggerLogo70x35, LOGO_DIST_BORDER, LOGO_DIST_BORDER);
+    GUI_RETAIN_DrawBitmap(&bmSeggerLogo70x35, LOGO_DIST_BORDER, LOGO_DIST_BORDER);
   }
 }
 
@@ -457,6 +481,10 @@ static void _Main(void) {
     WM_InvalidateWindow(WM_HBKWIN);
     GUI_Exec();
   #endif
+  //
+  // The first screen is drawn, leave the boot splash
+  //
+  LCDCONF_EndSplash();
   GUIDEMO_Intro();
   //
   // Run the demos
@@ -475,6 +503,11 @@ static void _Main(void) {
     #endif
   }
   _iDemo = 0;
+  #if (GUI_WINSUPPORT && RETAIN_STAT_EN)
+    GUI_RETAIN_Print("background", &_RetainBk);
+    GUI_RETAIN_Print("control", &_RetainControl);
+    GUI_RETAIN_Print("info", &_RetainInfo);
+  #endif
   //
   // Cleanup
   //
@@ -29,6 +29,7 @@ extern "C" {     /* Make sure we have C-declarations in C++ programs */
 
 #include "GUI.h"
 #include "ftypes.h"
+#include "framebuffer.h"
   
 #if GUI_WINSUPPORT
   #include "WM.h"
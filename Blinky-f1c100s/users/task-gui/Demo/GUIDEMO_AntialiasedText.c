@@ -21,6 +21,7 @@ Purpose     : Shows text with different antialiasing qualities
 */
 
 #include "GUIDEMO.h"
+#include "GUI_TextCache.h"
 
 #if (SHOW_GUIDEMO_AATEXT)
 
@@ -121,11 +122,11 @@ static void _DrawSample(GUI_RECT Rect, const GUI_FONT * pFont, const char * pTex
   GUI_SetColor(GUI_WHITE);
   GUI_SetFont(pFont);
   CurrentRect.y1 = CurrentRect.y0 + yDistDiv3;
-  GUI_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
+  GUI_TEXTCACHE_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
   GUI_MoveRect(&CurrentRect, 0, yDistDiv3);
-  GUI_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
+  GUI_TEXTCACHE_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
   GUI_MoveRect(&CurrentRect, 0, yDistDiv3);
-  GUI_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
+  GUI_TEXTCACHE_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
   //
   // Black to white gradient
   //
@@ -135,13 +136,13 @@ static void _DrawSample(GUI_RECT Rect, const GUI_FONT * pFont, const char * pTex
   GUI_DrawGradientH(CurrentRect.x0, CurrentRect.y0, CurrentRect.x1, CurrentRect.y1, GUI_BLACK, GUI_WHITE);
   CurrentRect.y1 = CurrentRect.y0 + yDistDiv3;
   GUI_SetColor(GUI_RED);
-  GUI_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
+  GUI_TEXTCACHE_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
   GUI_MoveRect(&CurrentRect, 0, yDistDiv3);
   GUI_SetColor(GUI_GREEN);
-  GUI_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
+  GUI_TEXTCACHE_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
   GUI_MoveRect(&CurrentRect, 0, yDistDiv3);
   GUI_SetColor(GUI_BLUE);
-  GUI_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
+  GUI_TEXTCACHE_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
   //
   // RGB
   //
@@ -159,11 +160,11 @@ static void _DrawSample(GUI_RECT Rect, const GUI_FONT * pFont, const char * pTex
   GUI_SetColor(GUI_WHITE);
   CurrentRect.y0 = Rect.y0;
   CurrentRect.y1 = CurrentRect.y0 + yDistDiv3;
-  GUI_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
+  GUI_TEXTCACHE_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
   GUI_MoveRect(&CurrentRect, 0, yDistDiv3);
-  GUI_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
+  GUI_TEXTCACHE_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
   GUI_MoveRect(&CurrentRect, 0, yDistDiv3);
-  GUI_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
+  GUI_TEXTCACHE_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
   //
   // RGB gradients
   //
@@ -178,11 +179,11 @@ static void _DrawSample(GUI_RECT Rect, const GUI_FONT * pFont, const char * pTex
   CurrentRect.y0 = Rect.y0;
   CurrentRect.y1 = CurrentRect.y0 + yDistDiv3;
   GUI_SetColor(GUI_WHITE);
-  GUI_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
+  GUI_TEXTCACHE_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
   GUI_MoveRect(&CurrentRect, 0, yDistDiv3);
-  GUI_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
+  GUI_TEXTCACHE_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
   GUI_MoveRect(&CurrentRect, 0, yDistDiv3);
-  GUI_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
+  GUI_TEXTCACHE_DispStringInRect("ABC", &CurrentRect, GUI_TA_HCENTER | GUI_TA_VCENTER);
   //
   // Disable application defined clip rectangle
   //
@@ -227,6 +228,10 @@ static void _DrawScreen(void) {
   Rect.y0 = Rect.y1 + 1;
   Rect.y1 = ySize - yOff;
   _DrawSample(Rect, &GUI_FontAA2_32, "Antialiased text\n(2 bpp)");
+#if (TEXTCACHE_BENCH_EN > 0)
+  GUI_TEXTCACHE_Bench(&GUI_FontAA4_32, "ABC", 100);
+  GUI_TEXTCACHE_Bench(&GUI_FontAA2_32, "ABC", 100);
+#endif
   GUIDEMO_Wait(4000);
 }
 
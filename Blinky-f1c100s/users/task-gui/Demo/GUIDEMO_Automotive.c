@@ -21,6 +21,8 @@ Purpose     : Automotive samples
 */
 
 #include "GUIDEMO.h"
+#include "GUI_RotSprite.h"
+#include "GUI_AAPoly.h"
 
 #if (SHOW_GUIDEMO_AUTOMOTIVE && GUI_SUPPORT_MEMDEV)
 
@@ -40,6 +42,9 @@ Purpose     : Automotive samples
 #define MSP_DIST_BOTTOM  40
 #define NEEDLE_OFF_Y     40
 #define DEG2RAD          (3.1415926f / 180)
+#define ANGLE_MIN        135                // Range of both needles in degrees
+#define ANGLE_MAX        225
+#define SIZE_SPRITE      (2 * (125 + 2) + 1) // Needle tips are 125 pixels off the pivot, plus antialiasing
 
 /*********************************************************************
 *
@@ -690,7 +695,8 @@ static int _ShowGear = 0;
 */
 typedef struct {
   GUI_AUTODEV_INFO AutoDevInfo; // Information about what has to be displayed
-  GUI_POINT        aPoints[7];  // Polygon data
+  RotSpriteType    Needle;      // Pre-rendered needle, one frame per degree
+  int              Index;       // Index of the needle, used if the sprite could not be created
   float            Angle;
 } PARAM;
 
@@ -712,6 +718,39 @@ static NEEDLE _aNeedle[NUM_SCALES] = {
 *
 **********************************************************************
 */
+/*********************************************************************
+*
+*       _DrawNeedle
+*
+* Function description
+*   Draws a needle at the given angle (1/1000 degree). Used to pre-render
+*   the needle sprites and as fallback if that failed.
+*/
+static void _DrawNeedle(void * p, I32 a, int mx, int my) {
+  NEEDLE  * pNeedle;
+  GUI_POINT aPoints[7];
+
+  pNeedle = (NEEDLE *)p;
+  GUI_RotatePolygon(aPoints, pNeedle->pPolygon, pNeedle->NumPoints, a * DEG2RAD / 1000);
+  GUI_SetColor(GUI_WHITE);
+  GUI_AAPOLY_FillPolygon(aPoints, pNeedle->NumPoints, MAG * mx, MAG * my);
+}
+
+/*********************************************************************
+*
+*       _DrawNeedleSprite
+*/
+static void _DrawNeedleSprite(PARAM * pParam, int mx, int my) {
+  I32 a;
+
+  a = (I32)(pParam->Angle * 1000 / DEG2RAD);
+  if (pParam->Needle.pFrame) {
+    GUI_ROTSPRITE_Draw(&pParam->Needle, a, mx, my);
+  } else {
+    _DrawNeedle(&_aNeedle[pParam->Index], a, mx, my);
+  }
+}
+
 /*********************************************************************
 *
 *       _DrawBk
@@ -851,8 +890,7 @@ static void _Draw_0(void * p) {
   //
   // Moving needle
   //
-  GUI_SetColor(GUI_WHITE);
-  GUI_AA_FillPolygon(pParam->aPoints, GUI_COUNTOF(_aNeedle_0), MAG * (xSize / 2), MAG * (_ySpace + YSIZE_SCALE + NEEDLE_OFF_Y));
+  _DrawNeedleSprite(pParam, xSize / 2, _ySpace + YSIZE_SCALE + NEEDLE_OFF_Y);
   //
   // Fixed foreground
   //
@@ -883,8 +921,7 @@ static void _Draw_1(void * p) {
   //
   // Moving needle
   //
-  GUI_SetColor(GUI_WHITE);
-  GUI_AA_FillPolygon(pParam->aPoints, GUI_COUNTOF(_aNeedle_1), MAG * (xSize / 2), MAG * ((2 * (_ySpace + YSIZE_SCALE)) + NEEDLE_OFF_Y));
+  _DrawNeedleSprite(pParam, xSize / 2, (2 * (_ySpace + YSIZE_SCALE)) + NEEDLE_OFF_Y);
   //
   // Fixed foreground
   //
@@ -932,10 +969,14 @@ static void _AutomotiveDemo(void) {
     //
     GUI_MEMDEV_CreateAuto(&aAutoDev[i]);
     //
+    // Pre-render the needle for each degree of its range
+    //
+    aParam[i].Index = i;
+    GUI_ROTSPRITE_Create(&aParam[i].Needle, _DrawNeedle, &_aNeedle[i], SIZE_SPRITE, ANGLE_MIN * 1000, ANGLE_MAX * 1000, ANGLE_MAX - ANGLE_MIN + 1, 1);
+    //
     // Pre-draw memory devices to avoid lag on slow targets
     //
     aParam[i].Angle = _pfGetAngle[i](tDiff) * DEG2RAD;
-    GUI_RotatePolygon(aParam[i].aPoints, _aNeedle[i].pPolygon, _aNeedle[i].NumPoints, aParam[i].Angle);
     GUI_MEMDEV_DrawAuto(&aAutoDev[i], &aParam[i].AutoDevInfo, _pfDraw[i], &aParam[i]);
   }
   //
@@ -949,7 +990,6 @@ static void _AutomotiveDemo(void) {
     for (i = 0; i < NUM_SCALES; i++) {
       aParam[i].Angle = _pfGetAngle[i](tDiff) * DEG2RAD;
       t1           = GUIDEMO_GetTime();
-      GUI_RotatePolygon(aParam[i].aPoints, _aNeedle[i].pPolygon, _aNeedle[i].NumPoints, aParam[i].Angle);
       GUI_MEMDEV_DrawAuto(&aAutoDev[i], &aParam[i].AutoDevInfo, _pfDraw[i], &aParam[i]);
       atDiff[i]    = GUIDEMO_GetTime() - t1;
     }
@@ -975,6 +1015,12 @@ static void _AutomotiveDemo(void) {
   for (i = 0; i < NUM_SCALES; i++) {
     GUI_MEMDEV_DeleteAuto(&aAutoDev[i]);
   }
+  //
+  // Release needle sprites in reverse order of creation
+  //
+  for (i = NUM_SCALES - 1; i >= 0; i--) {
+    GUI_ROTSPRITE_Delete(&aParam[i].Needle);
+  }
 }
 
 /*********************************************************************
@@ -21,6 +21,7 @@ Purpose     : Draws bitmaps with and without compression
 */
 
 #include "GUIDEMO.h"
+#include "GUI_ImageCache.h"
 
 #if (SHOW_GUIDEMO_BITMAP)
 
@@ -4702,10 +4703,10 @@ static void _ShowGIF(void) {
   for (i = 0; i < GIF_Info.NumImages + 1; i++) {
     if (i == GIF_Info.NumImages) {
       i = 0;
-      GUI_GIF_DrawSub(_acGIF_AnimatedDialog, sizeof(_acGIF_AnimatedDialog), (xSize - GIF_Info.xSize) / 2, INFO_SIZE_Y + yOff, i);
+      GUI_IMGCACHE_Draw(IMGCACHE_SRC_GIF, _acGIF_AnimatedDialog, sizeof(_acGIF_AnimatedDialog), i, IMGCACHE_FMT_ALPHA, (xSize - GIF_Info.xSize) / 2, INFO_SIZE_Y + yOff);
       break;
     }
-    GUI_GIF_DrawSub(_acGIF_AnimatedDialog, sizeof(_acGIF_AnimatedDialog), (xSize - GIF_Info.xSize) / 2, INFO_SIZE_Y + yOff, i);
+    GUI_IMGCACHE_Draw(IMGCACHE_SRC_GIF, _acGIF_AnimatedDialog, sizeof(_acGIF_AnimatedDialog), i, IMGCACHE_FMT_ALPHA, (xSize - GIF_Info.xSize) / 2, INFO_SIZE_Y + yOff);
     GUI_GIF_GetImageInfo(_acGIF_AnimatedDialog, sizeof(_acGIF_AnimatedDialog), &GIF_ImageInfo, i);
     if (GUIDEMO_CheckCancelDelay(GIF_ImageInfo.Delay ? (i < 6) || (i > 40) ? GIF_ImageInfo.Delay * 10 : GIF_ImageInfo.Delay * 3 : 100)) {
       break;
@@ -4714,6 +4715,28 @@ static void _ShowGIF(void) {
 }
 #endif
 
+/*********************************************************************
+*
+*       _PrewarmImages
+*
+*  Queues the BMP, the JPEG and all GIF frames for background decoding,
+*  so they are already in the image cache when the screen is shown.
+*/
+#if SHOW_BMP_GIF_JPG
+static void _PrewarmImages(void) {
+  GUI_GIF_INFO GIF_Info;
+  int          i;
+
+  GUI_IMGCACHE_Prewarm(IMGCACHE_SRC_BMP,  _ac70x70_BMP, sizeof(_ac70x70_BMP), 0, IMGCACHE_FMT_OPAQUE);
+  GUI_IMGCACHE_Prewarm(IMGCACHE_SRC_JPEG, _ac70x70_JPG, sizeof(_ac70x70_JPG), 0, IMGCACHE_FMT_OPAQUE);
+  if (GUI_GIF_GetInfo(_acGIF_AnimatedDialog, sizeof(_acGIF_AnimatedDialog), &GIF_Info) == 0) {
+    for (i = 0; i < GIF_Info.NumImages; i++) {
+      GUI_IMGCACHE_Prewarm(IMGCACHE_SRC_GIF, _acGIF_AnimatedDialog, sizeof(_acGIF_AnimatedDialog), i, IMGCACHE_FMT_ALPHA);
+    }
+  }
+}
+#endif
+
 /*********************************************************************
 *
 *       _DrawBitmaps
@@ -4955,7 +4978,7 @@ static void _DrawScreen_BMP_GIF_JPG(int xSize, int ySize) {
   //
   Rect.x0  = xOffDisplay + X_BORDER    + xOff;
   Rect.y0  = yOffDisplay + INFO_SIZE_Y + yOff;
-  GUI_BMP_Draw(_ac70x70_BMP, Rect.x0, Rect.y0);
+  GUI_IMGCACHE_Draw(IMGCACHE_SRC_BMP, _ac70x70_BMP, sizeof(_ac70x70_BMP), 0, IMGCACHE_FMT_OPAQUE, Rect.x0, Rect.y0);
   Rect.y0 += BITMAP_SIZE_Y;
   Rect.x1  = Rect.x0 + BITMAP_SIZE_X_3 - 1;
   GUI_DispStringInRect("BMP", &Rect, GUI_TA_HCENTER | GUI_TA_VCENTER);
@@ -4964,7 +4987,7 @@ static void _DrawScreen_BMP_GIF_JPG(int xSize, int ySize) {
   //
   Rect.x0 = xOffDisplay + X_BORDER + xOff + (xOff + BITMAP_SIZE_X_3) * 2;
   Rect.y0 = yOffDisplay + INFO_SIZE_Y + yOff;
-  GUI_JPEG_Draw(_ac70x70_JPG, sizeof(_ac70x70_JPG), Rect.x0, Rect.y0);
+  GUI_IMGCACHE_Draw(IMGCACHE_SRC_JPEG, _ac70x70_JPG, sizeof(_ac70x70_JPG), 0, IMGCACHE_FMT_OPAQUE, Rect.x0, Rect.y0);
   Rect.y0 += BITMAP_SIZE_Y;
   Rect.x1 = Rect.x0 + BITMAP_SIZE_X_3 - 1;
   GUI_DispStringInRect("JPEG", &Rect, GUI_TA_HCENTER | GUI_TA_VCENTER);
@@ -5065,6 +5088,9 @@ void GUIDEMO_Bitmap(void) {
   }
   GUIDEMO_ConfigureDemo("Bitmaps", "Showing bitmaps of different\nformats and color depths", GUIDEMO_SHOW_CURSOR | GUIDEMO_SHOW_INFO | GUIDEMO_SHOW_CONTROL);
   GUIDEMO_DrawBk();
+  #if SHOW_BMP_GIF_JPG
+    _PrewarmImages();
+  #endif
   //
   // Iterate over subroutines
   //
@@ -21,6 +21,7 @@ Purpose     : Demonstration of the GRAPH widget.
 */
 
 #include "GUIDEMO.h"
+#include "GUI_ScrollPlot.h"
 
 #if (SHOW_GUIDEMO_GRAPH && GUI_WINSUPPORT && GUI_SUPPORT_MEMDEV)
 
@@ -52,7 +53,8 @@ Purpose     : Demonstration of the GRAPH widget.
 #define TICK_DIST_V       20
 
 #define TIME_RUN          5000
-#define TIME_STEP         15
+#define TIME_STEP         15  // One sample per TIME_STEP
+#define TIME_FRAME        20  // Samples arrived in between are drawn together
 
 #define MAX_NUM_DATA_OBJ  3
 
@@ -71,7 +73,7 @@ typedef struct {
   int     ScaleVOff;
   int     DataVOff;
   int     GridVOff;
-  void (* pfAddData)(GRAPH_DATA_Handle hData, int DataID);
+  int  (* pfGetData)(int DataID);
   int     NumWaves;
 } GRAPH_WAVE;
 
@@ -94,6 +96,8 @@ static GUI_COLOR _aColorData[MAX_NUM_DATA_OBJ] = {
 static GRAPH_SCALE_Handle _hScaleH;
 static GRAPH_SCALE_Handle _hScaleV;
 static int                _DataAdjust;
+static ScrollPlotType     _Plot;
+static WM_HWIN            _hPlot;
 
 /*********************************************************************
 *
@@ -103,9 +107,9 @@ static int                _DataAdjust;
 */
 /*********************************************************************
 *
-*       _AddData_Sine
+*       _GetData_Sine
 */
-static void _AddData_Sine(GRAPH_DATA_Handle hData, int DataID) {
+static int _GetData_Sine(int DataID) {
   static int x1000[MAX_NUM_DATA_OBJ];
   I32        SinHQ;
   int        Multi;
@@ -125,102 +129,136 @@ static void _AddData_Sine(GRAPH_DATA_Handle hData, int DataID) {
     Step  = 7;
     break;
   default:
-    return;
+    return 0;
   }
   SinHQ          = GUI__SinHQ(x1000[DataID]);
   x1000[DataID] += 1000 * Step;
-  GRAPH_DATA_YT_AddValue(hData, SHIFT_RIGHT_16(SinHQ * Multi) + _DataAdjust);
+  return SHIFT_RIGHT_16(SinHQ * Multi) + _DataAdjust;
 }
 
 /*********************************************************************
 *
-*       _AddData_Heartbeat
+*       _GetData_Heartbeat
 */
-static void _AddData_Heartbeat(GRAPH_DATA_Handle hData, int DataID) {
+static int _GetData_Heartbeat(int DataID) {
   static int Index;
+  int        v;
 
   GUI_USE_PARA(DataID);
-  GRAPH_DATA_YT_AddValue(hData, (_HeartBeat[Index]) + _DataAdjust);
+  v = _HeartBeat[Index] + _DataAdjust;
   if (++Index == GUI_COUNTOF(_HeartBeat)) {
     Index = 0;
   }
+  return v;
 }
 
 /*********************************************************************
 *
-*       DATA _aWave - Keep below _AddData-functions
+*       DATA _aWave - Keep below _GetData-functions
 */
 GRAPH_WAVE _aWave[] = {
   { "Heartbeat",        // Name
     157,                // Vertical scale offset in relation to GRAPH_DIV
     152,                // Vertical data  offset in relation to GRAPH_DIV
     21,                 // Vertical grid  offset in relation to GRAPH_DIV
-    _AddData_Heartbeat, // Pointer to specific AddData function
+    _GetData_Heartbeat, // Pointer to specific GetData function
     1                   // Number of waves
   },
   { "Sine Waves",
     265,
     253,
     23,
-    _AddData_Sine,
+    _GetData_Sine,
     3
   }
 };
 
+/*********************************************************************
+*
+*       _AddValues
+*/
+static void _AddValues(int DataCount, int (* pfGetData)(int DataID)) {
+  I16 aValue[MAX_NUM_DATA_OBJ];
+  int i;
+
+  for (i = 0; i < DataCount; i++) {
+    aValue[i] = (I16)pfGetData(i);
+  }
+  GUI_SCROLLPLOT_AddValues(&_Plot, aValue);
+}
+
 /*********************************************************************
 *
 *       _ShowGraph
+*
+*  Only the columns of the samples which arrived since the last frame
+*  are drawn, the plot window shows the column ring of the scroll plot.
 */
-static void _ShowGraph(GRAPH_Handle hGraph, GRAPH_DATA_Handle hData[], int DataCount, void (* pfAddData)(GRAPH_DATA_Handle hData, int DataID)) {
-  int Data_xSize;
+static void _ShowGraph(int DataCount, int GridOffY, int (* pfGetData)(int DataID)) {
   int NextState;
   int TimeStart;
   int TimeDiff;
-  int TimeStep;
   int Count;
-  int xSize;
-  int i;
 
-  xSize      = LCD_GetXSize();
-  Data_xSize = xSize - (DIST_TO_BORDER << 1) - (BORDER_LEFT + BORDER_RIGHT);
-  Count      = 0;
-  //
-  // Attach data objects
-  //
-  for (i = 0; i < DataCount; i++) {
-    GRAPH_AttachData(hGraph, hData[i]);
+  if (GUI_SCROLLPLOT_Create(&_Plot, WM_GetWindowSizeX(_hPlot), WM_GetWindowSizeY(_hPlot), DataCount, _aColorData, COLOR_BK)) {
+    WM_InvalidateWindow(_hPlot);
+    GUIDEMO_NotifyStartNext();
+    return;
   }
+  GUI_SCROLLPLOT_SetGrid(&_Plot, GRID_DIST_X, GRID_DIST_Y, GridOffY, COLOR_GRID);
+  Count = 0;
   //
-  // Add values before GRAPH is displayed
+  // Add values before the plot is displayed
   //
-  while (Count < Data_xSize) {
-    for (i = 0; i < DataCount; i++) {
-      pfAddData(hData[i], i);
-    }
+  while (Count < _Plot.xSize) {
+    _AddValues(DataCount, pfGetData);
+    GUI_SCROLLPLOT_Update(&_Plot);
     Count++;
   }
+  WM_InvalidateWindow(_hPlot);
   //
-  // Add values depending on time
+  // Add values depending on time, several per frame if drawing falls behind
   //
-
+  Count     = 0;
   TimeStart = GUIDEMO_GetTime();
   do {
     TimeDiff = GUIDEMO_GetTime() - TimeStart;
-    for (i = 0; i < DataCount; i++) {
-      pfAddData(hData[i], i);
+    while (Count * TIME_STEP <= TimeDiff) {
+      _AddValues(DataCount, pfGetData);
+      Count++;
     }
-    NextState = GUIDEMO_CheckCancel();
-    TimeStep  = GUIDEMO_GetTime() - TimeStart;
-    if ((TimeStep - TimeDiff) < TIME_STEP) {
-      GUI_Delay(TIME_STEP - (TimeStep - TimeDiff));
+    if (GUI_SCROLLPLOT_Update(&_Plot)) {
+      WM_InvalidateWindow(_hPlot);
     }
+    NextState = GUIDEMO_CheckCancel();
+    GUI_Delay(TIME_FRAME);
   } while ((TimeDiff < TIME_RUN) && (NextState == 0));
-  for (i = 0; i < DataCount; i++) {
-    GRAPH_DetachData(hGraph, hData[i]);
-  }
+  GUI_SCROLLPLOT_Delete(&_Plot);
   GUIDEMO_NotifyStartNext();
 }
 
+/*********************************************************************
+*
+*       _cbPlot
+*/
+static void _cbPlot(WM_MESSAGE * pMsg) {
+  switch (pMsg->MsgId) {
+  case WM_PAINT:
+    if (_Plot.hMem) {
+      GUI_SCROLLPLOT_Draw(&_Plot, 0, 0);
+    } else {
+      //
+      // No plot between the waves or when it could not be created
+      //
+      GUI_SetBkColor(COLOR_BK);
+      GUI_Clear();
+    }
+    break;
+  default:
+    WM_DefaultProc(pMsg);
+  }
+}
+
 /*********************************************************************
 *
 *       _cbBk
@@ -241,9 +279,9 @@ static void _cbBk(WM_MESSAGE * pMsg) {
 */
 static void _GraphDemo(void) {
   const WIDGET_EFFECT * pEffectOld;
-  GRAPH_DATA_Handle     hData[MAX_NUM_DATA_OBJ];
   GRAPH_Handle          hGraph;
   unsigned              i;
+  int                   EffectSize;
   int                   Graph_xSize;
   int                   Graph_ySize;
   int                   Graph_xPos;
@@ -284,20 +322,16 @@ static void _GraphDemo(void) {
   GRAPH_SetColor (hGraph, COLOR_BK,     GRAPH_CI_BK);
   GRAPH_SetColor (hGraph, COLOR_BORDER, GRAPH_CI_BORDER);
   GRAPH_SetColor (hGraph, COLOR_FRAME,  GRAPH_CI_FRAME);
-  GRAPH_SetColor (hGraph, COLOR_GRID,   GRAPH_CI_GRID);
+  WM_BringToBottom(hGraph);
   //
-  // Adjust grid
+  // The data area is covered by a child window showing the scroll plot,
+  // the GRAPH widget only draws border and scales
   //
-  GRAPH_SetGridVis  (hGraph, 1);
-  GRAPH_SetGridDistX(hGraph, GRID_DIST_X);
-  GRAPH_SetGridDistY(hGraph, GRID_DIST_Y);
-  WM_BringToBottom  (hGraph);
-  //
-  // Create and configure GRAPH_DATA_YT object
-  //
-  for (i = 0; i < MAX_NUM_DATA_OBJ; i++) {
-    hData[i] = GRAPH_DATA_YT_Create(_aColorData[i], xSize - (DIST_TO_BORDER << 1) - BORDER_LEFT, 0, 0);
-  }
+  EffectSize = WIDGET_Effect_Simple.EffectSize;
+  _hPlot     = WM_CreateWindowAsChild(EffectSize + BORDER_LEFT, EffectSize + BORDER_TOP,
+                                      Graph_xSize - (EffectSize << 1) - BORDER_LEFT - BORDER_RIGHT,
+                                      Graph_ySize - (EffectSize << 1) - BORDER_TOP  - BORDER_BOTTOM,
+                                      hGraph, WM_CF_SHOW, _cbPlot, 0);
   Data_ySize = Graph_ySize - BORDER_BOTTOM;
   //
   // Create and configure GRAPH_SCALE objects
@@ -314,9 +348,8 @@ static void _GraphDemo(void) {
   for (i = 0; i < GUI_COUNTOF(_aWave); i++) {
     GUIDEMO_SetInfoText(_aWave[i].pName);
     _DataAdjust = GUIDEMO_ShiftRight(Data_ySize * _aWave[i].DataVOff, GRAPH_DIV);
-    GRAPH_SetGridOffY (hGraph, GUIDEMO_ShiftRight(Data_ySize * _aWave[i].GridVOff, GRAPH_DIV));
     GRAPH_SCALE_SetOff(_hScaleV, GUIDEMO_ShiftRight((Data_ySize - BORDER_BOTTOM) * _aWave[i].ScaleVOff, GRAPH_DIV));
-    _ShowGraph(hGraph, hData, _aWave[i].NumWaves, _aWave[i].pfAddData);
+    _ShowGraph(_aWave[i].NumWaves, GUIDEMO_ShiftRight(Data_ySize * _aWave[i].GridVOff, GRAPH_DIV), _aWave[i].pfGetData);
   }
   //
   // Clean up
@@ -325,9 +358,7 @@ static void _GraphDemo(void) {
   GRAPH_DetachScale(hGraph, _hScaleV);
   GRAPH_SCALE_Delete(_hScaleH);
   GRAPH_SCALE_Delete(_hScaleV);
-  for (i = 0; i < MAX_NUM_DATA_OBJ; i++) {
-    GRAPH_DATA_YT_Delete(hData[i]);
-  }
+  WM_DeleteWindow(_hPlot);
   WM_DeleteWindow(hGraph);
   WIDGET_SetDefaultEffect(pEffectOld);
 }
@@ -22,6 +22,7 @@ Purpose     : Image flow demo
 
 #include "GUIDEMO.h"
 #include "LCDConf.h"
+#include "GUI_CoverFlow.h"
 
 #if (SHOW_GUIDEMO_IMAGEFLOW && GUI_WINSUPPORT && GUI_SUPPORT_MEMDEV)
 
@@ -37,6 +38,12 @@ Purpose     : Image flow demo
 #define MIN_TIME_PER_PICTURE 30
 #define TIME_RUN             17000
 
+#define COVER_TIME_MOVE      600
+#define COVER_TIME_HOLD      1200
+#define COVER_REFL           85
+#define COVER_REFL_ALPHA     96
+#define COVER_NUM_SIDE       3
+
 /*********************************************************************
 *
 *       Static (const) data
@@ -1646,6 +1653,17 @@ typedef struct {
   int w;
 } DRAW_PARAM;
 
+typedef struct {
+  int Index;
+  int x;
+  int y;
+  int h0;
+  int h1;
+  int w;
+  int dy;
+  int Fade;
+} COVER_POSE;
+
 static DRAW_PARAM _aParaL[] = {
   { 3,  22, 126, 85,  65  },
   { 6,  18, 134, 90,  70  },
@@ -1701,6 +1719,8 @@ static int _ayOffScreen[] = {
   240, 0
 };
 
+static CoverFlowTexType _aTex[GUI_COUNTOF(_apData)];
+
 /*********************************************************************
 *
 *       Static code
@@ -1723,6 +1743,7 @@ static int _GetImages(GUI_MEMDEV_Handle * phMem, GUI_MEMDEV_Handle * phMemNarrow
     }
     GUI_MEMDEV_Select(*(phMem + i));
     GUI_JPEG_Draw(_apData[i], _aSize[i], 0, 0);
+    GUI_COVERFLOW_CreateTex(&_aTex[i], *(phMem + i), COVERFLOW_MAX_LEVELS);
   }
   #if 0 /* Used for transparent dummys */
   for (; i < MaxItems; i++) {
@@ -1749,14 +1770,14 @@ static int _GetImages(GUI_MEMDEV_Handle * phMem, GUI_MEMDEV_Handle * phMemNarrow
 *
 *       _DrawPerspective
 */
-static void _DrawPerspective(GUI_MEMDEV_Handle hMem, int x, int y, int h0, int h1, int dx) {
+static void _DrawPerspective(const CoverFlowTexType * pTex, int x, int y, int h0, int h1, int dx) {
   int dy;
 
   dy = (h0 - h1) * 14 / 24;
   if (dy > 0) {
-    GUI_MEMDEV_DrawPerspectiveX(hMem, x, y, h0, h1, dx, dy);
+    GUI_COVERFLOW_Draw(pTex, x, y, h0, h1, dx, dy, 0xFF, 0, 0);
   } else {
-    GUI_MEMDEV_DrawPerspectiveX(hMem, x, y - dy, h0, h1, dx, dy);
+    GUI_COVERFLOW_Draw(pTex, x, y - dy, h0, h1, dx, dy, 0xFF, 0, 0);
   }
 }
 
@@ -1788,7 +1809,7 @@ static int _Delay(int Period) {
 *
 *       _DrawScreenAnimated
 */
-static int _DrawScreenAnimated(GUI_MEMDEV_Handle * phMem, GUI_MEMDEV_Handle * phMemNarrow, int MaxItems, int Index) {
+static int _DrawScreenAnimated(GUI_MEMDEV_Handle * phMemNarrow, int MaxItems, int Index) {
   #if GUI_SUPPORT_TOUCH
     GUI_PID_STATE State;
   #endif
@@ -1818,9 +1839,9 @@ static int _DrawScreenAnimated(GUI_MEMDEV_Handle * phMem, GUI_MEMDEV_Handle * ph
         #endif
         GUI_ClearRect(0, 0, 59, 119);
         if (j < 3) {
-          _DrawPerspective(*(phMem + aIndex[0 + j]), 0, 0, 120,  80,  60);
+          _DrawPerspective(&_aTex[aIndex[0 + j]], 0, 0, 120,  80,  60);
         } else {
-          _DrawPerspective(*(phMem + aIndex[2 + j]), 0, 0,  80, 120,  60);
+          _DrawPerspective(&_aTex[aIndex[2 + j]], 0, 0,  80, 120,  60);
         }
       }
       GUI_MEMDEV_Select(0);
@@ -1835,11 +1856,11 @@ static int _DrawScreenAnimated(GUI_MEMDEV_Handle * phMem, GUI_MEMDEV_Handle * ph
     GUI_MEMDEV_WriteAt(*(phMemNarrow + 4), 235 + _axOffPicture[i],  _ayOffScreen[ScreenIndex] + 25 + yOff);
     GUI_MEMDEV_WriteAt(*(phMemNarrow + 3), 205 + _axOffPicture[i],  _ayOffScreen[ScreenIndex] + 25 + yOff);
     if (i < 9) {
-      _DrawPerspective(*(phMem + aIndex[3]), 55 + _aParaL[i].xOff, _ayOffScreen[ScreenIndex] + yOff + _aParaL[i].yOff, _aParaL[i].h0, _aParaL[i].h1, _aParaL[i].w);
-      _DrawPerspective(*(phMem + aIndex[4]), 85 + _aParaR[i].xOff, _ayOffScreen[ScreenIndex] + yOff + _aParaR[i].yOff, _aParaR[i].h0, _aParaR[i].h1, _aParaR[i].w);
+      _DrawPerspective(&_aTex[aIndex[3]], 55 + _aParaL[i].xOff, _ayOffScreen[ScreenIndex] + yOff + _aParaL[i].yOff, _aParaL[i].h0, _aParaL[i].h1, _aParaL[i].w);
+      _DrawPerspective(&_aTex[aIndex[4]], 85 + _aParaR[i].xOff, _ayOffScreen[ScreenIndex] + yOff + _aParaR[i].yOff, _aParaR[i].h0, _aParaR[i].h1, _aParaR[i].w);
     } else {
-      _DrawPerspective(*(phMem + aIndex[4]), 85 + _aParaR[i].xOff, _ayOffScreen[ScreenIndex] + yOff + _aParaR[i].yOff, _aParaR[i].h0, _aParaR[i].h1, _aParaR[i].w);
-      _DrawPerspective(*(phMem + aIndex[3]), 55 + _aParaL[i].xOff, _ayOffScreen[ScreenIndex] + yOff + _aParaL[i].yOff, _aParaL[i].h0, _aParaL[i].h1, _aParaL[i].w);
+      _DrawPerspective(&_aTex[aIndex[4]], 85 + _aParaR[i].xOff, _ayOffScreen[ScreenIndex] + yOff + _aParaR[i].yOff, _aParaR[i].h0, _aParaR[i].h1, _aParaR[i].w);
+      _DrawPerspective(&_aTex[aIndex[3]], 55 + _aParaL[i].xOff, _ayOffScreen[ScreenIndex] + yOff + _aParaL[i].yOff, _aParaL[i].h0, _aParaL[i].h1, _aParaL[i].w);
     }
     #if GUI_SUPPORT_TOUCH
       GUI_PID_GetState(&State);
@@ -1862,6 +1883,164 @@ static int _DrawScreenAnimated(GUI_MEMDEV_Handle * phMem, GUI_MEMDEV_Handle * ph
   return 0;
 }
 
+/*********************************************************************
+*
+*       _GetPose
+*
+*  Function description
+*    Calculates the trapezoid of a cover. Pos is the distance from the
+*    center in 1/256 covers, covers beside the center are turned with
+*    their outer edge to the front.
+*/
+static void _GetPose(COVER_POSE * pPose, int Pos, int Size, int xCenter, int yCenter) {
+  int a;
+  int d;
+  int w;
+  int hInner;
+  int hOuter;
+  int xDist;
+
+  d      = (Pos < 0) ? -Pos : Pos;
+  a      = (d < 256) ? d : 256;
+  w      = Size + ((Size * 2 / 5) - Size) * a / 256;
+  hOuter = Size + ((Size * 17 / 20) - Size) * a / 256;
+  hInner = Size + ((Size * 3 / 5) - Size) * a / 256;
+  xDist  = (Size / 2 + Size / 8 + Size / 5) * a / 256;
+  if (d > 256) {
+    xDist += (d - 256) * (Size / 4) / 256;
+  }
+  if (Pos < 0) {
+    pPose->x  = xCenter - xDist - w / 2;
+    pPose->h0 = hOuter;
+    pPose->h1 = hInner;
+  } else {
+    pPose->x  = xCenter + xDist - w / 2;
+    pPose->h0 = hInner;
+    pPose->h1 = hOuter;
+  }
+  pPose->w    = w;
+  pPose->y    = yCenter - pPose->h0 / 2;
+  pPose->dy   = (pPose->h0 - pPose->h1) / 2;
+  pPose->Fade = 0xFF - ((d < 3 * 256) ? d : 3 * 256) * 40 / 256;
+}
+
+/*********************************************************************
+*
+*       _DrawCovers
+*
+*  Function description
+*    Draws all covers around position Pos (in 1/256 covers) from the
+*    back to the front, together with their reflections.
+*/
+static void _DrawCovers(int Pos, int Size, int xCenter, int yCenter) {
+  COVER_POSE aPose[2 * COVER_NUM_SIDE + 2];
+  COVER_POSE Pose;
+  int        aDist[2 * COVER_NUM_SIDE + 2];
+  int        NumPoses;
+  int        First;
+  int        i;
+  int        j;
+  int        d;
+
+  NumPoses = 0;
+  First    = (Pos >> 8) - COVER_NUM_SIDE;
+  for (i = First; i <= First + 2 * COVER_NUM_SIDE + 1; i++) {
+    _GetPose(&Pose, (i << 8) - Pos, Size, xCenter, yCenter);
+    Pose.Index = i % (int)GUI_COUNTOF(_aTex);
+    if (Pose.Index < 0) {
+      Pose.Index += GUI_COUNTOF(_aTex);
+    }
+    //
+    // Sort by distance, the nearest cover is drawn last
+    //
+    d = (i << 8) - Pos;
+    d = (d < 0) ? -d : d;
+    for (j = NumPoses; (j > 0) && (aDist[j - 1] < d); j--) {
+      aPose[j] = aPose[j - 1];
+      aDist[j] = aDist[j - 1];
+    }
+    aPose[j] = Pose;
+    aDist[j] = d;
+    NumPoses++;
+  }
+  for (i = 0; i < NumPoses; i++) {
+    GUI_COVERFLOW_Draw(&_aTex[aPose[i].Index], aPose[i].x, aPose[i].y, aPose[i].h0, aPose[i].h1, aPose[i].w, aPose[i].dy,
+                       (U8)aPose[i].Fade, COVER_REFL, COVER_REFL_ALPHA);
+  }
+}
+
+/*********************************************************************
+*
+*       _CoverFlow
+*
+*  Function description
+*    Resolution independent version of the demo. Each frame the covers
+*    are mapped column by column into a memory device which is then
+*    copied to the screen.
+*/
+static void _CoverFlow(void) {
+  GUI_MEMDEV_Handle hMemFrame;
+  GUI_MEMDEV_Handle hMemBk;
+  int               xSize;
+  int               ySize;
+  int               Size;
+  int               yCenter;
+  int               yBand;
+  int               ySizeBand;
+  int               TimeEnd;
+  int               TimeStart;
+  int               TimeUsed;
+  int               Pos;
+  int               s;
+
+  xSize     = LCD_GetXSize();
+  ySize     = LCD_GetYSize();
+  Size      = GUI_MIN(ySize * 11 / 20, xSize * 2 / 7);
+  yCenter   = ySize * 9 / 20;
+  yBand     = yCenter - Size / 2 - 2;
+  ySizeBand = GUI_MIN(Size + Size * COVER_REFL / 256 + 4, ySize - yBand);
+  hMemFrame = GUI_MEMDEV_CreateFixed(0, yBand, xSize, ySizeBand, GUI_MEMDEV_NOTRANS, GUI_MEMDEV_APILIST_32, GUI_COLOR_CONV_8888);
+  hMemBk    = GUI_MEMDEV_CreateFixed(0, yBand, xSize, ySizeBand, GUI_MEMDEV_NOTRANS, GUI_MEMDEV_APILIST_32, GUI_COLOR_CONV_8888);
+  if (hMemFrame && hMemBk) {
+    GUI_SetBkColor(GUI_BLACK);
+    GUI_Clear();
+    GUI_DrawGradientV(0, 0, xSize - 1, 39, 0x800000, GUI_BLACK);
+    GUI_SetColor(GUI_WHITE);
+    GUI_SetTextMode(GUI_TM_TRANS);
+    GUI_SetFont(&GUI_FontRounded22);
+    GUI_DispStringHCenterAt("emWin - ImageFlow Demo", xSize / 2, 6);
+    GUI_MEMDEV_CopyFromLCD(hMemBk);
+    TimeEnd = GUIDEMO_GetTime() + TIME_RUN;
+    Pos     = 0;
+    do {
+      TimeStart = GUIDEMO_GetTime();
+      do {
+        TimeUsed = GUI_MIN(GUIDEMO_GetTime() - TimeStart, COVER_TIME_MOVE);
+        s = TimeUsed * 256 / COVER_TIME_MOVE;
+        s = s * s * (3 * 256 - 2 * s) >> 16;   // Smooth start and stop
+        GUI_MEMDEV_Select(hMemFrame);
+        GUI_MEMDEV_WriteAt(hMemBk, 0, yBand);
+        _DrawCovers(Pos + s, Size, xSize / 2, yCenter);
+        GUI_MEMDEV_Select(0);
+        GUI_MEMDEV_CopyToLCD(hMemFrame);
+        GUI_Delay(5);
+      } while (TimeUsed < COVER_TIME_MOVE);
+      Pos += 256;
+      if (_Delay(COVER_TIME_HOLD)) {
+        break;
+      }
+    } while ((GUIDEMO_GetTime() < TimeEnd) && (GUIDEMO_CheckCancel() == 0));
+    #if COVERFLOW_STAT_EN
+      GUI_MEMDEV_Select(hMemFrame);
+      GUI_COVERFLOW_Bench(&_aTex[0], (xSize - Size) / 2, yCenter - Size / 2, Size, Size, Size, 0);
+      GUI_COVERFLOW_Bench(&_aTex[0], 0, yCenter - Size * 17 / 40, Size * 17 / 20, Size * 3 / 5, Size * 2 / 5, Size * 2 / 20);
+      GUI_MEMDEV_Select(0);
+    #endif
+  }
+  GUI_MEMDEV_Delete(hMemFrame);
+  GUI_MEMDEV_Delete(hMemBk);
+}
+
 /*********************************************************************
 *
 *       Public code
@@ -1883,17 +2062,16 @@ void GUIDEMO_ImageFlow(void) {
 
   xSize = LCD_GetXSize();
   ySize = LCD_GetYSize();
-  if ((xSize != QVGA_WIDTH) && (ySize != QVGA_HEIGHT)) {
-    GUIDEMO_ConfigureDemo("Image Flow", "Works only with a QVGA screen resolution.\nDemo will be skipped...", GUIDEMO_SHOW_CURSOR | GUIDEMO_SHOW_CONTROL);
-    return;
-  }
-  if ((LCD_GetVYSize() < QVGA_HEIGHT * 2) || (GUI_MULTIBUF_GetNumBuffers() > 1)) {
-    GUIDEMO_ConfigureDemo("Image Flow", "Requires a virtual screen\nwith at least twice the screen height.\nDemo will be skipped...", GUIDEMO_SHOW_CURSOR | GUIDEMO_SHOW_CONTROL);
-    return;
-  }
   GUIDEMO_ConfigureDemo("Image Flow", "Shows some floating images\nsimilar to the 'CoverFlow' look", 0);
   GUI_Exec();
-  if (_GetImages(ahMem, ahMemNarrow, GUI_COUNTOF(ahMem)) == 0) {
+  if (((xSize != QVGA_WIDTH) && (ySize != QVGA_HEIGHT)) || (LCD_GetVYSize() < QVGA_HEIGHT * 2) || (GUI_MULTIBUF_GetNumBuffers() > 1)) {
+    //
+    // Other screens use the column mapper with reflections
+    //
+    if (_GetImages(ahMem, ahMemNarrow, GUI_COUNTOF(ahMem)) == 0) {
+      _CoverFlow();
+    }
+  } else if (_GetImages(ahMem, ahMemNarrow, GUI_COUNTOF(ahMem)) == 0) {
     GUI_SetColor(0xFFFFFF);
     GUI_SetTextMode(GUI_TM_TRANS);
     GUI_SetFont(&GUI_FontRounded22);
@@ -1908,7 +2086,7 @@ void GUIDEMO_ImageFlow(void) {
     TimeEnd = GUIDEMO_GetTime() + TIME_RUN;
     Index   = 0;
     do {
-      if (_DrawScreenAnimated(ahMem, ahMemNarrow, GUI_COUNTOF(ahMem), Index)) {
+      if (_DrawScreenAnimated(ahMemNarrow, GUI_COUNTOF(ahMem), Index)) {
         break;
       }
       if (_Delay(2000)) {
@@ -1923,6 +2101,7 @@ void GUIDEMO_ImageFlow(void) {
     GUI_MEMDEV_Delete(ahMemNarrow[i]);
   }
   for (i = 0; i < GUI_COUNTOF(ahMem); i++) {
+    GUI_COVERFLOW_DeleteTex(&_aTex[i]);
     GUI_MEMDEV_Delete(ahMem[i]);
   }
   GUI_SetOrg(0, 0);
@@ -21,6 +21,7 @@ Purpose     : Listview demo
 */
 
 #include "GUIDEMO.h"
+#include "GUI_VirtList.h"
 
 #if (SHOW_GUIDEMO_LISTVIEW && GUI_WINSUPPORT)
 
@@ -36,6 +37,7 @@ Purpose     : Listview demo
 */
 #define LISTVIEW_SIZE_X 210
 #define MIN_SPACE       5
+#define NUM_VROWS       50000
 
 /*********************************************************************
 *
@@ -49,7 +51,12 @@ enum {
   JOB_REVERSE,
   JOB_INCSEL,
   JOB_DECSEL,
-  JOB_COLOR
+  JOB_COLOR,
+  JOB_VADDROWS,
+  JOB_VPAGE,
+  JOB_VJUMP,
+  JOB_VSORT,
+  JOB_VREVERSE
 };
 
 /*********************************************************************
@@ -164,6 +171,32 @@ static const ACTION_ITEM _aAction[] = {
   {1800, 0,              NULL },
 };
 
+/*********************************************************************
+*
+*       _aActionVirtual
+*/
+static const ACTION_ITEM _aActionVirtual[] = {
+  {   0, JOB_VADDROWS,   "Virtual list with\n50000 rows" },
+  { 900, 0,              NULL },
+  { 500, 0,              "Scrolling only touches\nthe visible rows" },
+  { 300, JOB_VPAGE,      NULL  },
+  { 300, JOB_VPAGE,      NULL  },
+  { 300, JOB_VPAGE,      NULL  },
+  { 600, JOB_VJUMP,      NULL  },
+  { 600, JOB_VJUMP,      NULL  },
+  { 600, JOB_VJUMP,      NULL  },
+  { 500, 0,              "Sorting 50000 rows\nin the background" },
+  { 500, 0,              NULL },
+  { 600, JOB_VSORT,      NULL  },
+  { 600, JOB_VSORT,      NULL  },
+  { 600, JOB_VSORT,      NULL  },
+  { 500, 0,              "Using reverse/normal\nsorting order" },
+  { 500, 0,              NULL },
+  { 600, JOB_VREVERSE,   NULL  },
+  { 600, JOB_VREVERSE,   NULL  },
+  {1800, 0,              NULL },
+};
+
 /*********************************************************************
 *
 *       _aColor
@@ -177,6 +210,13 @@ static const GUI_COLOR _aColor[] = {
   GUI_GRAY        , GUI_DARKGRAY    , GUI_BLACK       , GUI_BROWN       ,
 };
 
+/*********************************************************************
+*
+*       _VList, _aOrder
+*/
+static VirtualListType _VList;
+static U32             _aOrder[2 * NUM_VROWS];
+
 /*********************************************************************
 *
 *       Static code
@@ -324,6 +364,167 @@ static void _Action(WM_HWIN hList) {
   } while ((++Index < GUI_COUNTOF(_aAction)) && (GUIDEMO_CheckCancel() == 0));
 }
 
+/*********************************************************************
+*
+*       _Hash
+*
+* Purpose:
+*   Scrambles a row index, the virtual rows are derived from it
+*   instead of being stored
+*/
+static U32 _Hash(U32 Index) {
+  Index ^= Index >> 16;
+  Index *= 0x7FEB352DUL;
+  Index ^= Index >> 15;
+  Index *= 0x846CA68BUL;
+  Index ^= Index >> 16;
+  return Index;
+}
+
+/*********************************************************************
+*
+*       _GetCode
+*/
+static void _GetCode(U32 Index, char * acText) {
+  U32 h;
+  int i;
+
+  h = _Hash(Index ^ 0x5A5A5A5AUL);
+  for (i = 0; i < 5; i++) {
+    acText[i] = (char)(h % 26 + 'A');
+    h /= 26;
+  }
+  acText[5] = 0;
+}
+
+/*********************************************************************
+*
+*       _GetBalance
+*/
+static int _GetBalance(U32 Index) {
+  return (int)(_Hash(Index ^ 0xA5A5A5A5UL) % 10000) - 5000;
+}
+
+/*********************************************************************
+*
+*       _GetVirtualText
+*
+* Purpose:
+*   Data provider of the virtual list, only called for visible rows
+*/
+static void _GetVirtualText(void * p, U32 Index, int Col, char * acText, int MaxLen) {
+  GUI_USE_PARA(p);
+  GUI_USE_PARA(MaxLen);
+  switch (Col) {
+  case 0:
+    strcpy(acText, _pNames[_Hash(Index) % GUI_COUNTOF(_pNames)]);
+    break;
+  case 1:
+    _GetCode(Index, acText);
+    break;
+  case 2:
+    sprintf(acText, "%i", _GetBalance(Index));
+    break;
+  }
+}
+
+/*********************************************************************
+*
+*       _CompareVirtual
+*
+* Purpose:
+*   Compare function of the virtual list, called by the sort task
+*/
+static int _CompareVirtual(void * p, U32 Index0, U32 Index1, int Col) {
+  char ac0[6];
+  char ac1[6];
+
+  GUI_USE_PARA(p);
+  switch (Col) {
+  case 0:
+    return strcmp(_pNames[_Hash(Index0) % GUI_COUNTOF(_pNames)], _pNames[_Hash(Index1) % GUI_COUNTOF(_pNames)]);
+  case 1:
+    _GetCode(Index0, ac0);
+    _GetCode(Index1, ac1);
+    return strcmp(ac0, ac1);
+  }
+  return _GetBalance(Index0) - _GetBalance(Index1);
+}
+
+/*********************************************************************
+*
+*       _ActionVirtual
+*
+* Purpose:
+*   Does some action with the virtual list
+*/
+static void _ActionVirtual(VirtualListType * pList) {
+  unsigned Index;
+  int      SortedColumn = -1;
+  int      Reverse      = 0;
+  int      i;
+
+  Index = 0;
+  do {
+    if (_aActionVirtual[Index].pDescription) {
+      GUIDEMO_SetInfoText(_aActionVirtual[Index].pDescription);
+    }
+    switch (_aActionVirtual[Index].Job) {
+    case JOB_VADDROWS:
+      GUI_VLIST_SetNumRows(pList, NUM_VROWS);
+      GUI_VLIST_SetSel(pList, 0);
+      break;
+    case JOB_VPAGE:
+      GUI_VLIST_IncSel(pList, pList->NumVisible);
+      break;
+    case JOB_VJUMP:
+      GUI_VLIST_SetSel(pList, GUI_VLIST_GetSel(pList) + 12345);
+      break;
+    case JOB_VREVERSE:
+      Reverse ^= 1;
+      GUI_VLIST_SetSort(pList, SortedColumn, Reverse);
+      break;
+    case JOB_VSORT:
+      if (++SortedColumn == pList->NumCols) {
+        SortedColumn = 0;
+      }
+      GUI_VLIST_SetSort(pList, SortedColumn, Reverse);
+      //
+      // The list stays responsive while the index is sorted
+      //
+      for (i = 0; GUI_VLIST_IsSorting(pList) && (GUIDEMO_CheckCancel() == 0); i++) {
+        GUI_VLIST_IncSel(pList, (i & 8) ? -1 : 1);
+        GUI_Delay(50);
+      }
+      GUI_VLIST_SetSel(pList, 0);
+      break;
+    }
+    GUI_Delay(_aActionVirtual[Index].Delay);
+  } while ((++Index < GUI_COUNTOF(_aActionVirtual)) && (GUIDEMO_CheckCancel() == 0));
+}
+
+/*********************************************************************
+*
+*       _DemoVirtual
+*/
+static void _DemoVirtual(int x0, int y0, int xSize, int ySize) {
+  int i;
+
+  if (GUI_VLIST_Create(&_VList, x0, y0, xSize, ySize, WM_HBKWIN, GUI_ID_LISTVIEW1, _GetVirtualText, NULL)) {
+    return;
+  }
+  LISTVIEW_SetGridVis(_VList.hList, 1);
+  LISTVIEW_SetRBorder(_VList.hList, 5);
+  LISTVIEW_SetLBorder(_VList.hList, 5);
+  for (i = 0; i < 3; i++) {
+    GUI_VLIST_AddColumn(&_VList, _aColProps[i].Width, _aColProps[i].pText, _aColProps[i].Align);
+  }
+  GUI_VLIST_EnableSort(&_VList, _CompareVirtual, _aOrder, NUM_VROWS);
+  WM_SetFocus(_VList.hList);
+  _ActionVirtual(&_VList);
+  GUI_VLIST_Delete(&_VList);
+}
+
 /*********************************************************************
 *
 *       _DemoListview
@@ -348,6 +549,9 @@ static void _DemoListview(void) {
   _InitListview(hList);
   _Action(hList);
   WM_DeleteWindow(hList);
+  if (GUIDEMO_CheckCancel() == 0) {
+    _DemoVirtual(xSpace, INFO_SIZE_Y + ySpace, LISTVIEW_SIZE_X + SCROLLBAR_GetDefaultWidth(), ySize - INFO_SIZE_Y - (ySpace * 2));
+  }
 }
 
 /*********************************************************************
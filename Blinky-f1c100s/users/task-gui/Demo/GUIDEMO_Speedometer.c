@@ -21,6 +21,9 @@ Purpose     : Shows how to use memory devices for rotation.
 */
 
 #include "GUIDEMO.h"
+#include "GUI_TextCache.h"
+#include "GUI_RotSprite.h"
+#include "GUI_AAPoly.h"
 
 #if (SHOW_GUIDEMO_SPEEDOMETER && GUI_SUPPORT_MEMDEV)
 
@@ -59,7 +62,7 @@ Purpose     : Shows how to use memory devices for rotation.
 #define MAG                   6
 
 #define T_MIN_FRAME_ROLL     30
-#define T_MIN_FRAME_NEEDLE   30
+#define T_MIN_FRAME_NEEDLE   16
 
 #define MAX_SPEED           240
 
@@ -2784,7 +2787,7 @@ typedef struct {
   GUI_MEMDEV_Handle hScaleRot;
   GUI_MEMDEV_Handle hMemBk;
   GUI_MEMDEV_Handle hMemColor;
-  GUI_POINT         aPoints[GUI_COUNTOF(_aNeedle)];
+  RotSpriteType     Needle;
   int               xSize, ySize;
   float             Angle;
   float             Speed;
@@ -3285,7 +3288,7 @@ static GUI_MEMDEV_Handle _CreateScale(
     //
     // Draw polygon
     //
-    GUI_AA_FillPolygon(aPoint0Rot, GUI_COUNTOF(aPoint0Org), (rRing + 1) * MAG, (rRing + 1) * MAG);
+    GUI_AAPOLY_FillPolygon(aPoint0Rot, GUI_COUNTOF(aPoint0Org), (rRing + 1) * MAG, (rRing + 1) * MAG);
   }
   //
   // Initialize reference check mark
@@ -3311,7 +3314,7 @@ static GUI_MEMDEV_Handle _CreateScale(
     //
     // Draw polygon
     //
-    GUI_AA_FillPolygon(aPoint1Rot, GUI_COUNTOF(aPoint1Org), (rRing + 1) * MAG, (rRing + 1) * MAG);
+    GUI_AAPOLY_FillPolygon(aPoint1Rot, GUI_COUNTOF(aPoint1Org), (rRing + 1) * MAG, (rRing + 1) * MAG);
   }
   hMemRect = _CreateRoundedRect(60, 30, 6, COLOR_DISPLAY0, COLOR_DISPLAY1);
   GUI_MEMDEV_Select(hMemScale);
@@ -3446,18 +3449,39 @@ static GUI_COLOR _GetFontColor(PARAM * pParam, U32 Color0, U32 Color1) {
   return FontColor;
 }
 
+/*********************************************************************
+*
+*       _DrawNeedle
+*
+*  Purpose: Draws the needle at the given angle (1/1000 degree). Used to
+*           pre-render the needle sprite and as fallback if that failed.
+*/
+static void _DrawNeedle(void * p, I32 a, int mx, int my) {
+  GUI_POINT aPoints[GUI_COUNTOF(_aNeedle)];
+
+  GUI_USE_PARA(p);
+  GUI_RotatePolygon(aPoints, _aNeedle, GUI_COUNTOF(_aNeedle), a * 3.1415926f / 180000);
+  GUI_SetColor(COLOR_NEEDLE);
+  GUI_AAPOLY_FillPolygon(aPoints, GUI_COUNTOF(aPoints), mx * MAG, my * MAG);
+}
+
 /*********************************************************************
 *
 *       _DrawNeedleAndSpeed
 */
 static void _DrawNeedleAndSpeed(PARAM * pParam, int mx, int my) {
   GUI_COLOR FontColor;
+  I32       a;
 
   //
   // Draw needle
   //
-  GUI_SetColor(COLOR_NEEDLE);
-  GUI_AA_FillPolygon(pParam->aPoints, GUI_COUNTOF(pParam->aPoints), mx * MAG, my * MAG);
+  a = (I32)(pParam->Angle * 180000 / 3.1415926f);
+  if (pParam->Needle.pFrame) {
+    GUI_ROTSPRITE_Draw(&pParam->Needle, a, mx, my);
+  } else {
+    _DrawNeedle(NULL, a, mx, my);
+  }
   //
   // Draw speed
   //
@@ -3465,8 +3489,7 @@ static void _DrawNeedleAndSpeed(PARAM * pParam, int mx, int my) {
   FontColor = pParam->FontColor;
   GUI_SetColor(FontColor);
   GUI_SetTextAlign(GUI_TA_RIGHT);
-  GUI_GotoXY(mx + 23, my + 49);
-  GUI_DispDecMin((int)pParam->Speed);
+  GUI_TEXTCACHE_DispDecAt((int)pParam->Speed, mx + 23, my + 49);
 }
 
 /*********************************************************************
@@ -3597,6 +3620,7 @@ static int _RollIn(PARAM * pParam, int tMax) {
 *       _KillMemdevs
 */
 static void _KillMemdevs(PARAM * pParam) {
+  GUI_ROTSPRITE_Delete(&pParam->Needle);
   GUI_MEMDEV_Delete(pParam->hMemBk);
   GUI_MEMDEV_Delete(pParam->hMemColor);
   GUI_MEMDEV_Delete(pParam->hScale);
@@ -3681,6 +3705,10 @@ static void _SpeedometerDemo(void) {
   GUI_AA_EnableHiRes();
   GUI_AA_SetFactor(MAG);
   //
+  // Pre-render the needle for each degree of the scale (speed 0 at 210, MAX_SPEED at -30 degrees)
+  //
+  GUI_ROTSPRITE_Create(&Param.Needle, _DrawNeedle, NULL, 2 * (R_CHECK + 2) + 1, (210 - MAX_SPEED) * 1000, 210 * 1000, MAX_SPEED + 1, 1);
+  //
   // Create scale for rotation
   //
   GUI_MEMDEV_Select(Param.hScaleRot);
@@ -3693,7 +3721,6 @@ static void _SpeedometerDemo(void) {
   Param.Speed     = 0;
   Param.Angle     = (210 - (Param.Speed)) * 3.1415926f / 180;
   Param.FontColor = _GetFontColor(&Param, COLOR_NEEDLE, GUI_WHITE);
-  GUI_RotatePolygon(Param.aPoints, _aNeedle, GUI_COUNTOF(_aNeedle), Param.Angle);
   _DrawNeedleAndSpeed(&Param, R_RING + 1, R_RING + 1);
   GUI_MEMDEV_Select(0);
   //
@@ -3771,10 +3798,6 @@ static void _SpeedometerDemo(void) {
     }
     Param.FontColor = _GetFontColor(&Param, COLOR_NEEDLE, GUI_WHITE);
     //
-    // Rotate polygon
-    //
-    GUI_RotatePolygon(Param.aPoints, _aNeedle, GUI_COUNTOF(_aNeedle), Param.Angle);
-    //
     // Draw scene
     //
     GUI_MEMDEV_DrawAuto(&AutoDev, &Param.AutoDevInfo, _Draw, &Param);
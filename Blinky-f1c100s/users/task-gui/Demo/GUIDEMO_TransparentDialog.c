@@ -21,6 +21,7 @@ Purpose     : Demo of a semi transparent dialog
 */
 
 #include "GUIDEMO.h"
+#include "GUI_Compose.h"
 
 #if (SHOW_GUIDEMO_TRANSPARENTDIALOG && GUI_WINSUPPORT && GUI_SUPPORT_MEMDEV)
 
@@ -41,6 +42,9 @@ Purpose     : Demo of a semi transparent dialog
 #define FRAMEWIN_XSIZE 220
 #define TEXT_XSIZE     90
 #define SLIDER_XSIZE   100
+#define TITLE_YSIZE    22
+#define STAT_XSIZE     170
+#define STAT_YSIZE     36
 
 /*********************************************************************
 *
@@ -6711,6 +6715,8 @@ static GUI_CONST_STORAGE GUI_BITMAP _bmMap_400x320 = {
 static int _Alpha_0 = 85;
 static int _Alpha_1 = 0;
 
+static ComposeType _Compose;
+
 static const GUI_WIDGET_CREATE_INFO _aDialogCreate[] = {
   { FRAMEWIN_CreateIndirect, "Transparent dialog", 0,              0,   0,  FRAMEWIN_XSIZE, 100, FRAMEWIN_CF_MOVEABLE },
   { TEXT_CreateIndirect,     "Background:",        GUI_ID_TEXT0,   5,   10, TEXT_XSIZE,     20,  TEXT_CF_LEFT         },
@@ -7038,6 +7044,241 @@ static void _TransparentDialog(void) {
   }
 }
 
+/*********************************************************************
+*
+*       _cbCompose
+*
+*  Function description
+*    Callback routine of the desktop while the composited dialog is
+*    shown. Everything is drawn by the compositor.
+*/
+static void _cbCompose(WM_MESSAGE * pMsg) {
+  switch (pMsg->MsgId) {
+  case WM_PAINT:
+    GUI_COMPOSE_Paint(&_Compose);
+    break;
+  default:
+    WM_DefaultProc(pMsg);
+  }
+}
+
+/*********************************************************************
+*
+*       _CreateText
+*
+*  Function description
+*    Renders a text into a 32bpp memory device with transparent
+*    background, which can be used as compositor command.
+*/
+static GUI_MEMDEV_Handle _CreateText(const char * pText, const GUI_FONT * pFont, GUI_COLOR Color, int xSize, int ySize) {
+  GUI_MEMDEV_Handle hMem;
+  GUI_MEMDEV_Handle hMemOld;
+
+  hMem = GUI_MEMDEV_CreateFixed(0, 0, xSize, ySize, GUI_MEMDEV_HASTRANS, GUI_MEMDEV_APILIST_32, GUI_COLOR_CONV_8888);
+  if (hMem) {
+    hMemOld = GUI_MEMDEV_Select(hMem);
+    GUI_SetBkColor(GUI_TRANSPARENT);
+    GUI_Clear();
+    GUI_SetFont(pFont);
+    GUI_SetColor(Color);
+    GUI_SetTextMode(GUI_TM_TRANS);
+    GUI_DispStringAt(pText, 0, 0);
+    GUI_MEMDEV_Select(hMemOld);
+  }
+  return hMem;
+}
+
+/*********************************************************************
+*
+*       _UpdateStat
+*
+*  Function description
+*    Redraws the statistics text: tiles written compared to redrawing
+*    the whole screen each frame.
+*/
+static void _UpdateStat(GUI_MEMDEV_Handle hMem) {
+  GUI_MEMDEV_Handle hMemOld;
+  ComposeStatType   Stat;
+  char              acText[40] = "Tiles: ";
+
+  GUI_COMPOSE_GetStat(&_Compose, &Stat);
+  GUIDEMO_AddIntToString(acText, Stat.TilesWritten);
+  GUIDEMO_AddStringToString(acText, " of ");
+  GUIDEMO_AddIntToString(acText, Stat.TilesTotal);
+  hMemOld = GUI_MEMDEV_Select(hMem);
+  GUI_SetBkColor(GUI_TRANSPARENT);
+  GUI_Clear();
+  GUI_SetFont(&GUI_Font13_ASCII);
+  GUI_SetColor(GUI_WHITE);
+  GUI_SetTextMode(GUI_TM_TRANS);
+  GUI_DispStringAt("Composited in 32x32 tiles", 0, 0);
+  GUI_DispStringAt(acText, 0, 16);
+  GUI_MEMDEV_Select(hMemOld);
+}
+
+/*********************************************************************
+*
+*       _Bounce
+*/
+static void _Bounce(int * pPos, int * pAdd, int Min, int Max) {
+  *pPos += *pAdd;
+  if (*pPos <= Min) {
+    *pPos = Min;
+    *pAdd = -*pAdd;
+  } else if (*pPos >= Max) {
+    *pPos = Max;
+    *pAdd = -*pAdd;
+  }
+}
+
+/*********************************************************************
+*
+*       _ComposedDialog
+*
+*  Function description
+*    Shows the same scene as _TransparentDialog(), but built from
+*    compositor layers on the desktop window instead of transparent
+*    windows with memory devices. Only tiles which have changed are
+*    composed and written.
+*/
+static void _ComposedDialog(void) {
+  GUI_MEMDEV_Handle hMemMap;
+  GUI_MEMDEV_Handle hMemOld;
+  GUI_MEMDEV_Handle ahMemText[4];
+  WM_CALLBACK     * pcbOld;
+  int               CmdMap;
+  int               CmdTitle;
+  int               CmdClient;
+  int               CmdStat;
+  int               LayerDialog;
+  int               xSize;
+  int               ySize;
+  int               xMap;
+  int               yMap;
+  int               xAddMap;
+  int               yAddMap;
+  int               xDialog;
+  int               yDialog;
+  int               xAddDialog;
+  int               yAddDialog;
+  int               TimeStart;
+  int               TimeNext;
+  int               TimeStat;
+  int               TimeUsed;
+  int               TimeNow;
+  int               Value;
+  unsigned          i;
+
+  xSize = LCD_GetXSize();
+  ySize = LCD_GetYSize();
+  //
+  // Decode the map once into a memory device
+  //
+  hMemMap = GUI_MEMDEV_CreateFixed(0, 0, _bmMap_400x320.XSize, _bmMap_400x320.YSize, GUI_MEMDEV_NOTRANS, GUI_MEMDEV_APILIST_32, GUI_COLOR_CONV_8888);
+  if (hMemMap == 0) {
+    return;
+  }
+  hMemOld = GUI_MEMDEV_Select(hMemMap);
+  GUI_DrawBitmap(&_bmMap_400x320, 0, 0);
+  GUI_MEMDEV_Select(hMemOld);
+  ahMemText[0] = _CreateText("Composed dialog", &GUI_FontComic18B_ASCII, GUI_WHITE, FRAMEWIN_XSIZE - 10, TITLE_YSIZE);
+  ahMemText[1] = _CreateText("Background:",     &GUI_FontComic18B_ASCII, GUI_BLACK, TEXT_XSIZE, 20);
+  ahMemText[2] = _CreateText("Title:",          &GUI_FontComic18B_ASCII, GUI_BLACK, TEXT_XSIZE, 20);
+  ahMemText[3] = GUI_MEMDEV_CreateFixed(0, 0, STAT_XSIZE - 10, STAT_YSIZE - 4, GUI_MEMDEV_HASTRANS, GUI_MEMDEV_APILIST_32, GUI_COLOR_CONV_8888);
+  xMap    = (xSize > _bmMap_400x320.XSize) ? (xSize - _bmMap_400x320.XSize) / 2 : 0;
+  yMap    = (ySize > _bmMap_400x320.YSize) ? (ySize - _bmMap_400x320.YSize) / 2 : 0;
+  xAddMap = (xSize < _bmMap_400x320.XSize) ? -1 : 0;
+  yAddMap = (ySize < _bmMap_400x320.YSize) ? -1 : 0;
+  xDialog = (xSize - FRAMEWIN_XSIZE) / 2;
+  yDialog = 55;
+  xAddDialog = 2;
+  yAddDialog = 1;
+  //
+  // The desktop hosts the compositor and is drawn directly
+  //
+  WM_DisableMemdev(WM_HBKWIN);
+  pcbOld = WM_SetCallback(WM_HBKWIN, _cbCompose);
+  if (GUI_COMPOSE_Create(&_Compose, WM_HBKWIN) == 0) {
+    //
+    // Layer 0: background gradient and map
+    //
+    GUI_COMPOSE_AddLayer(&_Compose, 0, 0, 0xFF);
+    GUI_COMPOSE_GradientV(&_Compose, 0, 0, xSize - 1, ySize - 1, BK_COLOR_0, BK_COLOR_1);
+    CmdMap = GUI_COMPOSE_Memdev(&_Compose, hMemMap, xMap, yMap, 0xFF);
+    //
+    // Layer 1: the dialog, alpha values of the original demo are transparencies
+    //
+    LayerDialog = GUI_COMPOSE_AddLayer(&_Compose, xDialog, yDialog, 0xFF);
+    CmdTitle    = GUI_COMPOSE_GradientH(&_Compose, 0, 0, FRAMEWIN_XSIZE - 1, TITLE_YSIZE - 1, 0x3060C0, 0x90C0FF);
+    CmdClient   = GUI_COMPOSE_FillRect (&_Compose, 0, TITLE_YSIZE, FRAMEWIN_XSIZE - 1, 99, 0xAAAAAA, 0xFF);
+    GUI_COMPOSE_Memdev(&_Compose, ahMemText[0], 5, 2, 0xFF);
+    GUI_COMPOSE_Memdev(&_Compose, ahMemText[1], 5, TITLE_YSIZE + 10, 0xFF);
+    GUI_COMPOSE_Memdev(&_Compose, ahMemText[2], 5, TITLE_YSIZE + 40, 0xFF);
+    //
+    // Layer 2: statistics
+    //
+    GUI_COMPOSE_AddLayer(&_Compose, 5, 5, 0xFF);
+    GUI_COMPOSE_FillRect(&_Compose, 0, 0, STAT_XSIZE - 1, STAT_YSIZE - 1, GUI_BLACK, 0x80);
+    if (ahMemText[3]) {
+      _UpdateStat(ahMemText[3]);
+    }
+    CmdStat = GUI_COMPOSE_Memdev(&_Compose, ahMemText[3], 5, 2, 0xFF);
+    //
+    // Loop
+    //
+    TimeStart = GUIDEMO_GetTime();
+    TimeNext  = TimeStart + PERIOD;
+    TimeStat  = TimeStart + 1000;
+    do {
+      GUI_COMPOSE_Update(&_Compose);
+      GUI_Delay(20);
+      TimeNow  = GUIDEMO_GetTime();
+      TimeUsed = TimeNow - TimeStart;
+      if (TimeNow >= TimeNext) {
+        TimeNext = TimeNow + PERIOD;
+        if (xAddMap) {
+          _Bounce(&xMap, &xAddMap, xSize - _bmMap_400x320.XSize, 0);
+        }
+        if (yAddMap) {
+          _Bounce(&yMap, &yAddMap, ySize - _bmMap_400x320.YSize, 0);
+        }
+        GUI_COMPOSE_SetCmdPos(&_Compose, CmdMap, xMap, yMap);
+        _Bounce(&xDialog, &xAddDialog, 0, xSize - FRAMEWIN_XSIZE);
+        _Bounce(&yDialog, &yAddDialog, STAT_YSIZE + 10, ySize - 100);
+        GUI_COMPOSE_SetLayerPos(&_Compose, LayerDialog, xDialog, yDialog);
+        TimeUsed = TimeUsed % (DURATION / 2);
+        if (TimeUsed < (DURATION / 4)) {
+          Value = (TimeUsed * TRANSPARENCY * 4) / DURATION;
+        } else {
+          Value = TRANSPARENCY - ((TimeUsed - (DURATION / 4)) * TRANSPARENCY * 4) / DURATION;
+        }
+        GUI_COMPOSE_SetCmdAlpha(&_Compose, CmdClient, (U8)(0xFF - Value));
+        GUI_COMPOSE_SetCmdAlpha(&_Compose, CmdTitle,  (U8)Value);
+      }
+      if ((TimeNow >= TimeStat) && (CmdStat >= 0)) {
+        TimeStat = TimeNow + 1000;
+        _UpdateStat(ahMemText[3]);
+        GUI_COMPOSE_InvalidateCmd(&_Compose, CmdStat);
+      }
+    } while (((GUIDEMO_GetTime() - TimeStart) < DURATION) && (GUIDEMO_CheckCancel() == 0));
+#if COMPOSE_STAT_EN
+    GUI_COMPOSE_Print(&_Compose);
+#endif
+    GUI_COMPOSE_Delete(&_Compose);
+  }
+  //
+  // Free memory
+  //
+  WM_SetCallback(WM_HBKWIN, pcbOld);
+  WM_EnableMemdev(WM_HBKWIN);
+  for (i = 0; i < GUI_COUNTOF(ahMemText); i++) {
+    if (ahMemText[i]) {
+      GUI_MEMDEV_Delete(ahMemText[i]);
+    }
+  }
+  GUI_MEMDEV_Delete(hMemMap);
+}
+
 /*********************************************************************
 *
 *       Public code
@@ -7051,6 +7292,9 @@ static void _TransparentDialog(void) {
 void GUIDEMO_TransparentDialog(void) {
   GUIDEMO_ConfigureDemo("Transparent dialog", "Uses alpha blending\nfor transparency effect.", GUIDEMO_SHOW_CURSOR | GUIDEMO_SHOW_CONTROL);
   _TransparentDialog();
+  if (GUIDEMO_CheckCancel() == 0) {
+    _ComposedDialog();
+  }
 }
 
 #else
@@ -21,9 +21,23 @@ Purpose     : Treeview demo
 */
 
 #include "GUIDEMO.h"
+#include "GUI_VirtList.h"
 
 #if (SHOW_GUIDEMO_TREEVIEW && GUI_WINSUPPORT)
 
+#include <stdio.h>
+
+/*********************************************************************
+*
+*       Defines
+*
+**********************************************************************
+*/
+#define NUM_LOG_DAYS    50
+#define NUM_LOG_EVENTS  1000
+#define NUM_LOG_ROWS    (NUM_LOG_DAYS + NUM_LOG_DAYS * NUM_LOG_EVENTS)
+#define LOG_DAY         0x80000000UL
+
 /*********************************************************************
 *
 *       Types
@@ -38,7 +52,11 @@ enum {
   JOB_SETIMAGE,
   JOB_SETROWMODE,
   JOB_HIDELINES,
-  JOB_SHOWLINES
+  JOB_SHOWLINES,
+  JOB_LOG_INC,
+  JOB_LOG_PAGE,
+  JOB_LOG_END,
+  JOB_LOG_TOGGLE
 };
 
 /*********************************************************************
@@ -2344,6 +2362,23 @@ static SPRITE _aSprite[] = {
 
 #endif
 
+/*********************************************************************
+*
+*       _apLogEvent
+*/
+static const char * _apLogEvent[] = {
+  "Door open", "Door closed", "Overheat", "Fan fault", "Low battery",
+  "Power fail", "Power back", "Login", "Logout", "Pressure high",
+};
+
+/*********************************************************************
+*
+*       _Log, _aLogNode, _aLogDepth
+*/
+static VirtualTreeType _Log;
+static U32             _aLogNode[NUM_LOG_ROWS];
+static U8              _aLogDepth[NUM_LOG_ROWS];
+
 /*********************************************************************
 *
 *       _aAction
@@ -2391,6 +2426,17 @@ static const ACTION_ITEM _aAction[] = {
   { 200, JOB_SHOWLINES,  NULL },
   { 200, JOB_HIDELINES,  NULL },
   { 200, JOB_SHOWLINES,  NULL },
+  { 600, JOB_LOG_INC,    "Virtual tree with\n50000 log entries" },
+  { 500, JOB_LOG_TOGGLE, NULL },
+  { 300, JOB_LOG_INC,    NULL },
+  { 300, JOB_LOG_INC,    NULL },
+  { 300, JOB_LOG_PAGE,   NULL },
+  { 300, JOB_LOG_PAGE,   NULL },
+  { 300, JOB_LOG_PAGE,   NULL },
+  { 500, JOB_LOG_END,    NULL },
+  { 500, JOB_LOG_TOGGLE, NULL },
+  { 300, JOB_LOG_PAGE,   NULL },
+  { 300, JOB_LOG_PAGE,   NULL },
   {1800, 0,              NULL },
 };
 
@@ -2440,6 +2486,54 @@ static void _MoveSprite(SPRITE * pSprite, int xMax, int yMax) {
 }
 #endif
 
+/*********************************************************************
+*
+*       _LogGetNumChildren
+*
+*  Function description
+*    Data provider of the virtual event log: the root holds the days,
+*    each day holds its events. Nothing of the log is stored.
+*/
+static U32 _LogGetNumChildren(void * p, U32 Node) {
+  GUI_USE_PARA(p);
+  if (Node == 0) {
+    return NUM_LOG_DAYS;
+  }
+  return (Node & LOG_DAY) ? NUM_LOG_EVENTS : 0;
+}
+
+/*********************************************************************
+*
+*       _LogGetChild
+*/
+static U32 _LogGetChild(void * p, U32 Node, U32 Child) {
+  GUI_USE_PARA(p);
+  if (Node == 0) {
+    return LOG_DAY | Child;
+  }
+  return (Node & ~LOG_DAY) * NUM_LOG_EVENTS + Child + 1;
+}
+
+/*********************************************************************
+*
+*       _LogGetText
+*/
+static void _LogGetText(void * p, U32 Node, char * acText, int MaxLen) {
+  U32 Event;
+  U32 t;
+
+  GUI_USE_PARA(p);
+  GUI_USE_PARA(MaxLen);
+  if (Node & LOG_DAY) {
+    sprintf(acText, "Day %02u", (unsigned)(Node & ~LOG_DAY) + 1);
+  } else {
+    Event = Node - 1;
+    t     = (Event % NUM_LOG_EVENTS) * 86 + (Event * 7) % 86;
+    sprintf(acText, "%02u:%02u:%02u %s", (unsigned)(t / 3600), (unsigned)(t / 60 % 60), (unsigned)(t % 60),
+            _apLogEvent[(Event * 2654435761UL >> 16) % GUI_COUNTOF(_apLogEvent)]);
+  }
+}
+
 /*********************************************************************
 *
 *       _InitTreeview
@@ -2572,6 +2666,18 @@ static void _Action(WM_HWIN hTree, int xSize, int ySize) {
     case JOB_CLOSE:
       TREEVIEW_ITEM_Collapse(hItem);
       break;
+    case JOB_LOG_INC:
+      GUI_VLIST_IncSel(&_Log.List, 1);
+      break;
+    case JOB_LOG_PAGE:
+      GUI_VLIST_IncSel(&_Log.List, 250);
+      break;
+    case JOB_LOG_END:
+      GUI_VLIST_SetSel(&_Log.List, VLIST_NONE);
+      break;
+    case JOB_LOG_TOGGLE:
+      GUI_VTREE_Toggle(&_Log, GUI_VLIST_GetSel(&_Log.List));
+      break;
     }
   } while (++Index < GUI_COUNTOF(_aAction));
 }
@@ -2592,6 +2698,7 @@ static void _DemoTreeview(void) {
   WM_HWIN  hClient;
   WM_HWIN  hTree;
   WM_HWIN  hWin;
+  WM_HWIN  hLog;
   int      xSizeClient;
   int      ySizeClient;
   int      xSize;
@@ -2610,6 +2717,13 @@ static void _DemoTreeview(void) {
   hTree            = WM_GetDialogItem(hWin, GUI_ID_TREEVIEW0);
   WM_SetSize(hTree, xSizeClient, ySizeClient);
   //
+  // Create the virtual event log
+  //
+  hLog             = FRAMEWIN_CreateEx(xSize / 2, 0, xSize / 2, ySize - CONTROL_SIZE_Y, WM_HBKWIN, WM_CF_SHOW, 0, 0, "Event log", NULL);
+  hClient          = WM_GetClientWindow(hLog);
+  GUI_VTREE_Create(&_Log, 0, 0, WM_GetWindowSizeX(hClient), WM_GetWindowSizeY(hClient), hClient, GUI_ID_LISTVIEW0,
+                   _LogGetNumChildren, _LogGetChild, _LogGetText, NULL, _aLogNode, _aLogDepth, NUM_LOG_ROWS);
+  //
   // Create the sprites
   //
   #if GUIDEMO_SHOW_SPRITES
@@ -2630,6 +2744,8 @@ static void _DemoTreeview(void) {
       }
     }
   #endif
+  GUI_VTREE_Delete(&_Log);
+  WM_DeleteWindow(hLog);
   WM_DeleteWindow(hWin);
 }
 
@@ -0,0 +1,14 @@
+// tools/asset-packɣֹ޸ģ
+//   asset_pack -t -c GUIDEMO_ZoomAssets.c -H GUIDEMO_ZoomAssets.h -n GUIDEMO_ZoomAssets logo=auto:GUIDEMO_ZoomAndRotate.c@_acSeggerLogo_300x181 jtrace=auto:GUIDEMO_ZoomAndRotate.c@_acJTrace_300x164 jlink=auto:GUIDEMO_ZoomAndRotate.c@_acJLink_300x132 platine=auto:GUIDEMO_ZoomAndRotate.c@_acPlatine_250x200
+#ifndef __GUIDEMO_ZOOMASSETS_H__
+#define __GUIDEMO_ZOOMASSETS_H__
+
+extern const unsigned char GUIDEMO_ZoomAssets[];
+
+#define GUIDEMO_ZOOMASSETS_LOGO                (0)   // 300x181 pal
+#define GUIDEMO_ZOOMASSETS_JTRACE              (1)   // 300x164 argb
+#define GUIDEMO_ZOOMASSETS_JLINK               (2)   // 300x132 argb
+#define GUIDEMO_ZOOMASSETS_PLATINE             (3)   // 250x200 argb
+#define GUIDEMO_ZOOMASSETS_NUM                 (4)
+
+#endif
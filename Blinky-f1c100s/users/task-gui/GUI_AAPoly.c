@@ -0,0 +1,123 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "usrinc.h"
+#include "GUI_AAPoly.h"
+#include "GUI_AARaster.h"
+
+typedef struct {
+  U32* pData;                 // 洢豸
+  int xPos;                   // 洢豸ϽǵĻ
+  int yPos;
+  int Stride;
+  U32 Color;                  // 0x00RRGGBB
+} AAPolyDstType;
+
+// ݶֻGUI_Lock()֮ڷ
+static int32_t _aWork[AAPOLY_MAX_WIDTH + 3];
+static AARasterPointType _aPoint[AAPOLY_MAX_POINTS];
+
+////////////////////////////////////////////////////////////////////////////////
+static U32 __index(GUI_COLOR Color)
+{
+  return (GUI_COLOR_CONV_8888)->pfColor2Index(Color & 0xFFFFFF) & 0xFFFFFF;
+}
+
+/*
+* ΪaColorDstϣDst͸ȰemWinĴ淨(A=0xFFΪȫ͸)
+* ͸ĵ(ת֡)ǰ͸ı
+* @return: õ
+*/
+static U32 __blend(U32 Dst, U32 Color, U32 a)
+{
+  U32 da, oa, r, g, b;
+
+  da = (255 - (Dst >> 24)) * (255 - a) / 255;
+  oa = a + da;
+  if (oa == 0)
+    return Dst;
+  r = (((Color >> 16) & 0xFF) * a + ((Dst >> 16) & 0xFF) * da + oa / 2) / oa;
+  g = (((Color >> 8) & 0xFF) * a + ((Dst >> 8) & 0xFF) * da + oa / 2) / oa;
+  b = ((Color & 0xFF) * a + (Dst & 0xFF) * da + oa / 2) / oa;
+  return ((255 - oa) << 24) | (r << 16) | (g << 8) | b;
+}
+
+/*
+* GUI_AARasterһΣֱдϵϡ
+* ͬһĵɫһһͬʱֱһĽ
+* @return:
+*/
+static void __span(void* p, int32_t y, int32_t x, int32_t n, uint32_t alpha)
+{
+  AAPolyDstType* d = (AAPolyDstType*)p;
+  U32 *pDst, Last, Out;
+
+  pDst = d->pData + (y - d->yPos) * d->Stride + (x - d->xPos);
+  if (alpha == 255) {
+    while (n-- > 0)
+      *pDst++ = d->Color;
+    return;
+  }
+  Last = *pDst;
+  Out = __blend(Last, d->Color, alpha);
+  while (n-- > 0) {
+    if (*pDst != Last) {
+      Last = *pDst;
+      Out = __blend(Last, d->Color, alpha);
+    }
+    *pDst++ = Out;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_AAPOLY_FillPolygon
+//|  |: 
+//|          |:
+//| б |: ͬGUI_AA_FillPolygon()GUI_AA_EnableHiRes()ΪŴ
+//|          |: GUI_AA_GetFactor()ĸ߷ֱ
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ֻѡ32λ洢豸ʲ͸ʱԼԼ̫ࡢ
+//|          |: ̫ʱGUI_AA_FillPolygon()
+//|          |: صϽǣ(x,y)ռ[x,x+1)x[y,y+1)
+////////////////////////////////////////////////////////////////////////////////
+void GUI_AAPOLY_FillPolygon(const GUI_POINT* pPoints, int NumPoints, int x0, int y0)
+{
+  GUI_CONTEXT Context;
+  GUI_MEMDEV_Handle hMem;
+  AAPolyDstType Dst;
+  int i, Factor, xOff = 0, yOff = 0, cx0, cy0, cx1, cy1, r = -1;
+
+  GUI_Lock();
+  GUI_SaveContext(&Context);
+  hMem = Context.hDevData;
+  if (hMem != 0 && NumPoints >= 3 && NumPoints <= AAPOLY_MAX_POINTS && (Context.Color >> 24) == 0
+      && GUI_MEMDEV_GetBitsPerPixel(hMem) == 32) {
+    Factor = Context.AA_HiResEnable ? GUI_AA_GetFactor() : 1;
+#if GUI_WINSUPPORT
+    xOff = Context.xOff;
+    yOff = Context.yOff;
+#endif
+    for (i = 0; i < NumPoints; i++) {
+      _aPoint[i].x = (int32_t)((I64)(pPoints[i].x + x0) * AARASTER_ONE / Factor) + xOff * AARASTER_ONE;
+      _aPoint[i].y = (int32_t)((I64)(pPoints[i].y + y0) * AARASTER_ONE / Factor) + yOff * AARASTER_ONE;
+    }
+    Dst.pData = (U32*)GUI_MEMDEV_GetDataPtr(hMem);
+    Dst.xPos = GUI_MEMDEV_GetXPos(hMem);
+    Dst.yPos = GUI_MEMDEV_GetYPos(hMem);
+    Dst.Stride = GUI_MEMDEV_GetXSize(hMem);
+    Dst.Color = __index(Context.Color);
+    cx0 = GUI_MAX(Context.ClipRect.x0, Dst.xPos);
+    cy0 = GUI_MAX(Context.ClipRect.y0, Dst.yPos);
+    cx1 = GUI_MIN(Context.ClipRect.x1, Dst.xPos + Dst.Stride - 1);
+    cy1 = GUI_MIN(Context.ClipRect.y1, Dst.yPos + GUI_MEMDEV_GetYSize(hMem) - 1);
+    if (cx0 > cx1 || cy0 > cy1)
+      r = 0;
+    else
+      r = AARASTER_Fill(_aPoint, NumPoints, cx0, cy0, cx1, cy1, _aWork, GUI_COUNTOF(_aWork), __span, &Dst);
+  }
+  if (r < 0)
+    GUI_AA_FillPolygon(pPoints, NumPoints, x0, y0);
+  GUI_Unlock();
+}
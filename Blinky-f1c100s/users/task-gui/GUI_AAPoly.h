@@ -0,0 +1,31 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __GUI_AA_POLY_H__
+#define __GUI_AA_POLY_H__
+////////////////////////////////////////////////////////////////////////////////
+// GUI_AA_FillPolygon()͸߷ֱ(GUI_AA_EnableHiRes/SetFactor)
+// ĺ嶼䣬ѡ32λ洢豸ʱGUI_AARasterȷ㸲ʣֱӻ
+// 洢豸ݣʱŴ޹أԽemWin
+////////////////////////////////////////////////////////////////////////////////
+#include "GUI.h"
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+// 
+#ifndef AAPOLY_MAX_WIDTH
+#define AAPOLY_MAX_WIDTH      (1024)  // ڲüΧڵȣٿemWin
+#endif
+#ifndef AAPOLY_MAX_POINTS
+#define AAPOLY_MAX_POINTS     (64)    // ඥٶཻemWin
+#endif
+
+void GUI_AAPOLY_FillPolygon(const GUI_POINT* pPoints, int NumPoints, int x0, int y0);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __GUI_AA_POLY_H__ */
@@ -0,0 +1,225 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "GUI_AARaster.h"
+
+typedef struct {
+  int32_t* acc;               // ÿصĸȿȶ2
+  int32_t w;
+  int32_t lo;                 // иĶ±귶Χ
+  int32_t hi;
+} AARasterRowType;
+
+static void __touch(AARasterRowType* r, int32_t i0, int32_t i1)
+{
+  if (i0 < r->lo)
+    r->lo = i0;
+  if (i1 > r->hi)
+    r->hi = i1;
+}
+
+/*
+* xaxbһαߣdΪڱеĸ߶()
+* һÿɨֵaccȥ֮õd
+* @return:
+*/
+static void __line(AARasterRowType* r, int32_t xa, int32_t xb, int32_t d)
+{
+  int32_t* acc = r->acc;
+  int32_t x0, x1, i0, i1, i, f0, f1, a0, a1, am, c0, c1, cm, cs, sum;
+  int64_t s;
+
+  if (d == 0)
+    return;
+  x0 = (xa < xb) ? xa : xb;
+  x1 = (xa < xb) ? xb : xa;
+  i0 = x0 >> AARASTER_SHIFT;
+  i1 = (x1 + AARASTER_ONE - 1) >> AARASTER_SHIFT;
+  if (i1 <= i0 + 1) {
+    // ֻһеλ÷ָغұһ
+    f0 = x0 + ((x1 - x0) >> 1) - i0 * AARASTER_ONE;
+    c0 = (int32_t)(((int64_t)d * f0) >> AARASTER_SHIFT);
+    acc[i0] += d - c0;
+    acc[i0 + 1] += c0;
+    __touch(r, i0, i0 + 1);
+    return;
+  }
+  // أͷΣмÿطֵd/(x1-x0)
+  s = ((int64_t)1 << (2 * AARASTER_SHIFT)) / (x1 - x0);
+  f0 = (i0 + 1) * AARASTER_ONE - x0;
+  f1 = x1 - (i1 - 1) * AARASTER_ONE;
+  // f0f1x1-x0s*f0s*f11
+  a0 = (int32_t)((((s * f0) >> AARASTER_SHIFT) * f0) >> (AARASTER_SHIFT + 1));
+  am = (int32_t)((((s * f1) >> AARASTER_SHIFT) * f1) >> (AARASTER_SHIFT + 1));
+  c0 = (int32_t)(((int64_t)d * a0) >> AARASTER_SHIFT);
+  cm = (int32_t)(((int64_t)d * am) >> AARASTER_SHIFT);
+  acc[i0] += c0;
+  acc[i1] += cm;
+  if (i1 == i0 + 2) {
+    acc[i0 + 1] += d - c0 - cm;
+  } else {
+    a1 = (int32_t)((s * (f0 + AARASTER_ONE / 2)) >> AARASTER_SHIFT);
+    c1 = (int32_t)(((int64_t)d * (a1 - a0)) >> AARASTER_SHIFT);
+    cs = (int32_t)((d * s) >> AARASTER_SHIFT);
+    acc[i0 + 1] += c1;
+    sum = c0 + cm + c1;
+    for (i = i0 + 2; i < i1 - 1; i++) {
+      acc[i] += cs;
+      sum += cs;
+    }
+    // 鵽֤һۼص0
+    acc[i1 - 1] += d - sum;
+  }
+  __touch(r, i0, i1);
+}
+
+/*
+* (xa,ya)(xb,yb)һαߣԱлĿͷ
+* ұ߽ʱڽ㴦𿪣Ĳ߽ϣ
+* ߳ȻѺظұֻ߳ڲacc[w]
+* @return:
+*/
+static void __seg(AARasterRowType* r, int32_t xa, int32_t ya, int32_t xb, int32_t yb, int32_t dir)
+{
+  int32_t ab[2], b, yc, k;
+
+  ab[0] = 0;
+  ab[1] = r->w * AARASTER_ONE;
+  for (k = 0; k < 2; k++) {
+    b = ab[k];
+    if ((xa < b && xb > b) || (xa > b && xb < b)) {
+      yc = ya + (int32_t)((int64_t)(yb - ya) * (b - xa) / (xb - xa));
+      __seg(r, xa, ya, b, yc, dir);
+      __seg(r, b, yc, xb, yb, dir);
+      return;
+    }
+  }
+  xa = (xa < ab[0]) ? ab[0] : (xa > ab[1]) ? ab[1] : xa;
+  xb = (xb < ab[0]) ? ab[0] : (xb > ab[1]) ? ab[1] : xb;
+  __line(r, xa, xb, (yb - ya) * dir);
+}
+
+static int32_t __x_at(AARasterPointType const* a, AARasterPointType const* b, int32_t y)
+{
+  return a->x + (int32_t)((int64_t)(b->x - a->x) * (y - a->y) / (b->y - a->y));
+}
+
+/*
+* θǵطΧ()üεĽ
+* @return: 0ɹûн-1
+*/
+static int __bbox(AARasterPointType const* pts, int32_t n, int32_t* px0, int32_t* py0, int32_t* px1, int32_t* py1)
+{
+  int32_t xmin, ymin, xmax, ymax, i;
+
+  if (n < 3)
+    return -1;
+  xmin = xmax = pts[0].x;
+  ymin = ymax = pts[0].y;
+  for (i = 1; i < n; i++) {
+    if (pts[i].x < xmin)
+      xmin = pts[i].x;
+    if (pts[i].x > xmax)
+      xmax = pts[i].x;
+    if (pts[i].y < ymin)
+      ymin = pts[i].y;
+    if (pts[i].y > ymax)
+      ymax = pts[i].y;
+  }
+  xmin >>= AARASTER_SHIFT;
+  ymin >>= AARASTER_SHIFT;
+  xmax = ((xmax + AARASTER_ONE - 1) >> AARASTER_SHIFT) - 1;
+  ymax = ((ymax + AARASTER_ONE - 1) >> AARASTER_SHIFT) - 1;
+  if (xmin > *px0)
+    *px0 = xmin;
+  if (ymin > *py0)
+    *py0 = ymin;
+  if (xmax < *px1)
+    *px1 = xmax;
+  if (ymax < *py1)
+    *py1 = ymax;
+  return (*px0 > *px1 || *py0 > *py1) ? -1 : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: AARASTER_Fill
+//|  |: ȷ㸲
+//|          |:
+//| б |: pts: 16.16Ķ㣬n: (>=3)Զպ
+//|          |: x0,y0,x1,y1: ü(أ)
+//|          |: work: nwork: СΪü+2
+//|          |: pfSpan: дϵ¡ÿдʲΪ0Ķ
+//|          |:
+//|      |: ĶԻ-1
+//|          |:
+//| עϢ |: ÿаеı߹һ飬ʺ϶㲻Ķ(ָ롢̶ȵ)
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int AARASTER_Fill(AARasterPointType const* pts, int32_t n, int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                  int32_t* work, int32_t nwork, AARasterSpanFunc* pfSpan, void* p)
+{
+  AARasterRowType r;
+  AARasterPointType const *a, *b;
+  int32_t row, top, ya, yb, i, end, acc, cov, alpha, runx, runa, ox;
+  int spans = 0;
+
+  if (n < 3)
+    return -1;
+  if (__bbox(pts, n, &x0, &y0, &x1, &y1) != 0)
+    return 0;
+  r.acc = work;
+  r.w = x1 - x0 + 1;
+  if (nwork < r.w + 2)
+    return -1;
+  for (i = 0; i < r.w + 2; i++)
+    work[i] = 0;
+  ox = x0 * AARASTER_ONE;
+  for (row = y0; row <= y1; row++) {
+    top = row * AARASTER_ONE;
+    r.lo = r.w + 2;
+    r.hi = -1;
+    for (i = 0; i < n; i++) {
+      a = &pts[i];
+      b = &pts[(i + 1 < n) ? i + 1 : 0];
+      if (a->y == b->y)
+        continue;
+      if (a->y < b->y) {
+        ya = (top > a->y) ? top : a->y;
+        yb = (top + AARASTER_ONE < b->y) ? top + AARASTER_ONE : b->y;
+        if (ya < yb)
+          __seg(&r, __x_at(a, b, ya) - ox, ya, __x_at(a, b, yb) - ox, yb, 1);
+      } else {
+        ya = (top > b->y) ? top : b->y;
+        yb = (top + AARASTER_ONE < a->y) ? top + AARASTER_ONE : a->y;
+        if (ya < yb)
+          __seg(&r, __x_at(b, a, ya) - ox, ya, __x_at(b, a, yb) - ox, yb, -1);
+      }
+    }
+    // ۼӳɸʣͬһΣ˳ְùacc0
+    end = (r.hi < r.w) ? r.hi : r.w - 1;
+    acc = 0;
+    runx = r.lo;
+    runa = 0;
+    for (i = r.lo; i <= end; i++) {
+      acc += work[i];
+      work[i] = 0;
+      cov = (acc < 0) ? -acc : acc;
+      alpha = (cov >= AARASTER_ONE) ? 255 : (cov * 255 + AARASTER_ONE / 2) >> AARASTER_SHIFT;
+      if (alpha != runa) {
+        if (runa != 0) {
+          pfSpan(p, row, x0 + runx, i - runx, (uint32_t)runa);
+          spans++;
+        }
+        runx = i;
+        runa = alpha;
+      }
+    }
+    if (runa != 0 && i > runx) {
+      pfSpan(p, row, x0 + runx, i - runx, (uint32_t)runa);
+      spans++;
+    }
+    for (i = (end + 1 > r.lo) ? end + 1 : r.lo; i <= r.hi; i++)
+      work[i] = 0;
+  }
+  return spans;
+}
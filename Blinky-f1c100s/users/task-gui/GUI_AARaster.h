@@ -0,0 +1,38 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __GUI_AA_RASTER_H__
+#define __GUI_AA_RASTER_H__
+////////////////////////////////////////////////////////////////////////////////
+// ݶɨ裺16.16㣬ÿÿȷ
+// ۼӳɸʣֻѸʲΪ0ذ"ͬһ"
+// صֻͱ߾йأŴ޹ء
+// RTXemWin˵tools/aa-polyҲֱӱͼȶԡ
+//
+// ꣺(i,j)ռ[i,i+1)x[j,j+1)16.16㣻Ϊ㻷ơ
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+#define AARASTER_SHIFT    (16)
+#define AARASTER_ONE      ((int32_t)1 << AARASTER_SHIFT)  // 16.161
+
+typedef struct {
+  int32_t x;
+  int32_t y;
+} AARasterPointType;
+
+// yдxnظʶalpha(1~255)
+typedef void AARasterSpanFunc(void* p, int32_t y, int32_t x, int32_t n, uint32_t alpha);
+
+int AARASTER_Fill(AARasterPointType const* pts, int32_t n, int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                  int32_t* work, int32_t nwork, AARasterSpanFunc* pfSpan, void* p);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __GUI_AA_RASTER_H__ */
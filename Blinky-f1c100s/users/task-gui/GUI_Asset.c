@@ -0,0 +1,236 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "GUI_Asset.h"
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// 
+#ifndef ASSET_PNG_EN
+#define ASSET_PNG_EN      (0)         // 1=RAWPNGemWinPNG(ҪGUI_PNG)
+#endif
+
+typedef struct {
+  AssetArchiveType const* arc;
+  AssetEntryType e;
+} AssetRawType;
+
+// лϴеöGUI_Lock()֮ڣһ
+static AssetDecoderType _dec;
+static U32 _line[ASSET_MAX_WIDTH];
+
+static int __GetData(void* p, const U8** ppData, unsigned NumBytes, U32 Off)
+{
+  AssetRawType* raw = (AssetRawType*)p;
+
+  return ASSET_Read(raw->arc, &raw->e, ppData, NumBytes, Off);
+}
+
+/*
+* ļͷʶRAWԴ
+* @return: 'J'=JPEG 'G'=GIF 'B'=BMP 'P'=PNG 'S'=emWinλͼʶ0
+*/
+static int __raw_type(AssetRawType* raw)
+{
+  const U8* p;
+
+  if (__GetData(raw, &p, 4, 0) < 4)
+    return 0;
+  if (p[0] == 0xff && p[1] == 0xd8)
+    return 'J';
+  if (p[0] == 'G' && p[1] == 'I' && p[2] == 'F')
+    return 'G';
+  if (p[0] == 'B' && p[1] == 'M')
+    return 'B';
+  if (p[0] == 0x89 && p[1] == 'P' && p[2] == 'N' && p[3] == 'G')
+    return 'P';
+  return 'S';
+}
+
+static int __raw_draw(AssetRawType* raw, int x, int y)
+{
+  switch (__raw_type(raw)) {
+  case 'J':
+    return GUI_JPEG_DrawEx(__GetData, raw, x, y);
+  case 'G':
+    return GUI_GIF_DrawEx(__GetData, raw, x, y);
+  case 'B':
+    return GUI_BMP_DrawEx(__GetData, raw, x, y);
+#if ASSET_PNG_EN
+  case 'P':
+    return GUI_PNG_DrawEx(__GetData, raw, x, y);
+#endif
+  case 'S':
+    return GUI_DrawStreamedBitmapExAuto(__GetData, raw, x, y);
+  default:
+    return 1;
+  }
+}
+
+static int __raw_size(AssetRawType* raw, int* xSize, int* ySize)
+{
+  GUI_JPEG_INFO jpeg;
+  GUI_BITMAPSTREAM_INFO info;
+
+  switch (__raw_type(raw)) {
+  case 'J':
+    if (GUI_JPEG_GetInfoEx(__GetData, raw, &jpeg) != 0)
+      return -1;
+    *xSize = jpeg.XSize;
+    *ySize = jpeg.YSize;
+    return 0;
+  case 'G':
+    *xSize = GUI_GIF_GetXSizeEx(__GetData, raw);
+    *ySize = GUI_GIF_GetYSizeEx(__GetData, raw);
+    return 0;
+  case 'B':
+    *xSize = GUI_BMP_GetXSizeEx(__GetData, raw);
+    *ySize = GUI_BMP_GetYSizeEx(__GetData, raw);
+    return 0;
+#if ASSET_PNG_EN
+  case 'P':
+    *xSize = GUI_PNG_GetXSizeEx(__GetData, raw);
+    *ySize = GUI_PNG_GetYSizeEx(__GetData, raw);
+    return 0;
+#endif
+  case 'S':
+    if (GUI_GetStreamedBitmapInfoEx(__GetData, raw, &info) != 0)
+      return -1;
+    *xSize = info.XSize;
+    *ySize = info.YSize;
+    return 0;
+  default:
+    return -1;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_ASSET_GetSize
+//|  |: ȡԴĿ
+//|          |:
+//| б |: index: Դ±(asset_pack -Hɵĺ)
+//|          |:
+//|      |: 0ɹʧܷ-1
+//|          |:
+//| עϢ |: RAWԴҪļͷ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int GUI_ASSET_GetSize(AssetArchiveType const* arc, int index, int* xSize, int* ySize)
+{
+  AssetRawType raw;
+  int r;
+
+  if (ASSET_GetEntry(arc, index, &raw.e) != 0)
+    return -1;
+  if (raw.e.format != ASSET_FMT_RAW) {
+    *xSize = raw.e.width;
+    *ySize = raw.e.height;
+    return 0;
+  }
+  raw.arc = arc;
+  GUI_Lock();
+  r = __raw_size(&raw, xSize, ySize);
+  GUI_Unlock();
+  return r;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_ASSET_Draw
+//|  |: (x, y)Դ
+//|          |:
+//| б |:
+//|          |:
+//|      |: 0ɹʧܷ-1
+//|          |:
+//| עϢ |: ѹʽн룬ÿеһиߵGUI_DRAW_BMP8888λͼ
+//|          |: ֻռһеĻ壻RAWʽemWinӦ*Ex
+////////////////////////////////////////////////////////////////////////////////
+int GUI_ASSET_Draw(AssetArchiveType const* arc, int index, int x, int y)
+{
+  AssetRawType raw;
+  GUI_BITMAP bm;
+  int r = 0;
+
+  if (ASSET_GetEntry(arc, index, &raw.e) != 0)
+    return -1;
+  raw.arc = arc;
+  GUI_Lock();
+  if (raw.e.format == ASSET_FMT_RAW) {
+    r = (__raw_draw(&raw, x, y) == 0) ? 0 : -1;
+  } else if (ASSET_DecodeBegin(&_dec, arc, &raw.e, ASSET_OUT_M8888I) != 0) {
+    r = -1;
+  } else {
+    bm.XSize = raw.e.width;
+    bm.YSize = 1;
+    bm.BytesPerLine = raw.e.width * 4;
+    bm.BitsPerPixel = 32;
+    bm.pData = (U8 const*)_line;
+    bm.pPal = NULL;
+    bm.pMethods = GUI_DRAW_BMP8888;
+    while (r == 0 && _dec.y < raw.e.height) {
+      r = ASSET_DecodeLine(&_dec, (uint32_t*)_line);
+      if (r == 0)
+        GUI_DrawBitmap(&bm, x, y + _dec.y - 1);
+    }
+  }
+  GUI_Unlock();
+  return r;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_ASSET_CreateMemdev
+//|  |: ½һ32λ洢豸ԴŽȥ
+//|          |:
+//| б |:
+//|          |:
+//|      |: 洢豸ʧܷ0
+//|          |:
+//| עϢ |: ѹʽֱӽ뵽洢豸ͼ
+//|          |: RAWʽΪ͸ٻȥɵGUI_MEMDEV_Delete()
+////////////////////////////////////////////////////////////////////////////////
+GUI_MEMDEV_Handle GUI_ASSET_CreateMemdev(AssetArchiveType const* arc, int index)
+{
+  GUI_MEMDEV_Handle hMem, hOld;
+  GUI_COLOR BkColor;
+  AssetRawType raw;
+  U32* pData;
+  int xSize, ySize, r = 0;
+
+  if (GUI_ASSET_GetSize(arc, index, &xSize, &ySize) != 0 || xSize <= 0 || ySize <= 0)
+    return 0;
+  if (ASSET_GetEntry(arc, index, &raw.e) != 0)
+    return 0;
+  raw.arc = arc;
+  GUI_Lock();
+  hMem = GUI_MEMDEV_CreateFixed(0, 0, xSize, ySize, GUI_MEMDEV_NOTRANS, GUI_MEMDEV_APILIST_32, GUI_COLOR_CONV_8888);
+  if (hMem == 0) {
+    GUI_Unlock();
+    return 0;
+  }
+  if (raw.e.format == ASSET_FMT_RAW) {
+    hOld = GUI_MEMDEV_Select(hMem);
+    BkColor = GUI_GetBkColor();
+    GUI_SetBkColor(GUI_TRANSPARENT);
+    GUI_Clear();
+    r = __raw_draw(&raw, 0, 0);
+    GUI_SetBkColor(BkColor);
+    GUI_MEMDEV_Select(hOld);
+  } else {
+    pData = (U32*)GUI_MEMDEV_GetDataPtr(hMem);
+    r = ASSET_DecodeBegin(&_dec, arc, &raw.e, ASSET_OUT_M8888I);
+    while (r == 0 && _dec.y < ySize) {
+      r = ASSET_DecodeLine(&_dec, (uint32_t*)pData);
+      pData += xSize;
+    }
+  }
+  if (r != 0) {
+    GUI_MEMDEV_Delete(hMem);
+    hMem = 0;
+  }
+  GUI_Unlock();
+  return hMem;
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,25 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __GUI_ASSET_H__
+#define __GUI_ASSET_H__
+////////////////////////////////////////////////////////////////////////////////
+// ͼƬԴemWinӿڣѹʽн󻭳ֱӽ洢豸
+// RAWʽ(JPEG/GIF/BMP/emWinλͼ)ͨGUI_GET_DATA_FUNCemWin*Ex
+////////////////////////////////////////////////////////////////////////////////
+#include "GUI.h"
+#include "GUI_AssetDec.h"
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+int GUI_ASSET_GetSize(AssetArchiveType const* arc, int index, int* xSize, int* ySize);
+int GUI_ASSET_Draw(AssetArchiveType const* arc, int index, int x, int y);
+GUI_MEMDEV_Handle GUI_ASSET_CreateMemdev(AssetArchiveType const* arc, int index);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __GUI_ASSET_H__ */
@@ -0,0 +1,392 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "GUI_AssetDec.h"
+#include <string.h>
+
+#define ASSET_HEAD_SIZE   (16)
+#define ASSET_ENTRY_SIZE  (32)
+#define ASSET_READ_CHUNK  (512)
+
+static uint32_t __le16(uint8_t const* p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static uint32_t __le32(uint8_t const* p)
+{
+  return __le16(p) | (__le16(p + 2) << 16);
+}
+
+/*
+* ԴnֽڵbufصһθʱŶ
+* @return: 0ɹ-1
+*/
+static int __read(AssetArchiveType const* arc, uint32_t off, uint8_t* buf, uint32_t n)
+{
+  const uint8_t* p;
+  int got;
+
+  while (n > 0) {
+    got = arc->pfGetData(arc->p, &p, n, arc->base + off);
+    if (got <= 0)
+      return -1;
+    if ((uint32_t)got > n)
+      got = (int)n;
+    memcpy(buf, p, (size_t)got);
+    buf += got;
+    off += (uint32_t)got;
+    n -= (uint32_t)got;
+  }
+  return 0;
+}
+
+// emWin͸Ƿ(A=0xFFΪȫ͸)Ԥ˸ʽA=0xFFΪ͸
+static uint32_t __m8888i_to_premul(uint32_t c)
+{
+  uint32_t a = 255 - (c >> 24), r, g, b;
+
+  if (a == 255)
+    return 0xff000000UL | (c & 0x00ffffffUL);
+  if (a == 0)
+    return 0;
+  r = (((c >> 16) & 0xff) * a + 127) / 255;
+  g = (((c >> 8) & 0xff) * a + 127) / 255;
+  b = ((c & 0xff) * a + 127) / 255;
+  return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+static uint32_t __premul_to_m8888i(uint32_t c)
+{
+  uint32_t a = c >> 24, r, g, b;
+
+  if (a == 255)
+    return c & 0x00ffffffUL;
+  if (a == 0)
+    return 0xff000000UL;
+  r = (((c >> 16) & 0xff) * 255 + a / 2) / a;
+  g = (((c >> 8) & 0xff) * 255 + a / 2) / a;
+  b = ((c & 0xff) * 255 + a / 2) / a;
+  r = (r > 255) ? 255 : r;
+  g = (g > 255) ? 255 : g;
+  b = (b > 255) ? 255 : b;
+  return ((255 - a) << 24) | (r << 16) | (g << 8) | b;
+}
+
+/*
+* Ѵ洢ʽһ32λתΪʽ
+* @return: 
+*/
+static uint32_t __convert(AssetDecoderType const* d, uint32_t c)
+{
+  if (d->e.format == ASSET_FMT_PREMUL_RLE)
+    return (d->out == ASSET_OUT_PREMUL) ? c : __premul_to_m8888i(c);
+  return (d->out == ASSET_OUT_PREMUL) ? __m8888i_to_premul(c) : c;
+}
+
+static int __getc(AssetDecoderType* d)
+{
+  const uint8_t* p;
+  uint32_t n;
+  int got;
+
+  if (d->avail == 0) {
+    if (d->off >= d->e.size)
+      return -1;
+    n = d->e.size - d->off;
+    if (n > ASSET_READ_CHUNK)
+      n = ASSET_READ_CHUNK;
+    got = ASSET_Read(d->arc, &d->e, &p, n, d->off);
+    if (got <= 0)
+      return -1;
+    d->src = p;
+    d->avail = (uint32_t)got;
+    d->off += (uint32_t)got;
+  }
+  d->avail--;
+  return *d->src++;
+}
+
+/*
+* ȡһأ32λʽΪ4ֽСˣɫʽΪ1ֽ±
+* @return: 0ɹݲ-1
+*/
+static int __getpixel(AssetDecoderType* d, uint32_t* c)
+{
+  int i, v;
+
+  if (d->e.format == ASSET_FMT_PAL_RLE) {
+    v = __getc(d);
+    if (v < 0 || v >= d->e.ncolors)
+      return -1;
+    *c = d->pal[v];
+    return 0;
+  }
+  *c = 0;
+  for (i = 0; i < 32; i += 8) {
+    v = __getc(d);
+    if (v < 0)
+      return -1;
+    *c |= (uint32_t)v << i;
+  }
+  *c = __convert(d, *c);
+  return 0;
+}
+
+static int __decode_rle(AssetDecoderType* d, uint32_t* line)
+{
+  uint32_t i = 0, k, w = d->e.width;
+  int t;
+
+  while (i < w) {
+    if (d->run == 0) {
+      t = __getc(d);
+      if (t < 0)
+        return -1;
+      d->run = (uint32_t)(t & 0x7f) + 1;
+      d->literal = (t & 0x80) ? 0 : 1;
+      if (!d->literal && __getpixel(d, &d->color) != 0)
+        return -1;
+    }
+    k = (d->run < w - i) ? d->run : w - i;
+    d->run -= k;
+    if (d->literal) {
+      while (k--) {
+        if (__getpixel(d, &line[i++]) != 0)
+          return -1;
+      }
+    } else {
+      while (k--)
+        line[i++] = d->color;
+    }
+  }
+  return 0;
+}
+
+static int __decode_565a8(AssetDecoderType* d, uint32_t* line)
+{
+  uint32_t i, c, r, g, b, w = d->e.width;
+  int lo, hi, a;
+
+  for (i = 0; i < w; i++) {
+    lo = __getc(d);
+    hi = __getc(d);
+    if (hi < 0)
+      return -1;
+    line[i] = (uint32_t)lo | ((uint32_t)hi << 8);
+  }
+  for (i = 0; i < w; i++) {
+    a = __getc(d);
+    if (a < 0)
+      return -1;
+    c = line[i];
+    r = (c >> 11) & 0x1f;
+    g = (c >> 5) & 0x3f;
+    b = c & 0x1f;
+    c = (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+    line[i] = __convert(d, ((uint32_t)(255 - a) << 24) | c);
+  }
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: ASSET_GetDataMem
+//|  |: ڴԴȡݻص
+//|          |:
+//| б |: p: Դ׵ַ
+//|          |:
+//|      |: ɶֽ
+//|          |:
+//| עϢ |: ֱӷָڴָ룬
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int ASSET_GetDataMem(void* p, const uint8_t** ppData, unsigned NumBytes, uint32_t Off)
+{
+  *ppData = (const uint8_t*)p + Off;
+  return (int)NumBytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: ASSET_Open
+//|  |: ԴͷԴ
+//|          |:
+//| б |: pfGetData: ȡݻصڴеԴASSET_GetDataMem
+//|          |: p: ص
+//|          |: base: ԴԴƫ
+//|          |:
+//|      |: 0ɹԴ-1
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int ASSET_Open(AssetArchiveType* arc, AssetGetDataFunc* pfGetData, void* p, uint32_t base)
+{
+  uint8_t h[ASSET_HEAD_SIZE];
+
+  arc->pfGetData = pfGetData;
+  arc->p = p;
+  arc->base = base;
+  arc->size = 0;
+  arc->count = 0;
+  if (__read(arc, 0, h, sizeof(h)) != 0)
+    return -1;
+  if (__le32(h) != ASSET_MAGIC || __le16(h + 4) != ASSET_VERSION)
+    return -1;
+  arc->count = (uint16_t)__le16(h + 6);
+  arc->size = __le32(h + 8);
+  if (arc->size < ASSET_HEAD_SIZE + (uint32_t)arc->count * ASSET_ENTRY_SIZE) {
+    arc->count = 0;
+    return -1;
+  }
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: ASSET_GetEntry
+//|  |: indexԴ
+//|          |:
+//| б |:
+//|          |:
+//|      |: 0ɹ±Խ𻵷-1
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int ASSET_GetEntry(AssetArchiveType const* arc, int index, AssetEntryType* e)
+{
+  uint8_t b[ASSET_ENTRY_SIZE];
+
+  if (index < 0 || index >= arc->count)
+    return -1;
+  if (__read(arc, ASSET_HEAD_SIZE + (uint32_t)index * ASSET_ENTRY_SIZE, b, sizeof(b)) != 0)
+    return -1;
+  memcpy(e->name, b, ASSET_NAME_MAX);
+  e->name[ASSET_NAME_MAX - 1] = 0;
+  e->offset = __le32(b + 16);
+  e->size = __le32(b + 20);
+  e->width = (uint16_t)__le16(b + 24);
+  e->height = (uint16_t)__le16(b + 26);
+  e->format = b[28];
+  e->flags = b[29];
+  e->ncolors = (uint16_t)__le16(b + 30);
+  if (e->offset > arc->size || e->size > arc->size - e->offset || e->format >= ASSET_FMT_NUM)
+    return -1;
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: ASSET_Find
+//|  |: ֲԴ
+//|          |:
+//| б |:
+//|          |:
+//|      |: Դ±꣬Ҳ-1
+//|          |:
+//| עϢ |: ˳ȽϣƵʹʱasset_packɵ±ꡣ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int ASSET_Find(AssetArchiveType const* arc, char const* name, AssetEntryType* e)
+{
+  int i;
+
+  for (i = 0; i < arc->count; i++) {
+    if (ASSET_GetEntry(arc, i, e) == 0 && !strncmp(e->name, name, ASSET_NAME_MAX))
+      return i;
+  }
+  return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: ASSET_Read
+//|  |: ȡԴݣ뷵ֵͬGUI_GET_DATA_FUNC
+//|          |:
+//| б |: Off: Դݿͷƫ
+//|          |:
+//|      |: ɶֽԴʱΪ0
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int ASSET_Read(AssetArchiveType const* arc, AssetEntryType const* e, const uint8_t** ppData, unsigned NumBytes, uint32_t Off)
+{
+  if (Off >= e->size)
+    return 0;
+  if (NumBytes > e->size - Off)
+    NumBytes = e->size - Off;
+  return arc->pfGetData(arc->p, ppData, NumBytes, arc->base + e->offset + Off);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: ASSET_DecodeBegin
+//|  |: ׼ӵһпʼһλͼԴ
+//|          |:
+//| б |: out: ظʽASSET_OUT_xxx
+//|          |:
+//|      |: 0ɹRAWʽԷ-1
+//|          |:
+//| עϢ |: ɫ벢תá
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int ASSET_DecodeBegin(AssetDecoderType* d, AssetArchiveType const* arc, AssetEntryType const* e, int32_t out)
+{
+  uint32_t i;
+
+  if (e->format == ASSET_FMT_RAW || e->format >= ASSET_FMT_NUM || e->width == 0 ||
+      e->width > ASSET_MAX_WIDTH || e->height == 0)
+    return -1;
+  if (e->format == ASSET_FMT_PAL_RLE && (e->ncolors == 0 || e->ncolors > 256))
+    return -1;
+  d->arc = arc;
+  d->e = *e;
+  d->out = out;
+  d->y = 0;
+  d->off = 0;
+  d->src = NULL;
+  d->avail = 0;
+  d->run = 0;
+  d->literal = 0;
+  d->color = 0;
+  if (e->format == ASSET_FMT_PAL_RLE) {
+    d->e.format = ASSET_FMT_ARGB_RLE;   // ɫ32λض
+    for (i = 0; i < e->ncolors; i++) {
+      if (__getpixel(d, &d->pal[i]) != 0)
+        return -1;
+    }
+    d->e.format = ASSET_FMT_PAL_RLE;
+  }
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: ASSET_DecodeLine
+//|  |: һ
+//|          |:
+//| б |: line: width
+//|          |:
+//|      |: 0ɹѵһл𻵷-1
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int ASSET_DecodeLine(AssetDecoderType* d, uint32_t* line)
+{
+  int r;
+
+  if (d->y >= d->e.height)
+    return -1;
+  if (d->e.format == ASSET_FMT_565A8)
+    r = __decode_565a8(d, line);
+  else
+    r = __decode_rle(d, line);
+  if (r == 0)
+    d->y++;
+  return r;
+}
+
+////////////////////////////////////////////////////////////////////////////////
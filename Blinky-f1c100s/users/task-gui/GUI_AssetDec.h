@@ -0,0 +1,99 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __GUI_ASSET_DEC_H__
+#define __GUI_ASSET_DEC_H__
+////////////////////////////////////////////////////////////////////////////////
+// ͼƬԴ(tools/asset-pack)н룬RTXemWin
+// ˴ҲֱӱضУ顣
+//
+// ԴȫΪСˣ
+//   AssetHeadType + AssetEntryType[count] + Դ
+// ͨemWinGUI_GET_DATA_FUNCͬĻصȡԴڴ
+// ҲⲿFlash/ļʱֻ˳ѹݣҪͼĻ塣
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+#define ASSET_MAGIC       (0x54534147UL)  // "GAST"
+#define ASSET_VERSION     (1)
+#define ASSET_NAME_MAX    (16)            // ֺβ0
+#define ASSET_MAX_WIDTH   (1024)
+
+// 洢ʽ
+#define ASSET_FMT_RAW         (0)   // ԭ(JPEG/PNG/GIF/BMP/emWinλͼ)emWin
+#define ASSET_FMT_ARGB_RLE    (1)   // 32λRLE
+#define ASSET_FMT_PAL_RLE     (2)   // ɫ(<=256ɫ) + 8λ±RLE
+#define ASSET_FMT_PREMUL_RLE  (3)   // Ԥalpha32λRLE
+#define ASSET_FMT_565A8       (4)   // ÿRGB565A8ѹ
+#define ASSET_FMT_NUM         (5)
+
+// ظʽ
+#define ASSET_OUT_M8888I      (0)   // emWinGUI_DRAW_BMP88880xAARRGGBBA=0xFFΪȫ͸
+#define ASSET_OUT_PREMUL      (1)   // ԤARGBA=0xFFΪ͸RGBѳAֱdst = src + dst * (255 - A) / 255
+
+#define ASSET_FLAG_ALPHA      (1 << 0)  // ͸
+
+typedef struct {
+  uint32_t magic;             // ASSET_MAGIC
+  uint16_t version;
+  uint16_t count;             // Դ
+  uint32_t size;              // Դֽ
+  uint32_t reserved;
+} AssetHeadType;
+
+typedef struct {
+  char name[ASSET_NAME_MAX];
+  uint32_t offset;            // Դͷƫ
+  uint32_t size;              // ֽ
+  uint16_t width;             // RAWʽΪ0
+  uint16_t height;
+  uint8_t format;             // ASSET_FMT_xxx
+  uint8_t flags;              // ASSET_FLAG_xxx
+  uint16_t ncolors;           // PAL_RLEĵɫ
+} AssetEntryType;
+
+// emWinGUI_GET_DATA_FUNCһ£OffȡNumBytesֽڣ*ppDataָݣʵֽ
+typedef int AssetGetDataFunc(void* p, const uint8_t** ppData, unsigned NumBytes, uint32_t Off);
+
+typedef struct {
+  AssetGetDataFunc* pfGetData;
+  void* p;
+  uint32_t base;              // ԴԴƫ
+  uint32_t size;
+  uint16_t count;
+} AssetArchiveType;
+
+typedef struct {
+  AssetArchiveType const* arc;
+  AssetEntryType e;
+  int32_t out;                // ASSET_OUT_xxx
+  int32_t y;                  // һ
+  uint32_t off;               // һѹֽڵƫ(Դ)
+  uint8_t const* src;         // ǰȡݿ
+  uint32_t avail;
+  uint32_t run;               // RLEǰλʣ
+  int32_t literal;            // ǰǷΪ
+  uint32_t color;             // ظε(ɫ±)
+  uint32_t pal[256];          // תΪʽĵɫ
+} AssetDecoderType;
+
+// ڴԴpΪԴ׵ַ
+int ASSET_GetDataMem(void* p, const uint8_t** ppData, unsigned NumBytes, uint32_t Off);
+
+int ASSET_Open(AssetArchiveType* arc, AssetGetDataFunc* pfGetData, void* p, uint32_t base);
+int ASSET_GetEntry(AssetArchiveType const* arc, int index, AssetEntryType* e);
+int ASSET_Find(AssetArchiveType const* arc, char const* name, AssetEntryType* e);
+int ASSET_Read(AssetArchiveType const* arc, AssetEntryType const* e, const uint8_t** ppData, unsigned NumBytes, uint32_t Off);
+
+int ASSET_DecodeBegin(AssetDecoderType* d, AssetArchiveType const* arc, AssetEntryType const* e, int32_t out);
+int ASSET_DecodeLine(AssetDecoderType* d, uint32_t* line);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __GUI_ASSET_DEC_H__ */
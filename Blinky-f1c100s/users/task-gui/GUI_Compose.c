@@ -0,0 +1,746 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "usrinc.h"
+#include "GUI_Compose.h"
+#include "framebuffer.h"
+#include <string.h>
+#include <stdio.h>
+
+#if COMPOSE_MAX_XTILES > 32
+#error COMPOSE_MAX_XTILES must fit in the U32 dirty mask!
+#endif
+#if COMPOSE_MAX_CMDS > 64
+#error COMPOSE_MAX_CMDS must fit in the U64 tile bin!
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+enum {
+  COMPOSE_CMD_FILL = 1,
+  COMPOSE_CMD_GRADIENTV,
+  COMPOSE_CMD_GRADIENTH,
+  COMPOSE_CMD_MEMDEV
+};
+
+#define COMPOSE_STRIDE        (COMPOSE_MAX_XTILES * COMPOSE_TILE)
+
+// ݶֻGUI_Lock()֮ڷ
+// һпĺϳɽϳʱΪԤ˵ARGB(A=0xFFΪ͸)дǰתGUI_DRAW_BMP8888
+static U32 _aStrip[COMPOSE_TILE * COMPOSE_STRIDE] MEM_PI_CPUONLY CACHE_ALIGNED;
+
+static U32 __index(GUI_COLOR Color)
+{
+  return (GUI_COLOR_CONV_8888)->pfColor2Index(Color & 0xFFFFFF) & 0xFFFFFF;
+}
+
+// a*b/255
+static U32 __mul255(U32 a, U32 b)
+{
+  U32 t = a * b + 128;
+
+  return (t + (t >> 8)) >> 8;
+}
+
+static U32 __premul(U32 Color, U32 a)
+{
+  if (a == 255)
+    return 0xFF000000UL | Color;
+  return (a << 24) | (__mul255((Color >> 16) & 0xFF, a) << 16) |
+         (__mul255((Color >> 8) & 0xFF, a) << 8) | __mul255(Color & 0xFF, a);
+}
+
+/*
+* ǰϳɣs(Ԥ)浽d棬dѾ͸ʱs
+* @return: ϳɺ
+*/
+static U32 __under(U32 d, U32 s)
+{
+  U32 k = 255 - (d >> 24);
+
+  if (k == 0)
+    return d;
+  if (k == 255)
+    return s;
+  return d + ((__mul255(s >> 24, k) << 24) | (__mul255((s >> 16) & 0xFF, k) << 16) |
+              (__mul255((s >> 8) & 0xFF, k) << 8) | __mul255(s & 0xFF, k));
+}
+
+// i(n)ɫ
+static U32 __lerp(U32 c0, U32 c1, int i, int n)
+{
+  U32 r = 0;
+  int Shift, v0, v1;
+
+  if (n <= 0)
+    return c0;
+  for (Shift = 0; Shift < 24; Shift += 8) {
+    v0 = (c0 >> Shift) & 0xFF;
+    v1 = (c1 >> Shift) & 0xFF;
+    r |= (U32)(v0 + (v1 - v0) * i / n) << Shift;
+  }
+  return r;
+}
+
+static U8 __alpha(ComposeType const* p, int Cmd)
+{
+  return (U8)__mul255(p->aCmd[Cmd].Alpha, p->aLayer[p->aCmd[Cmd].Layer].Alpha);
+}
+
+/*
+* ľΣõ֮
+* @return: 0ɹȫڴⷵ-1
+*/
+static int __cmd_rect(ComposeType const* p, int Cmd, GUI_RECT* r)
+{
+  ComposeCmdType const* c = &p->aCmd[Cmd];
+  ComposeLayerType const* l = &p->aLayer[c->Layer];
+
+  r->x0 = GUI_MAX(c->Rect.x0 + l->x0, 0);
+  r->y0 = GUI_MAX(c->Rect.y0 + l->y0, 0);
+  r->x1 = GUI_MIN(c->Rect.x1 + l->x0, p->xSize - 1);
+  r->y1 = GUI_MIN(c->Rect.y1 + l->y0, p->ySize - 1);
+  return (r->x0 > r->x1 || r->y0 > r->y1) ? -1 : 0;
+}
+
+static void __tile_rect(ComposeType const* p, int tx, int ty, GUI_RECT* r)
+{
+  r->x0 = tx * COMPOSE_TILE;
+  r->y0 = ty * COMPOSE_TILE;
+  r->x1 = GUI_MIN(r->x0 + COMPOSE_TILE, p->xSize) - 1;
+  r->y1 = GUI_MIN(r->y0 + COMPOSE_TILE, p->ySize) - 1;
+}
+
+static int __opaque(GUI_MEMDEV_Handle hMem)
+{
+  U32 const* pData = (U32 const*)GUI_MEMDEV_GetDataPtr(hMem);
+  int i, n = GUI_MEMDEV_GetXSize(hMem) * GUI_MEMDEV_GetYSize(hMem);
+
+  // emWin32λ洢豸alphaǷģ0ʾ͸
+  for (i = 0; i < n && (pData[i] >> 24) == 0; i++);
+  return i == n;
+}
+
+static void __dirty_cmd(ComposeType* p, int Cmd)
+{
+  GUI_RECT r;
+  int ty, tx0, tx1;
+
+  if (__cmd_rect(p, Cmd, &r) != 0)
+    return;
+  tx0 = r.x0 / COMPOSE_TILE;
+  tx1 = r.x1 / COMPOSE_TILE;
+  for (ty = r.y0 / COMPOSE_TILE; ty <= r.y1 / COMPOSE_TILE; ty++)
+    p->aDirty[ty] |= (0xFFFFFFFFUL >> (31 - tx1)) & ~((1UL << tx0) - 1);
+}
+
+static void __dirty_layer(ComposeType* p, int Layer)
+{
+  int i;
+
+  for (i = 0; i < p->aLayer[Layer].NumCmds; i++)
+    __dirty_cmd(p, p->aLayer[Layer].FirstCmd + i);
+}
+
+/*
+* ÿüǵǵĿÿٴǰҵһ
+* Ĳ͸޳
+* @return:
+*/
+static void __bin(ComposeType* p)
+{
+  GUI_RECT r, t;
+  int i, k, tx, ty;
+  U64 m, Culled;
+
+  memset(p->aBin, 0, sizeof(p->aBin));
+  for (i = 0; i < p->NumCmds; i++) {
+    if (__alpha(p, i) == 0 || __cmd_rect(p, i, &r) != 0)
+      continue;
+    for (ty = r.y0 / COMPOSE_TILE; ty <= r.y1 / COMPOSE_TILE; ty++) {
+      for (tx = r.x0 / COMPOSE_TILE; tx <= r.x1 / COMPOSE_TILE; tx++)
+        p->aBin[ty][tx] |= (U64)1 << i;
+    }
+  }
+  for (ty = 0; ty < p->NumY; ty++) {
+    for (tx = 0; tx < p->NumX; tx++) {
+      m = p->aBin[ty][tx];
+      __tile_rect(p, tx, ty, &t);
+      for (k = p->NumCmds - 1; k > 0; k--) {
+        if (((m >> k) & 1) == 0 || !p->aCmd[k].Opaque || __alpha(p, k) != 255)
+          continue;
+        __cmd_rect(p, k, &r);
+        if (r.x0 <= t.x0 && r.y0 <= t.y0 && r.x1 >= t.x1 && r.y1 >= t.y1) {
+          Culled = m & (((U64)1 << k) - 1);
+          p->aBin[ty][tx] = m & ~Culled;
+          for (; Culled != 0; Culled &= Culled - 1)
+            p->Stat.CmdsCulled++;
+          break;
+        }
+      }
+    }
+  }
+  p->NeedBin = 0;
+}
+
+/*
+* ϳһ飺Ľǰÿֻϵ͸Ϊֹ
+* дpTile(оCOMPOSE_STRIDE)ûĵط
+* @return:
+*/
+static void __resolve(ComposeType* p, int tx, int ty, U32* pTile)
+{
+  ComposeCmdType const* c;
+  GUI_RECT t, r;
+  U32 const* pSrc;
+  U32 *pDst, s, a, sa, Pix;
+  int k, x, y, SrcStride;
+  U64 m = p->aBin[ty][tx];
+
+  __tile_rect(p, tx, ty, &t);
+  for (y = 0; y <= t.y1 - t.y0; y++)
+    memset(pTile + y * COMPOSE_STRIDE, 0, (t.x1 - t.x0 + 1) * 4);
+  for (k = p->NumCmds - 1; k >= 0; k--) {
+    if (((m >> k) & 1) == 0)
+      continue;
+    c = &p->aCmd[k];
+    a = __alpha(p, k);
+    __cmd_rect(p, k, &r);
+    r.x0 = GUI_MAX(r.x0, t.x0);
+    r.y0 = GUI_MAX(r.y0, t.y0);
+    r.x1 = GUI_MIN(r.x1, t.x1);
+    r.y1 = GUI_MIN(r.y1, t.y1);
+    for (y = r.y0; y <= r.y1; y++) {
+      pDst = pTile + (y - t.y0) * COMPOSE_STRIDE + (r.x0 - t.x0);
+      switch (c->Type) {
+      case COMPOSE_CMD_FILL:
+      case COMPOSE_CMD_GRADIENTV:
+        if (c->Type == COMPOSE_CMD_FILL)
+          s = __premul(c->Color0, a);
+        else
+          s = __premul(__lerp(c->Color0, c->Color1, y - (c->Rect.y0 + p->aLayer[c->Layer].y0), c->Rect.y1 - c->Rect.y0), a);
+        for (x = r.x0; x <= r.x1; x++, pDst++)
+          *pDst = __under(*pDst, s);
+        break;
+      case COMPOSE_CMD_GRADIENTH:
+        for (x = r.x0; x <= r.x1; x++, pDst++) {
+          if ((*pDst >> 24) != 0xFF)
+            *pDst = __under(*pDst, __premul(__lerp(c->Color0, c->Color1, x - (c->Rect.x0 + p->aLayer[c->Layer].x0), c->Rect.x1 - c->Rect.x0), a));
+        }
+        break;
+      case COMPOSE_CMD_MEMDEV:
+        SrcStride = c->Rect.x1 - c->Rect.x0 + 1;
+        pSrc = (U32 const*)GUI_MEMDEV_GetDataPtr(c->hMem) + (y - (c->Rect.y0 + p->aLayer[c->Layer].y0)) * SrcStride +
+               (r.x0 - (c->Rect.x0 + p->aLayer[c->Layer].x0));
+        for (x = r.x0; x <= r.x1; x++, pDst++) {
+          Pix = *pSrc++;
+          sa = __mul255(255 - (Pix >> 24), a);
+          if (sa != 0 && (*pDst >> 24) != 0xFF)
+            *pDst = __under(*pDst, __premul(Pix & 0xFFFFFF, sa));
+        }
+        break;
+      }
+    }
+    p->Stat.CmdsResolved++;
+  }
+  // Ԥ˵ĽǵںɫϵɫA=0ΪGUI_DRAW_BMP8888Ĳ͸
+  for (y = 0; y <= t.y1 - t.y0; y++) {
+    pDst = pTile + y * COMPOSE_STRIDE;
+    for (x = 0; x <= t.x1 - t.x0; x++, pDst++)
+      *pDst &= 0xFFFFFF;
+  }
+}
+
+static void __draw(U32 const* pData, int xSize, int ySize, int x, int y)
+{
+  GUI_BITMAP bm;
+
+  bm.XSize = xSize;
+  bm.YSize = ySize;
+  bm.BytesPerLine = COMPOSE_STRIDE * 4;
+  bm.BitsPerPixel = 32;
+  bm.pData = (U8 const*)pData;
+  bm.pPal = NULL;
+  bm.pMethods = GUI_DRAW_BMP8888;
+  GUI_DrawBitmap(&bm, x, y);
+}
+
+/*
+* һһ
+* @return: ±꣬ûвŲ·-1
+*/
+static int __add(ComposeType* p, int Type, int x0, int y0, int x1, int y1)
+{
+  ComposeCmdType* c;
+
+  if (p->NumLayers == 0 || p->NumCmds >= COMPOSE_MAX_CMDS || x0 > x1 || y0 > y1)
+    return -1;
+  c = &p->aCmd[p->NumCmds];
+  memset(c, 0, sizeof(*c));
+  c->Type = (U8)Type;
+  c->Alpha = 255;
+  c->Opaque = 1;
+  c->Layer = (U8)(p->NumLayers - 1);
+  c->Rect.x0 = x0;
+  c->Rect.y0 = y0;
+  c->Rect.x1 = x1;
+  c->Rect.y1 = y1;
+  p->aLayer[c->Layer].NumCmds++;
+  p->NeedBin = 1;
+  return p->NumCmds++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_Create
+//|  |: Ͻһϳ
+//|          |:
+//| б |: hWin: ڣWM_PAINTGUI_COMPOSE_Paint()
+//|          |:
+//|      |: 0ɹ̫СΪ0-1
+//|          |:
+//| עϢ |: 궼ڣ治Ҫ͸ڣ
+//|          |: ֻʱǸǵ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int GUI_COMPOSE_Create(ComposeType* p, WM_HWIN hWin)
+{
+  int ty;
+
+  memset(p, 0, sizeof(*p));
+  p->hWin = hWin;
+  p->xSize = WM_GetWindowSizeX(hWin);
+  p->ySize = WM_GetWindowSizeY(hWin);
+  p->NumX = (p->xSize + COMPOSE_TILE - 1) / COMPOSE_TILE;
+  p->NumY = (p->ySize + COMPOSE_TILE - 1) / COMPOSE_TILE;
+  if (p->NumX == 0 || p->NumY == 0 || p->NumX > COMPOSE_MAX_XTILES || p->NumY > COMPOSE_MAX_YTILES)
+    return -1;
+  for (ty = 0; ty < p->NumY; ty++)
+    p->aDirty[ty] = 0xFFFFFFFFUL >> (32 - p->NumX);
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_AddLayer
+//|  |: һ㣬Ժӵһ
+//|          |:
+//| б |: x0,y0: λ
+//|          |: Alpha: Ĳ͸
+//|          |:
+//|      |: ±꣬Ų·-1
+//|          |:
+//| עϢ |: 㰴Ӻǰ˳ӣ˳
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int GUI_COMPOSE_AddLayer(ComposeType* p, int x0, int y0, U8 Alpha)
+{
+  ComposeLayerType* l;
+
+  if (p->NumLayers >= COMPOSE_MAX_LAYERS)
+    return -1;
+  l = &p->aLayer[p->NumLayers];
+  l->x0 = x0;
+  l->y0 = y0;
+  l->Alpha = Alpha;
+  l->FirstCmd = (U8)p->NumCmds;
+  l->NumCmds = 0;
+  return p->NumLayers++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_FillRect
+//|  |: 
+//|          |:
+//| б |: x0,y0,x1,y1: ()
+//|          |: Alpha: ͸ȣٳԲĲ͸
+//|          |:
+//|      |: ±꣬ʧܷ-1
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int GUI_COMPOSE_FillRect(ComposeType* p, int x0, int y0, int x1, int y1, GUI_COLOR Color, U8 Alpha)
+{
+  int Cmd;
+
+  GUI_Lock();
+  Cmd = __add(p, COMPOSE_CMD_FILL, x0, y0, x1, y1);
+  if (Cmd >= 0) {
+    p->aCmd[Cmd].Color0 = __index(Color);
+    p->aCmd[Cmd].Alpha = Alpha;
+    __dirty_cmd(p, Cmd);
+  }
+  GUI_Unlock();
+  return Cmd;
+}
+
+static int __gradient(ComposeType* p, int Type, int x0, int y0, int x1, int y1, GUI_COLOR Color0, GUI_COLOR Color1)
+{
+  int Cmd;
+
+  GUI_Lock();
+  Cmd = __add(p, Type, x0, y0, x1, y1);
+  if (Cmd >= 0) {
+    p->aCmd[Cmd].Color0 = __index(Color0);
+    p->aCmd[Cmd].Color1 = __index(Color1);
+    __dirty_cmd(p, Cmd);
+  }
+  GUI_Unlock();
+  return Cmd;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_GradientV
+//|  |: ֱ䣬ͬGUI_DrawGradientV()
+//|          |:
+//| б |:
+//|          |:
+//|      |: ±꣬ʧܷ-1
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int GUI_COMPOSE_GradientV(ComposeType* p, int x0, int y0, int x1, int y1, GUI_COLOR Color0, GUI_COLOR Color1)
+{
+  return __gradient(p, COMPOSE_CMD_GRADIENTV, x0, y0, x1, y1, Color0, Color1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_GradientH
+//|  |: ˮƽ䣬ͬGUI_DrawGradientH()
+//|          |:
+//| б |:
+//|          |:
+//|      |: ±꣬ʧܷ-1
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int GUI_COMPOSE_GradientH(ComposeType* p, int x0, int y0, int x1, int y1, GUI_COLOR Color0, GUI_COLOR Color1)
+{
+  return __gradient(p, COMPOSE_CMD_GRADIENTH, x0, y0, x1, y1, Color0, Color1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_Memdev
+//|  |: һ32λ洢豸(֡ͼꡢõͼƬ)
+//|          |:
+//| б |: x,y: ϽǵĲ
+//|          |: Alpha: ͸ȣٳԼĺͲĲ͸
+//|          |:
+//|      |: ±꣬ʧܷ-1
+//|          |:
+//| עϢ |: 洢豸ߣɾϳ֮ǰɾݸҪ
+//|          |: GUI_COMPOSE_InvalidateCmd()
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int GUI_COMPOSE_Memdev(ComposeType* p, GUI_MEMDEV_Handle hMem, int x, int y, U8 Alpha)
+{
+  int Cmd;
+
+  if (hMem == 0 || GUI_MEMDEV_GetBitsPerPixel(hMem) != 32)
+    return -1;
+  GUI_Lock();
+  Cmd = __add(p, COMPOSE_CMD_MEMDEV, x, y, x + GUI_MEMDEV_GetXSize(hMem) - 1, y + GUI_MEMDEV_GetYSize(hMem) - 1);
+  if (Cmd >= 0) {
+    p->aCmd[Cmd].hMem = hMem;
+    p->aCmd[Cmd].Alpha = Alpha;
+    p->aCmd[Cmd].Opaque = __opaque(hMem);
+    __dirty_cmd(p, Cmd);
+  }
+  GUI_Unlock();
+  return Cmd;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_SetLayerPos
+//|  |: ƶһ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ԭµλøǵĿ´GUI_COMPOSE_Update()ʱػ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_COMPOSE_SetLayerPos(ComposeType* p, int Layer, int x0, int y0)
+{
+  ComposeLayerType* l = &p->aLayer[Layer];
+
+  if (l->x0 == x0 && l->y0 == y0)
+    return;
+  GUI_Lock();
+  __dirty_layer(p, Layer);
+  l->x0 = x0;
+  l->y0 = y0;
+  __dirty_layer(p, Layer);
+  p->NeedBin = 1;
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_SetLayerAlpha
+//|  |: Ĳ͸
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_COMPOSE_SetLayerAlpha(ComposeType* p, int Layer, U8 Alpha)
+{
+  if (p->aLayer[Layer].Alpha == Alpha)
+    return;
+  GUI_Lock();
+  p->aLayer[Layer].Alpha = Alpha;
+  __dirty_layer(p, Layer);
+  p->NeedBin = 1;
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_SetCmdPos
+//|  |: ƶһС
+//|          |:
+//| б |: x,y: µϽ()
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_COMPOSE_SetCmdPos(ComposeType* p, int Cmd, int x, int y)
+{
+  GUI_RECT* r = &p->aCmd[Cmd].Rect;
+
+  if (r->x0 == x && r->y0 == y)
+    return;
+  GUI_Lock();
+  __dirty_cmd(p, Cmd);
+  r->x1 += x - r->x0;
+  r->y1 += y - r->y0;
+  r->x0 = x;
+  r->y0 = y;
+  __dirty_cmd(p, Cmd);
+  p->NeedBin = 1;
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_SetCmdAlpha
+//|  |: һĲ͸
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_COMPOSE_SetCmdAlpha(ComposeType* p, int Cmd, U8 Alpha)
+{
+  if (p->aCmd[Cmd].Alpha == Alpha)
+    return;
+  GUI_Lock();
+  p->aCmd[Cmd].Alpha = Alpha;
+  __dirty_cmd(p, Cmd);
+  p->NeedBin = 1;
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_InvalidateCmd
+//|  |: Ĵ洢豸ݸ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ¿һû͸أ˵Ļ´θʱ·ֿ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_COMPOSE_InvalidateCmd(ComposeType* p, int Cmd)
+{
+  ComposeCmdType* c = &p->aCmd[Cmd];
+  int Opaque;
+
+  GUI_Lock();
+  if (c->Type == COMPOSE_CMD_MEMDEV) {
+    Opaque = __opaque(c->hMem);
+    if (c->Opaque != Opaque) {
+      c->Opaque = Opaque;
+      p->NeedBin = 1;
+    }
+  }
+  __dirty_cmd(p, Cmd);
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_Update
+//|  |: ѱ˵Ŀºϳɲд
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: 鲢ɾΣÿػһΣ
+//|          |: ֻдԴ(ڵĴ洢豸)
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_COMPOSE_Update(ComposeType* p)
+{
+  GUI_RECT r;
+  int tx0, tx1, ty, ty1, k, Any = 0;
+  U32 Run;
+
+  GUI_Lock();
+  for (ty = 0; ty < p->NumY; ty++) {
+    while (p->aDirty[ty] != 0) {
+      // еһ飬漸ͬλҲȫһ𲢽
+      for (tx0 = 0; ((p->aDirty[ty] >> tx0) & 1) == 0; tx0++);
+      for (tx1 = tx0; tx1 + 1 < p->NumX && ((p->aDirty[ty] >> (tx1 + 1)) & 1) != 0; tx1++);
+      Run = (0xFFFFFFFFUL >> (31 - tx1)) & ~((1UL << tx0) - 1);
+      for (ty1 = ty; ty1 + 1 < p->NumY && (p->aDirty[ty1 + 1] & Run) == Run; ty1++);
+      for (k = ty; k <= ty1; k++)
+        p->aDirty[k] &= ~Run;
+      r.x0 = tx0 * COMPOSE_TILE;
+      r.y0 = ty * COMPOSE_TILE;
+      r.x1 = GUI_MIN((tx1 + 1) * COMPOSE_TILE, p->xSize) - 1;
+      r.y1 = GUI_MIN((ty1 + 1) * COMPOSE_TILE, p->ySize) - 1;
+      if (!Any) {
+        LCDCONF_Invalidate();   // ֱӻԴ棬ˢµ
+        Any = 1;
+      }
+      WM_InvalidateRect(p->hWin, &r);
+      WM_Update(p->hWin);
+      p->Stat.TilesWritten += (tx1 - tx0 + 1) * (ty1 - ty + 1);
+    }
+  }
+  if (Any) {
+    p->Stat.Updates++;
+    p->Stat.TilesTotal += p->NumX * p->NumY;
+  }
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_Paint
+//|  |: ڵWM_PAINTãϳɲüΧڵĿ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ԭ(Ĵƿ)ػҲﲹ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_COMPOSE_Paint(ComposeType* p)
+{
+  GUI_CONTEXT Context;
+  GUI_RECT r;
+  int tx, tx0, tx1, ty, xOff = 0, yOff = 0;
+  U32 t0;
+
+  GUI_Lock();
+  t0 = target_hrt_read();
+  if (p->NeedBin)
+    __bin(p);
+  GUI_SaveContext(&Context);
+#if GUI_WINSUPPORT
+  xOff = Context.xOff;
+  yOff = Context.yOff;
+#endif
+  r.x0 = GUI_MAX(Context.ClipRect.x0 - xOff, 0);
+  r.y0 = GUI_MAX(Context.ClipRect.y0 - yOff, 0);
+  r.x1 = GUI_MIN(Context.ClipRect.x1 - xOff, p->xSize - 1);
+  r.y1 = GUI_MIN(Context.ClipRect.y1 - yOff, p->ySize - 1);
+  if (r.x0 <= r.x1 && r.y0 <= r.y1) {
+    tx0 = r.x0 / COMPOSE_TILE;
+    tx1 = r.x1 / COMPOSE_TILE;
+    for (ty = r.y0 / COMPOSE_TILE; ty <= r.y1 / COMPOSE_TILE; ty++) {
+      for (tx = tx0; tx <= tx1; tx++)
+        __resolve(p, tx, ty, _aStrip + tx * COMPOSE_TILE);
+      __draw(_aStrip + tx0 * COMPOSE_TILE, GUI_MIN((tx1 + 1) * COMPOSE_TILE, p->xSize) - tx0 * COMPOSE_TILE,
+             GUI_MIN(COMPOSE_TILE, p->ySize - ty * COMPOSE_TILE), tx0 * COMPOSE_TILE, ty * COMPOSE_TILE);
+    }
+  }
+  p->Stat.Paints++;
+  p->Stat.TimePaint += TARGET_HRT_US(target_hrt_read() - t0);
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_GetStat
+//|  |: ȡдĿϳɺ޳ػʱ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_COMPOSE_GetStat(ComposeType const* p, ComposeStatType* pStat)
+{
+  *pStat = p->Stat;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_Print
+//|  |: ӡͳ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_COMPOSE_Print(ComposeType const* p)
+{
+  ComposeStatType Stat;
+
+  GUI_COMPOSE_GetStat(p, &Stat);
+  printf("Compose: %u updates, %u of %u tiles written, %u cmd-tiles resolved, %u culled, %u paints %u us\n",
+         (unsigned)Stat.Updates, (unsigned)Stat.TilesWritten, (unsigned)Stat.TilesTotal,
+         (unsigned)Stat.CmdsResolved, (unsigned)Stat.CmdsCulled,
+         (unsigned)Stat.Paints, (unsigned)Stat.TimePaint);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COMPOSE_Delete
+//|  |: ɾϳ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ֮ڵWM_PAINTٵGUI_COMPOSE_Paint()
+//|          |: õĴ洢豸ɵɾ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_COMPOSE_Delete(ComposeType* p)
+{
+  GUI_Lock();
+  p->NumCmds = 0;
+  p->NumLayers = 0;
+  memset(p->aDirty, 0, sizeof(p->aDirty));
+  WM_InvalidateWindow(p->hWin);
+  GUI_Unlock();
+}
@@ -0,0 +1,106 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __GUI_COMPOSE_H__
+#define __GUI_COMPOSE_H__
+////////////////////////////////////////////////////////////////////////////////
+// ֿӳٺϳɣ͸Ĵڲһ״洢豸ȥÿֻ
+// ͼ(䡢䡢32λ洢豸)32x32Ŀ䡣ÿǰ
+// ϳһΣ͸סڷʱ޳ֻ
+// ˵Ŀºϳɲд(һ)
+// һ128ֽڣĻϵxΪ32ıʱöcache line
+////////////////////////////////////////////////////////////////////////////////
+#include "GUI.h"
+#include "WM.h"
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+// 
+#ifndef COMPOSE_TILE
+#define COMPOSE_TILE          (32)    // ı߳()
+#endif
+#ifndef COMPOSE_MAX_XTILES
+#define COMPOSE_MAX_XTILES    (32)    // COMPOSE_MAX_XTILES
+#endif
+#ifndef COMPOSE_MAX_YTILES
+#define COMPOSE_MAX_YTILES    (20)
+#endif
+#ifndef COMPOSE_MAX_LAYERS
+#define COMPOSE_MAX_LAYERS    (8)
+#endif
+#ifndef COMPOSE_MAX_CMDS
+#define COMPOSE_MAX_CMDS      (64)    // вÿһU64סڿ
+#endif
+#ifndef COMPOSE_STAT_EN
+#define COMPOSE_STAT_EN       (0)     // 1=GUIDEMOϳʾʱӡдĿͺʱ
+#endif
+
+typedef struct {
+  U8 Type;                    // GUI_Compose.c
+  U8 Alpha;                   // ͸ȣ255Ϊ͸
+  U8 Opaque;                  // ݱ͸(洢豸û͸)
+  U8 Layer;
+  GUI_RECT Rect;              // 
+  U32 Color0;                 // 0x00RRGGBB
+  U32 Color1;
+  GUI_MEMDEV_Handle hMem;
+} ComposeCmdType;
+
+typedef struct {
+  int x0;                     // λ
+  int y0;
+  U8 Alpha;
+  U8 FirstCmd;
+  U8 NumCmds;
+} ComposeLayerType;
+
+typedef struct {
+  U32 Updates;
+  U32 TilesWritten;           // дڵĿ
+  U32 TilesTotal;             // ÿζػҪдĿ
+  U32 CmdsResolved;           // ϳʱִе"x"
+  U32 CmdsCulled;             // ʱ͸ס޳"x"
+  U32 Paints;                 // ڵػ
+  U32 TimePaint;              // ػ(ϳɼд)ۼƵ΢
+} ComposeStatType;
+
+typedef struct {
+  WM_HWIN hWin;               // ڣWM_PAINTGUI_COMPOSE_Paint()
+  int xSize;
+  int ySize;
+  int NumX;                   // 
+  int NumY;
+  ComposeLayerType aLayer[COMPOSE_MAX_LAYERS];
+  ComposeCmdType aCmd[COMPOSE_MAX_CMDS];
+  int NumLayers;
+  int NumCmds;
+  U8 NeedBin;
+  U32 aDirty[COMPOSE_MAX_YTILES];               // ÿһλͼ1ΪҪºϳ
+  U64 aBin[COMPOSE_MAX_YTILES][COMPOSE_MAX_XTILES];  // ÿҪִе±ǰ
+  ComposeStatType Stat;
+} ComposeType;
+
+int  GUI_COMPOSE_Create(ComposeType* p, WM_HWIN hWin);
+int  GUI_COMPOSE_AddLayer(ComposeType* p, int x0, int y0, U8 Alpha);
+int  GUI_COMPOSE_FillRect(ComposeType* p, int x0, int y0, int x1, int y1, GUI_COLOR Color, U8 Alpha);
+int  GUI_COMPOSE_GradientV(ComposeType* p, int x0, int y0, int x1, int y1, GUI_COLOR Color0, GUI_COLOR Color1);
+int  GUI_COMPOSE_GradientH(ComposeType* p, int x0, int y0, int x1, int y1, GUI_COLOR Color0, GUI_COLOR Color1);
+int  GUI_COMPOSE_Memdev(ComposeType* p, GUI_MEMDEV_Handle hMem, int x, int y, U8 Alpha);
+void GUI_COMPOSE_SetLayerPos(ComposeType* p, int Layer, int x0, int y0);
+void GUI_COMPOSE_SetLayerAlpha(ComposeType* p, int Layer, U8 Alpha);
+void GUI_COMPOSE_SetCmdPos(ComposeType* p, int Cmd, int x, int y);
+void GUI_COMPOSE_SetCmdAlpha(ComposeType* p, int Cmd, U8 Alpha);
+void GUI_COMPOSE_InvalidateCmd(ComposeType* p, int Cmd);
+void GUI_COMPOSE_Update(ComposeType* p);
+void GUI_COMPOSE_Paint(ComposeType* p);
+void GUI_COMPOSE_GetStat(ComposeType const* p, ComposeStatType* pStat);
+void GUI_COMPOSE_Print(ComposeType const* p);
+void GUI_COMPOSE_Delete(ComposeType* p);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __GUI_COMPOSE_H__ */
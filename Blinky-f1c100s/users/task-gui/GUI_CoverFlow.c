@@ -0,0 +1,183 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "usrinc.h"
+#include "GUI_CoverFlow.h"
+#include <string.h>
+#include <stdio.h>
+
+/*
+* ߶СεСһСһ
+* @return: 
+*/
+static int __level(CoverFlowTexType const* p, int h0, int h1, int dx)
+{
+  int L = 0, h = GUI_MAX(h0, h1);
+
+  while (L + 1 < p->NumLevels && p->aTex[L + 1].w >= dx && p->aTex[L + 1].h >= h)
+    L++;
+  return L;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COVERFLOW_CreateTex
+//|  |: ýõͼƬmip
+//|          |:
+//| б |: hMem: 32λ洢豸ߣɾ֮ǰɾ
+//|          |: NumLevels: (ԭͼ)COVERFLOW_MAX_LEVELS
+//|          |:
+//|      |: 0ɹ32λ洢豸-1
+//|          |:
+//| עϢ |: ͼƬ̫Сڴ治ʱ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int GUI_COVERFLOW_CreateTex(CoverFlowTexType* p, GUI_MEMDEV_Handle hMem, int NumLevels)
+{
+  FlowMapTexType* t;
+  int L;
+
+  memset(p, 0, sizeof(*p));
+  if (hMem == 0 || GUI_MEMDEV_GetBitsPerPixel(hMem) != 32)
+    return -1;
+  GUI_Lock();
+  p->ahMem[0] = hMem;
+  p->aTex[0].pData = (uint32_t const*)GUI_MEMDEV_GetDataPtr(hMem);
+  p->aTex[0].w = GUI_MEMDEV_GetXSize(hMem);
+  p->aTex[0].h = GUI_MEMDEV_GetYSize(hMem);
+  p->aTex[0].stride = p->aTex[0].w;
+  p->NumLevels = 1;
+  if (NumLevels > COVERFLOW_MAX_LEVELS)
+    NumLevels = COVERFLOW_MAX_LEVELS;
+  for (L = 1; L < NumLevels; L++) {
+    t = &p->aTex[L];
+    t->w = p->aTex[L - 1].w / 2;
+    t->h = p->aTex[L - 1].h / 2;
+    if (t->w <= 0 || t->h <= 0)
+      break;
+    p->ahMem[L] = GUI_MEMDEV_CreateFixed(0, 0, t->w, t->h, GUI_MEMDEV_NOTRANS, GUI_MEMDEV_APILIST_32, GUI_COLOR_CONV_8888);
+    if (p->ahMem[L] == 0)
+      break;
+    t->pData = (uint32_t const*)GUI_MEMDEV_GetDataPtr(p->ahMem[L]);
+    t->stride = t->w;
+    FLOWMAP_Downsample(&p->aTex[L - 1], (uint32_t*)t->pData);
+    p->NumLevels++;
+  }
+  GUI_Unlock();
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COVERFLOW_DeleteTex
+//|  |: ɾmipԭͼ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_COVERFLOW_DeleteTex(CoverFlowTexType* p)
+{
+  int L;
+
+  for (L = 1; L < p->NumLevels; L++)
+    GUI_MEMDEV_Delete(p->ahMem[L]);
+  memset(p, 0, sizeof(*p));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COVERFLOW_Draw
+//|  |: ͸ӵػһŷĵӰ
+//|          |:
+//| б |: x,y,h0,h1,dx,dy: ͬGUI_MEMDEV_DrawPerspectiveX()
+//|          |: Fade: ȣ255䣬ķ԰һЩ
+//|          |: Refl: Ӱĸ߶ռ߶ȵx/2560Ӱ
+//|          |: ReflAlpha: ӰһеĲ͸ȣ½0
+//|          |:
+//|      |: дGUI_MEMDEV_DrawPerspectiveX()ʱ-1
+//|          |:
+//| עϢ |: ֻѡ32λ洢豸ʱԼ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int GUI_COVERFLOW_Draw(CoverFlowTexType const* p, int x, int y, int h0, int h1, int dx, int dy, U8 Fade, U8 Refl, U8 ReflAlpha)
+{
+  GUI_CONTEXT Context;
+  GUI_MEMDEV_Handle hMem;
+  FlowMapDstType Dst;
+  FlowMapPoseType Pose;
+  int xOff = 0, yOff = 0, xPos, yPos, r = -1;
+
+  GUI_Lock();
+  GUI_SaveContext(&Context);
+  hMem = Context.hDevData;
+  if (hMem != 0 && p->NumLevels > 0 && GUI_MEMDEV_GetBitsPerPixel(hMem) == 32) {
+#if GUI_WINSUPPORT
+    xOff = Context.xOff;
+    yOff = Context.yOff;
+#endif
+    xPos = GUI_MEMDEV_GetXPos(hMem);
+    yPos = GUI_MEMDEV_GetYPos(hMem);
+    Dst.pData = (uint32_t*)GUI_MEMDEV_GetDataPtr(hMem);
+    Dst.stride = GUI_MEMDEV_GetXSize(hMem);
+    Dst.x0 = GUI_MAX(Context.ClipRect.x0 - xPos, 0);
+    Dst.y0 = GUI_MAX(Context.ClipRect.y0 - yPos, 0);
+    Dst.x1 = GUI_MIN(Context.ClipRect.x1 - xPos, Dst.stride - 1);
+    Dst.y1 = GUI_MIN(Context.ClipRect.y1 - yPos, GUI_MEMDEV_GetYSize(hMem) - 1);
+    Pose.x = x + xOff - xPos;
+    Pose.y = y + yOff - yPos;
+    Pose.h0 = h0;
+    Pose.h1 = h1;
+    Pose.dx = dx;
+    Pose.dy = dy;
+    if (Dst.x0 > Dst.x1 || Dst.y0 > Dst.y1)
+      r = 0;
+    else
+      r = FLOWMAP_Draw(&Dst, &p->aTex[__level(p, h0, h1, dx)], &Pose, Fade, Refl, ReflAlpha);
+  }
+  if (r < 0 && p->NumLevels > 0)
+    GUI_MEMDEV_DrawPerspectiveX(p->ahMem[0], x, y, h0, h1, dx, dy);
+  GUI_Unlock();
+  return r;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_COVERFLOW_Bench
+//|  |: ѡе32λ洢豸ȽGUI_MEMDEV_DrawPerspectiveX()
+//|          |: ͼĺʱӡ
+//|          |:
+//| б |: ͬGUI_COVERFLOW_Draw()
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: Ѵ洢豸֮Ҫػ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_COVERFLOW_Bench(CoverFlowTexType const* p, int x, int y, int h0, int h1, int dx, int dy)
+{
+  U32 t0, tEmWin, tFlow, tRefl;
+  int i, Pixels = 0;
+
+  if (p->NumLevels == 0)
+    return;
+  GUI_Lock();
+  t0 = target_hrt_read();
+  for (i = 0; i < COVERFLOW_BENCH_LOOPS; i++)
+    GUI_MEMDEV_DrawPerspectiveX(p->ahMem[0], x, y, h0, h1, dx, dy);
+  tEmWin = TARGET_HRT_US(target_hrt_read() - t0);
+  t0 = target_hrt_read();
+  for (i = 0; i < COVERFLOW_BENCH_LOOPS; i++)
+    Pixels = GUI_COVERFLOW_Draw(p, x, y, h0, h1, dx, dy, 255, 0, 0);
+  tFlow = TARGET_HRT_US(target_hrt_read() - t0);
+  t0 = target_hrt_read();
+  for (i = 0; i < COVERFLOW_BENCH_LOOPS; i++)
+    GUI_COVERFLOW_Draw(p, x, y, h0, h1, dx, dy, 200, 85, 96);
+  tRefl = TARGET_HRT_US(target_hrt_read() - t0);
+  GUI_Unlock();
+  printf("CoverFlow %dx%d -> h0 %d h1 %d dx %d: %d pixels, emWin %u us, columns %u us, +reflection %u us\n",
+         (int)p->aTex[0].w, (int)p->aTex[0].h, h0, h1, dx, Pixels, (unsigned)(tEmWin / COVERFLOW_BENCH_LOOPS),
+         (unsigned)(tFlow / COVERFLOW_BENCH_LOOPS), (unsigned)(tRefl / COVERFLOW_BENCH_LOOPS));
+}
@@ -0,0 +1,45 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __GUI_COVER_FLOW_H__
+#define __GUI_COVER_FLOW_H__
+////////////////////////////////////////////////////////////////////////////////
+// õͼƬ(32λ洢豸)Ԥmipʱ
+// GUI_MEMDEV_DrawPerspectiveX()һѡ32λ洢豸ʱGUI_FlowMap
+// ֱд洢豸εĴСmipӰͽͬһﻭ
+// 򽻸GUI_MEMDEV_DrawPerspectiveX()(ûеӰ)
+////////////////////////////////////////////////////////////////////////////////
+#include "GUI.h"
+#include "GUI_FlowMap.h"
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+// 
+#ifndef COVERFLOW_MAX_LEVELS
+#define COVERFLOW_MAX_LEVELS  (3)     // ༸(ԭͼ)ÿ߼
+#endif
+#ifndef COVERFLOW_BENCH_LOOPS
+#define COVERFLOW_BENCH_LOOPS (20)    // GUI_COVERFLOW_Bench()ÿֻظĴ
+#endif
+#ifndef COVERFLOW_STAT_EN
+#define COVERFLOW_STAT_EN     (0)     // 1=GUIDEMO_ImageFlowʱGUI_MEMDEV_DrawPerspectiveX()ȽϺʱ
+#endif
+
+typedef struct {
+  GUI_MEMDEV_Handle ahMem[COVERFLOW_MAX_LEVELS];  // [0]ǵߵԭͼmip
+  FlowMapTexType aTex[COVERFLOW_MAX_LEVELS];
+  int NumLevels;
+} CoverFlowTexType;
+
+int  GUI_COVERFLOW_CreateTex(CoverFlowTexType* p, GUI_MEMDEV_Handle hMem, int NumLevels);
+void GUI_COVERFLOW_DeleteTex(CoverFlowTexType* p);
+int  GUI_COVERFLOW_Draw(CoverFlowTexType const* p, int x, int y, int h0, int h1, int dx, int dy, U8 Fade, U8 Refl, U8 ReflAlpha);
+void GUI_COVERFLOW_Bench(CoverFlowTexType const* p, int x, int y, int h0, int h1, int dx, int dy);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __GUI_COVER_FLOW_H__ */
@@ -0,0 +1,154 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "GUI_FlowMap.h"
+
+// ÿf/256f<255ʱѹһ
+static uint32_t __scale(uint32_t s, uint32_t f)
+{
+  return ((((s & 0xFF00FF) * f) >> 8) & 0xFF00FF) | ((((s & 0xFF00) * f) >> 8) & 0xFF00);
+}
+
+// ͸Ϊa(0~255)sϵdϣ֮Ϊʱλڼӻd֮
+static uint32_t __blend(uint32_t d, uint32_t s, uint32_t a)
+{
+  uint32_t rb = d & 0xFF00FF, g = d & 0xFF00;
+
+  rb = (rb + ((((s & 0xFF00FF) - rb) * a) >> 8)) & 0xFF00FF;
+  g = (g + ((((s & 0xFF00) - g) * a) >> 8)) & 0xFF00;
+  return rb | g;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: FLOWMAP_Draw
+//|  |: ͸ӵػһΣͬʱĵӰ
+//|          |:
+//| б |: d: Ŀ껺ͲüΣǻ±
+//|          |: t: pose: ΣͬGUI_MEMDEV_DrawPerspectiveX()Ĳ
+//|          |: fade: (255)refl: Ӱ߶ռиߵx/256
+//|          |: ralpha: ӰһеĲ͸ȣԽ0
+//|          |:
+//|      |: дԷ-1
+//|          |:
+//| עϢ |: ȡӰdԭеػ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int FLOWMAP_Draw(FlowMapDstType const* d, FlowMapTexType const* t, FlowMapPoseType const* pose,
+                 uint32_t fade, uint32_t refl, uint32_t ralpha)
+{
+  int64_t top, topStep, hgt, hStep, v, vStep;
+  int32_t n2, den, denStep, i, xx, u, ys, ye, r0, r1, row, vi, rh, k, a, aStep;
+  uint32_t nu, nuStep, rcp, vScale, aScale = 0;
+  uint32_t const* src;
+  uint32_t *dst, s;
+  int pixels = 0;
+
+  if (pose->dx <= 0 || pose->dx > 16384 || pose->h0 <= 0 || pose->h1 <= 0 || t->w <= 0 || t->h <= 0)
+    return -1;
+  if (refl > 256)
+    refl = 256;
+  // iеt=(2i+1)/(2dx)u = w*h1*t/((1-t)*h0+t*h1)ӷĸͬ2dxiԱ仯
+  n2 = 2 * pose->dx;
+  if ((uint64_t)t->w * pose->h1 * n2 > 0xFFFFFFFFUL || (uint64_t)t->h * n2 > 0xFFFFFFFFUL)
+    return -1;
+  nu = (uint32_t)t->w * pose->h1;
+  nuStep = 2 * nu;
+  den = pose->h0 * (n2 - 1) + pose->h1;
+  denStep = 2 * (pose->h1 - pose->h0);
+  // иdenвvStep = h*2dx/den(16.16)ӰĲ͸ȲҲ
+  // 1/denÿֻһ32λrcp=2^32/den඼ǳ˷
+  vScale = (uint32_t)t->h * n2;
+  if (ralpha != 0 && refl != 0)
+    aScale = (uint32_t)(((uint64_t)ralpha * n2 << 8) / refl);
+  // жи(16.16)ͬȡ
+  top = ((int64_t)pose->y << 16) + ((int64_t)pose->dy << 16) / n2;
+  topStep = ((int64_t)pose->dy << 16) / pose->dx;
+  hgt = ((int64_t)den << 16) / n2;
+  hStep = ((int64_t)(pose->h1 - pose->h0) << 16) / pose->dx;
+  for (i = 0; i < pose->dx; i++, nu += nuStep, den += denStep, top += topStep, hgt += hStep) {
+    xx = pose->x + i;
+    if (xx < d->x0 || xx > d->x1)
+      continue;
+    ys = (int32_t)((top + 0x8000) >> 16);
+    ye = (int32_t)((top + hgt + 0x8000) >> 16);
+    if (ye <= ys)
+      continue;
+    // ȡĵuΪض䵽ǰһأvͲ͸ȡԽױߺ0
+    rcp = 0xFFFFFFFFUL / (uint32_t)den;
+    u = (int32_t)(((uint64_t)nu * (rcp + 1)) >> 32);
+    if (u >= t->w)
+      u = t->w - 1;
+    src = t->pData + u;
+    vStep = (int64_t)(((uint64_t)vScale * rcp) >> 16);
+    v = ((((int64_t)ys << 16) + 0x8000 - top) * vStep) >> 16;
+    r0 = (ys > d->y0) ? ys : d->y0;
+    r1 = (ye - 1 < d->y1) ? ye - 1 : d->y1;
+    if (r0 <= r1) {
+      v += (int64_t)(r0 - ys) * vStep;
+      dst = d->pData + r0 * d->stride + xx;
+      pixels += r1 - r0 + 1;
+      if (fade >= 255) {
+        for (row = r0; row <= r1; row++, v += vStep, dst += d->stride) {
+          vi = (int32_t)(v >> 16);
+          *dst = src[((vi < t->h) ? vi : t->h - 1) * t->stride] & 0xFFFFFF;
+        }
+      } else {
+        for (row = r0; row <= r1; row++, v += vStep, dst += d->stride) {
+          vi = (int32_t)(v >> 16);
+          *dst = __scale(src[((vi < t->h) ? vi : t->h - 1) * t->stride], fade);
+        }
+      }
+    }
+    // Ӱkǵh-1-kеľ񣬲ԭͼһ
+    rh = (int32_t)((hgt * refl) >> 24);
+    if (ralpha == 0 || rh <= 0 || ye > d->y1)
+      continue;
+    v = ((int64_t)t->h << 16) - (vStep >> 1);
+    a = (int32_t)(ralpha << 16);
+    aStep = (int32_t)(((uint64_t)aScale * rcp) >> 16);
+    for (k = 0, row = ye; k < rh && row <= d->y1; k++, row++, v -= vStep, a -= aStep) {
+      if (row < d->y0)
+        continue;
+      vi = (int32_t)(v >> 16);
+      s = src[((vi > 0) ? vi : 0) * t->stride];
+      if (fade < 255)
+        s = __scale(s, fade);
+      dst = d->pData + row * d->stride + xx;
+      *dst = __blend(*dst, s, (uint32_t)a >> 16);
+      pixels++;
+    }
+  }
+  return pixels;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: FLOWMAP_Downsample
+//|  |: 2x2ƽһmip
+//|          |:
+//| б |: dst: (w/2)*(h/2)أоw/2
+//|          |:
+//|      |: 0ɹ̫С-1
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int FLOWMAP_Downsample(FlowMapTexType const* src, uint32_t* dst)
+{
+  uint32_t const *p0, *p1;
+  uint32_t rb, g;
+  int32_t x, y, w2 = src->w / 2, h2 = src->h / 2;
+
+  if (w2 <= 0 || h2 <= 0)
+    return -1;
+  for (y = 0; y < h2; y++) {
+    p0 = src->pData + 2 * y * src->stride;
+    p1 = p0 + src->stride;
+    for (x = 0; x < w2; x++, p0 += 2, p1 += 2) {
+      rb = (p0[0] & 0xFF00FF) + (p0[1] & 0xFF00FF) + (p1[0] & 0xFF00FF) + (p1[1] & 0xFF00FF);
+      g = (p0[0] & 0xFF00) + (p0[1] & 0xFF00) + (p1[0] & 0xFF00) + (p1[1] & 0xFF00);
+      *dst++ = (((rb + 0x20002) >> 2) & 0xFF00FF) | (((g + 0x200) >> 2) & 0xFF00);
+    }
+  }
+  return 0;
+}
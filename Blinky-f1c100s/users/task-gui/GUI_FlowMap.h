@@ -0,0 +1,51 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __GUI_FLOW_MAP_H__
+#define __GUI_FLOW_MAP_H__
+////////////////////////////////////////////////////////////////////////////////
+// ͸ͼͼƬתһǶȺĻһΣ
+// ֱм㣺иߺжĺ갴͸(u*qq
+// Ա仯)ÿֻһγڰ㲽ȡӰͽͬһ
+// ﻭе档ֻ<stdint.h>ֱӱ뱾ļ
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+typedef struct {
+  uint32_t const* pData;      // 0x..RRGGBB8λ
+  int32_t w;
+  int32_t h;
+  int32_t stride;             // ÿе
+} FlowMapTexType;
+
+typedef struct {
+  uint32_t* pData;            // д0x00RRGGBBemWin 32λ洢豸Ĳ͸
+  int32_t stride;
+  int32_t x0;                 // ü()
+  int32_t y0;
+  int32_t x1;
+  int32_t y1;
+} FlowMapDstType;
+
+typedef struct {
+  int32_t x;                  // ߵ(x,y)h0
+  int32_t y;
+  int32_t h0;
+  int32_t h1;                 // ұߵ(x+dx-1,y+dy)h1
+  int32_t dx;
+  int32_t dy;
+} FlowMapPoseType;
+
+int FLOWMAP_Draw(FlowMapDstType const* d, FlowMapTexType const* t, FlowMapPoseType const* pose,
+                 uint32_t fade, uint32_t refl, uint32_t ralpha);
+int FLOWMAP_Downsample(FlowMapTexType const* src, uint32_t* dst);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __GUI_FLOW_MAP_H__ */
@@ -0,0 +1,380 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "usrinc.h"
+#include "GUI_ImageCache.h"
+#include "GUI_Asset.h"
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// 
+#ifndef IMGCACHE_NUM
+#define IMGCACHE_NUM          (32)          // ໺ͼƬ
+#endif
+#ifndef IMGCACHE_BUDGET
+#define IMGCACHE_BUDGET       (1024*1024UL) // ȱʡֽԤ㣬洢豸emWinڴ(GUI_NUMBYTES)
+#endif
+#ifndef IMGCACHE_PREWARM_NUM
+#define IMGCACHE_PREWARM_NUM  (64)          // Ԥȶгȣ2
+#endif
+
+#define IMGCACHE_EVT_PREWARM  (0x0001)
+
+typedef struct {
+  void const* pData;
+  U32 NumBytes;
+  S16 Index;
+  U8 Src;
+  U8 Format;
+} ImageCacheKeyType;
+
+typedef struct {
+  ImageCacheKeyType Key;
+  GUI_MEMDEV_Handle hMem;     // 0Ϊ
+  U32 NumBytes;
+  U32 Stamp;                  // һʹõʱ̣ԽСԽû
+} ImageCacheEntryType;
+
+////////////////////////////////////////////////////////////////////////////////
+static U64 __StackPrewarm[8192 / 8] MEM_PI_STACK;
+static __task void __ThreadPrewarm(void);
+static OS_TID _prewarm_tid = 0;
+
+// ݶֻGUI_Lock()֮ڷ
+static ImageCacheEntryType _cache[IMGCACHE_NUM];
+static ImageCacheStatType _stat = {0, 0, 0, 0, 0, 0, IMGCACHE_BUDGET, 0};
+static U32 _stamp = 0;
+static ImageCacheKeyType _req[IMGCACHE_PREWARM_NUM];
+static U16 _req_head = 0;
+static U16 _req_tail = 0;
+
+static int __find(ImageCacheKeyType const* k)
+{
+  int i;
+
+  for (i = 0; i < IMGCACHE_NUM; i++) {
+    if (_cache[i].hMem != 0 && _cache[i].Key.pData == k->pData && _cache[i].Key.Index == k->Index &&
+        _cache[i].Key.Src == k->Src && _cache[i].Key.Format == k->Format)
+      return i;
+  }
+  return -1;
+}
+
+static void __remove(int i)
+{
+  GUI_MEMDEV_Delete(_cache[i].hMem);
+  _stat.NumBytes -= _cache[i].NumBytes;
+  _stat.NumEntries--;
+  _cache[i].hMem = 0;
+}
+
+/*
+* ̭ûõһ
+* @return: ̭±꣬Ϊշ-1
+*/
+static int __evict(void)
+{
+  int i, lru = -1;
+
+  for (i = 0; i < IMGCACHE_NUM; i++) {
+    if (_cache[i].hMem != 0 && (lru < 0 || (S32)(_cache[i].Stamp - _cache[lru].Stamp) < 0))
+      lru = i;
+  }
+  if (lru >= 0) {
+    __remove(lru);
+    _stat.Evictions++;
+  }
+  return lru;
+}
+
+static int __get_size(ImageCacheKeyType const* k, int* xSize, int* ySize)
+{
+  GUI_JPEG_INFO jpeg;
+  GUI_GIF_INFO gif;
+
+  switch (k->Src) {
+  case IMGCACHE_SRC_ASSET:
+    return GUI_ASSET_GetSize((AssetArchiveType const*)k->pData, k->Index, xSize, ySize);
+  case IMGCACHE_SRC_JPEG:
+    if (GUI_JPEG_GetInfo(k->pData, (int)k->NumBytes, &jpeg) != 0)
+      return -1;
+    *xSize = jpeg.XSize;
+    *ySize = jpeg.YSize;
+    return 0;
+  case IMGCACHE_SRC_GIF:
+    if (GUI_GIF_GetInfo(k->pData, k->NumBytes, &gif) != 0 || k->Index >= gif.NumImages)
+      return -1;
+    *xSize = gif.xSize;
+    *ySize = gif.ySize;
+    return 0;
+  case IMGCACHE_SRC_BMP:
+    *xSize = GUI_BMP_GetXSize(k->pData);
+    *ySize = GUI_BMP_GetYSize(k->pData);
+    return 0;
+  default:
+    return -1;
+  }
+}
+
+/*
+* ڵǰѡе豸ֱӻ()
+* @return: 0ɹ
+*/
+static int __render(ImageCacheKeyType const* k, int x, int y)
+{
+  switch (k->Src) {
+  case IMGCACHE_SRC_ASSET:
+    return GUI_ASSET_Draw((AssetArchiveType const*)k->pData, k->Index, x, y);
+  case IMGCACHE_SRC_JPEG:
+    return GUI_JPEG_Draw(k->pData, (int)k->NumBytes, x, y);
+  case IMGCACHE_SRC_GIF:
+    return GUI_GIF_DrawSub(k->pData, k->NumBytes, x, y, k->Index);
+  case IMGCACHE_SRC_BMP:
+    return GUI_BMP_Draw(k->pData, x, y);
+  default:
+    return -1;
+  }
+}
+
+/*
+* 뵽µĴ洢豸Ž棬Ҫʱ̭
+* @return: ±꣬Ԥڴ治-1
+*/
+static int __load(ImageCacheKeyType const* k)
+{
+  GUI_MEMDEV_Handle hMem = 0, hOld;
+  GUI_COLOR BkColor;
+  U32 NumBytes;
+  int xSize, ySize, i, r;
+
+  if (__get_size(k, &xSize, &ySize) != 0 || xSize <= 0 || ySize <= 0)
+    return -1;
+  NumBytes = (U32)xSize * ySize * 4;
+  if (NumBytes > _stat.Budget)
+    return -1;
+  while (_stat.NumBytes + NumBytes > _stat.Budget || _stat.NumEntries >= IMGCACHE_NUM)
+    __evict();
+
+  // emWinڴزʱֱ̭Ϊֹ
+  for (;;) {
+    if (k->Src == IMGCACHE_SRC_ASSET)
+      hMem = GUI_ASSET_CreateMemdev((AssetArchiveType const*)k->pData, k->Index);
+    else
+      hMem = GUI_MEMDEV_CreateFixed(0, 0, xSize, ySize, GUI_MEMDEV_NOTRANS, GUI_MEMDEV_APILIST_32, GUI_COLOR_CONV_8888);
+    if (hMem != 0 || __evict() < 0)
+      break;
+  }
+  if (hMem == 0)
+    return -1;
+  if (k->Src != IMGCACHE_SRC_ASSET) {
+    hOld = GUI_MEMDEV_Select(hMem);
+    BkColor = GUI_GetBkColor();
+    GUI_SetBkColor(GUI_TRANSPARENT);
+    GUI_Clear();
+    r = __render(k, 0, 0);
+    GUI_SetBkColor(BkColor);
+    GUI_MEMDEV_Select(hOld);
+    if (r != 0) {
+      GUI_MEMDEV_Delete(hMem);
+      return -1;
+    }
+  }
+
+  for (i = 0; _cache[i].hMem != 0; i++)
+    ;
+  _cache[i].Key = *k;
+  _cache[i].hMem = hMem;
+  _cache[i].NumBytes = NumBytes;
+  _cache[i].Stamp = _stamp++;
+  _stat.NumBytes += NumBytes;
+  _stat.NumEntries++;
+  return i;
+}
+
+static void __make_key(ImageCacheKeyType* k, int Src, void const* pData, U32 NumBytes, int Index, int Format)
+{
+  k->pData = pData;
+  k->NumBytes = NumBytes;
+  k->Index = (S16)Index;
+  k->Src = (U8)Src;
+  k->Format = (U8)Format;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_IMGCACHE_Draw
+//|  |: (x, y)һͼƬ
+//|          |:
+//| б |: Src: ԴIMGCACHE_SRC_xxx
+//|          |: pData: ͼƬݣԴʱΪAssetArchiveType*
+//|          |: NumBytes: JPEG/GIFֽ
+//|          |: Index: GIFͼԴ±꣬Ϊ0
+//|          |: Format: IMGCACHE_FMT_xxx
+//|          |:
+//|      |: 0ɹ
+//|          |:
+//| עϢ |: ʱֻ洢豸ûʱ벢棬ԤͼƬֱӻ
+//|          |: ֻݵַͬһַݲܸı䡣
+////////////////////////////////////////////////////////////////////////////////
+int GUI_IMGCACHE_Draw(int Src, void const* pData, U32 NumBytes, int Index, int Format, int x, int y)
+{
+  ImageCacheKeyType k;
+  int i, r = 0;
+
+  __make_key(&k, Src, pData, NumBytes, Index, Format);
+  GUI_Lock();
+  i = __find(&k);
+  if (i >= 0) {
+    _stat.Hits++;
+  } else {
+    _stat.Misses++;
+    i = __load(&k);
+  }
+  if (i < 0) {
+    _stat.Bypass++;
+    r = __render(&k, x, y);
+  } else {
+    _cache[i].Stamp = _stamp++;
+    if (Format == IMGCACHE_FMT_OPAQUE)
+      GUI_MEMDEV_WriteOpaqueAt(_cache[i].hMem, x, y);
+    else
+      GUI_MEMDEV_WriteAt(_cache[i].hMem, x, y);
+  }
+  GUI_Unlock();
+  return r;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_IMGCACHE_Prewarm
+//|  |: ̨߳ǰһͼƬ
+//|          |:
+//| б |: ͬGUI_IMGCACHE_Draw()
+//|          |:
+//|      |: 0ɹ߳̽-1
+//|          |:
+//| עϢ |: ̨߳GUI߳ͬΪȼÿһóһCPU
+//|          |: emWin룬ڼGUI̵߳ĻͼҪȴ
+////////////////////////////////////////////////////////////////////////////////
+int GUI_IMGCACHE_Prewarm(int Src, void const* pData, U32 NumBytes, int Index, int Format)
+{
+  int r = -1;
+
+  GUI_Lock();
+  if (_prewarm_tid == 0) {
+    _prewarm_tid = TSKMON_CreateTask(
+                       "imgcache",
+                       __ThreadPrewarm,
+                       TSK_PRIO_LOLIMIT,
+                       __StackPrewarm,
+                       sizeof(__StackPrewarm));
+  }
+  if (_prewarm_tid != 0 && (U16)(_req_head - _req_tail) < IMGCACHE_PREWARM_NUM) {
+    __make_key(&_req[_req_head & (IMGCACHE_PREWARM_NUM - 1)], Src, pData, NumBytes, Index, Format);
+    _req_head++;
+    os_evt_set(IMGCACHE_EVT_PREWARM, _prewarm_tid);
+    r = 0;
+  }
+  GUI_Unlock();
+  return r;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_IMGCACHE_SetBudget
+//|  |: ûֽԤ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ԤСʱ̭Ԥڡ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_IMGCACHE_SetBudget(U32 NumBytes)
+{
+  GUI_Lock();
+  _stat.Budget = NumBytes;
+  while (_stat.NumBytes > _stat.Budget)
+    __evict();
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_IMGCACHE_Flush
+//|  |: ջԤȶ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ͼƬݱͷŻд֮ǰá
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_IMGCACHE_Flush(void)
+{
+  int i;
+
+  GUI_Lock();
+  _req_tail = _req_head;
+  for (i = 0; i < IMGCACHE_NUM; i++) {
+    if (_cache[i].hMem != 0)
+      __remove(i);
+  }
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_IMGCACHE_GetStat
+//|  |: ȡʵͳ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_IMGCACHE_GetStat(ImageCacheStatType* pStat)
+{
+  GUI_Lock();
+  *pStat = _stat;
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: __ThreadPrewarm
+//|  |: Ԥ߳
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ƽʱ¼ϣʱ룬ڻ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+static __task void __ThreadPrewarm(void)
+{
+  ImageCacheKeyType k;
+
+  for (;;) {
+    os_evt_wait_or(IMGCACHE_EVT_PREWARM, 0xFFFF);
+    for (;;) {
+      GUI_Lock();
+      if (_req_tail == _req_head) {
+        GUI_Unlock();
+        break;
+      }
+      k = _req[_req_tail & (IMGCACHE_PREWARM_NUM - 1)];
+      _req_tail++;
+      if (__find(&k) < 0 && __load(&k) >= 0)
+        _stat.Prewarms++;
+      GUI_Unlock();
+      os_tsk_pass();
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
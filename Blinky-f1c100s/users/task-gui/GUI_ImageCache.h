@@ -0,0 +1,48 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __GUI_IMAGE_CACHE_H__
+#define __GUI_IMAGE_CACHE_H__
+////////////////////////////////////////////////////////////////////////////////
+// ͼƬLRU棺JPEG/GIF/BMP/ԴͼƬһλʱһ
+// 32λ洢豸Ժֱӿ(Դ, , ±, Ŀʽ)Ϊ
+// ֽԤʱ̭ûõġ̨߳̿ǰ(Ԥ)
+////////////////////////////////////////////////////////////////////////////////
+#include "GUI.h"
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+// ͼƬԴ
+#define IMGCACHE_SRC_ASSET    (0)   // pDataΪAssetArchiveType*IndexΪԴ±
+#define IMGCACHE_SRC_JPEG     (1)   // pData/NumBytesΪJPEGļ
+#define IMGCACHE_SRC_GIF      (2)   // pData/NumBytesΪGIFļIndexΪͼ
+#define IMGCACHE_SRC_BMP      (3)   // pDataΪBMPļ
+
+// Ŀʽ
+#define IMGCACHE_FMT_ALPHA    (0)   // ͸GUI_MEMDEV_WriteAt()
+#define IMGCACHE_FMT_OPAQUE   (1)   // ͸GUI_MEMDEV_WriteOpaqueAt()ֱӿ
+
+typedef struct {
+  U32 Hits;
+  U32 Misses;
+  U32 Evictions;
+  U32 Prewarms;               // ̨ɵĴ
+  U32 Bypass;                 // Ԥڴ治ûлĴ
+  U32 NumBytes;               // ǰռ
+  U32 Budget;
+  int NumEntries;
+} ImageCacheStatType;
+
+int  GUI_IMGCACHE_Draw(int Src, void const* pData, U32 NumBytes, int Index, int Format, int x, int y);
+int  GUI_IMGCACHE_Prewarm(int Src, void const* pData, U32 NumBytes, int Index, int Format);
+void GUI_IMGCACHE_SetBudget(U32 NumBytes);
+void GUI_IMGCACHE_Flush(void);
+void GUI_IMGCACHE_GetStat(ImageCacheStatType* pStat);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __GUI_IMAGE_CACHE_H__ */
@@ -0,0 +1,459 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "usrinc.h"
+#include "GUI_Retain.h"
+#include <string.h>
+#include <stdio.h>
+
+////////////////////////////////////////////////////////////////////////////////
+enum {
+  RETAIN_OP_COLOR = 1,
+  RETAIN_OP_BKCOLOR,
+  RETAIN_OP_FONT,
+  RETAIN_OP_TEXTMODE,
+  RETAIN_OP_CLEAR,
+  RETAIN_OP_FILLRECT,
+  RETAIN_OP_GRADIENTV,
+  RETAIN_OP_GRADIENTH,
+  RETAIN_OP_BITMAP,
+  RETAIN_OP_MEMDEV,
+  RETAIN_OP_STRING
+};
+
+#define RETAIN_FNV_BASIS      (2166136261UL)
+#define RETAIN_FNV_PRIME      (16777619UL)
+
+// ݶֻGUI_Lock()֮ڷ
+static RetainType* _rec = NULL; // ¼Ƶı
+
+static U32 __fnv(U32 h, void const* pData, int NumBytes)
+{
+  U8 const* pByte = (U8 const*)pData;
+
+  while (NumBytes-- > 0)
+    h = (h ^ *pByte++) * RETAIN_FNV_PRIME;
+  return h;
+}
+
+/*
+* ɢУֻе32λ
+* @return:
+*/
+static U32 __hash(RetainType const* p)
+{
+  U32 h = RETAIN_FNV_BASIS;
+  int k;
+
+  for (k = 0; k < p->NumWords; k++)
+    h = __fnv(h, &p->aCmd[k].u, sizeof(U32));
+  return h;
+}
+
+/*
+* ¼Ƶıһͷһֵĵ8λ
+* @return: ŲʱNULLű
+*/
+static RetainWordType* __emit(U32 Op, int NumArgs)
+{
+  RetainType* p = _rec;
+  RetainWordType* a;
+
+  if (p == NULL || p->Overflow)
+    return NULL;
+  if (p->NumWords + 1 + NumArgs > RETAIN_MAX_WORDS) {
+    p->Overflow = 1;
+    return NULL;
+  }
+  a = &p->aCmd[p->NumWords];
+  a[0].u = Op | ((U32)(1 + NumArgs) << 8);
+  p->NumWords += 1 + NumArgs;
+  return a + 1;
+}
+
+static void __replay(RetainType const* p)
+{
+  RetainWordType const* a;
+  int k;
+
+  for (k = 0; k < p->NumWords; k += a[0].u >> 8) {
+    a = &p->aCmd[k];
+    switch (a[0].u & 0xFF) {
+    case RETAIN_OP_COLOR:
+      GUI_SetColor(a[1].u);
+      break;
+    case RETAIN_OP_BKCOLOR:
+      GUI_SetBkColor(a[1].u);
+      break;
+    case RETAIN_OP_FONT:
+      GUI_SetFont((const GUI_FONT*)a[1].p);
+      break;
+    case RETAIN_OP_TEXTMODE:
+      GUI_SetTextMode(a[1].i);
+      break;
+    case RETAIN_OP_CLEAR:
+      GUI_Clear();
+      break;
+    case RETAIN_OP_FILLRECT:
+      GUI_FillRect(a[1].i, a[2].i, a[3].i, a[4].i);
+      break;
+    case RETAIN_OP_GRADIENTV:
+      GUI_DrawGradientV(a[1].i, a[2].i, a[3].i, a[4].i, a[5].u, a[6].u);
+      break;
+    case RETAIN_OP_GRADIENTH:
+      GUI_DrawGradientH(a[1].i, a[2].i, a[3].i, a[4].i, a[5].u, a[6].u);
+      break;
+    case RETAIN_OP_BITMAP:
+      GUI_DrawBitmap((const GUI_BITMAP*)a[1].p, a[2].i, a[3].i);
+      break;
+    case RETAIN_OP_MEMDEV:
+      GUI_MEMDEV_Write((GUI_MEMDEV_Handle)a[1].i);
+      break;
+    case RETAIN_OP_STRING:
+      GUI_DispStringAt((const char*)&a[3], a[1].i, a[2].i);
+      break;
+    }
+  }
+}
+
+static void __free(RetainType* p)
+{
+  if (p->hMem != 0)
+    GUI_MEMDEV_Delete(p->hMem);
+  p->hMem = 0;
+}
+
+/*
+* Ⱦ洢豸ǰɫȲӰ졣洢豸Ļ꣬
+* ԷڴԭϣطŵĴ
+* @return:
+*/
+static void __bake(RetainType* p)
+{
+  GUI_MEMDEV_Handle hOld;
+  const GUI_FONT* pFont;
+  GUI_COLOR Color, BkColor;
+  int Mode;
+
+  if ((U32)p->xSize * p->ySize * 4 > RETAIN_MEMDEV_MAX)
+    return;
+  if (p->hMem == 0)
+    p->hMem = GUI_MEMDEV_CreateFixed(p->xOrg, p->yOrg, p->xSize, p->ySize, GUI_MEMDEV_NOTRANS, GUI_MEMDEV_APILIST_32, GUI_COLOR_CONV_8888);
+  if (p->hMem == 0)
+    return;
+  Color = GUI_GetColor();
+  BkColor = GUI_GetBkColor();
+  pFont = GUI_GetFont();
+  Mode = GUI_GetTextMode();
+  hOld = GUI_MEMDEV_Select(p->hMem);
+  GUI_SetBkColor(GUI_BLACK);
+  GUI_Clear();
+  __replay(p);
+  GUI_MEMDEV_Select(hOld);
+  GUI_SetColor(Color);
+  GUI_SetBkColor(BkColor);
+  GUI_SetFont(pFont);
+  GUI_SetTextMode(Mode);
+  p->MemHash = p->Hash;
+}
+
+static void __blit(RetainType const* p)
+{
+  GUI_BITMAP bm;
+
+  bm.XSize = p->xSize;
+  bm.YSize = p->ySize;
+  bm.BytesPerLine = p->xSize * 4;
+  bm.BitsPerPixel = 32;
+  bm.pData = (U8 const*)GUI_MEMDEV_GetDataPtr(p->hMem);
+  bm.pPal = NULL;
+  bm.pMethods = GUI_DRAW_BMP8888;
+  GUI_DrawBitmap(&bm, 0, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_RETAIN_Begin
+//|  |: ڴڵWM_PAINT￪ʼػ
+//|          |:
+//| б |: hWin: ػĴ
+//|          |: pState/NumBytes: Ӱ컭״̬˾¼ΪNULL/0
+//|          |:
+//|      |: 1=ҪԼĻͼ벢GUI_RETAIN_End()0=Ѿ
+//|          |:
+//| עϢ |: λáߴ״̬ûʱձطţѾȾõĴ洢豸
+//|          |: ͼֻоGUI_RETAIN_xxx()ᱻ¼¡
+////////////////////////////////////////////////////////////////////////////////
+int GUI_RETAIN_Begin(RetainType* p, WM_HWIN hWin, void const* pState, int NumBytes)
+{
+  int xSize, ySize, xOrg, yOrg;
+  U32 Key;
+
+  xSize = WM_GetWindowSizeX(hWin);
+  ySize = WM_GetWindowSizeY(hWin);
+  xOrg = WM_GetWindowOrgX(hWin);
+  yOrg = WM_GetWindowOrgY(hWin);
+  Key = __fnv(RETAIN_FNV_BASIS, &xSize, sizeof(xSize));
+  Key = __fnv(Key, &ySize, sizeof(ySize));
+  Key = __fnv(Key, &xOrg, sizeof(xOrg));
+  Key = __fnv(Key, &yOrg, sizeof(yOrg));
+  Key = __fnv(Key, pState, NumBytes);
+  p->t0 = target_hrt_read();
+  if (p->Valid && Key == p->Key) {
+    if (p->hMem != 0 && p->MemHash == p->Hash) {
+      __blit(p);
+      p->Stat.Blits++;
+      p->Stat.TimeBlit += TARGET_HRT_US(target_hrt_read() - p->t0);
+    } else {
+      __replay(p);
+      if (++p->NumReplays >= RETAIN_MEMDEV_AFTER)
+        __bake(p);
+      p->Stat.Replays++;
+      p->Stat.TimeReplay += TARGET_HRT_US(target_hrt_read() - p->t0);
+    }
+    return 0;
+  }
+  if (xSize != p->xSize || ySize != p->ySize || xOrg != p->xOrg || yOrg != p->yOrg)
+    __free(p);
+  p->xSize = xSize;
+  p->ySize = ySize;
+  p->xOrg = xOrg;
+  p->yOrg = yOrg;
+  p->Key = Key;
+  p->NumWords = 0;
+  p->Overflow = 0;
+  p->Valid = 0;
+  _rec = p;
+  return 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_RETAIN_End
+//|  |: ¼
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ±ʹ洢豸ıһʱ洢豸Žɾ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_RETAIN_End(RetainType* p)
+{
+  _rec = NULL;
+  p->Hash = __hash(p);
+  p->Valid = !p->Overflow;
+  p->NumReplays = 0;
+  if (p->hMem != 0 && (!p->Valid || p->MemHash != p->Hash))
+    __free(p);
+  p->Stat.Records++;
+  p->Stat.TimeRecord += TARGET_HRT_US(target_hrt_read() - p->t0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_RETAIN_Invalidate
+//|  |: ´ػʱ¼
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ûŽ״̬ĶʱãڻҪWM_InvalidateWindow()
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_RETAIN_Invalidate(RetainType* p)
+{
+  p->Valid = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_RETAIN_Delete
+//|  |: ɾ洢豸
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ڴڵWM_DELETEá
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_RETAIN_Delete(RetainType* p)
+{
+  GUI_Lock();
+  __free(p);
+  p->Valid = 0;
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_RETAIN_GetStat
+//|  |: ȡ¼ơطšͼĴʱ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ʡµʱ䰴ÿζܻͼ롢ÿʱƽ¼ʱơ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_RETAIN_GetStat(RetainType const* p, RetainStatType* pStat)
+{
+  *pStat = p->Stat;
+  if (pStat->Records > 0)
+    pStat->TimeSaved = (I32)(pStat->TimeRecord / pStat->Records * (pStat->Replays + pStat->Blits)) -
+                       (I32)(pStat->TimeReplay + pStat->TimeBlit);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_RETAIN_Print
+//|  |: ӡͳ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_RETAIN_Print(const char* sName, RetainType const* p)
+{
+  RetainStatType Stat;
+
+  GUI_RETAIN_GetStat(p, &Stat);
+  printf("Retain %s: %u paints %u us, %u replays %u us, %u blits %u us, saved %d us\n",
+         sName,
+         (unsigned)Stat.Records, (unsigned)Stat.TimeRecord,
+         (unsigned)Stat.Replays, (unsigned)Stat.TimeReplay,
+         (unsigned)Stat.Blits, (unsigned)Stat.TimeBlit,
+         (int)Stat.TimeSaved);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void GUI_RETAIN_SetColor(GUI_COLOR Color)
+{
+  RetainWordType* a = __emit(RETAIN_OP_COLOR, 1);
+
+  if (a != NULL)
+    a[0].u = Color;
+  GUI_SetColor(Color);
+}
+
+void GUI_RETAIN_SetBkColor(GUI_COLOR Color)
+{
+  RetainWordType* a = __emit(RETAIN_OP_BKCOLOR, 1);
+
+  if (a != NULL)
+    a[0].u = Color;
+  GUI_SetBkColor(Color);
+}
+
+void GUI_RETAIN_SetFont(const GUI_FONT* pFont)
+{
+  RetainWordType* a = __emit(RETAIN_OP_FONT, 1);
+
+  if (a != NULL)
+    a[0].p = pFont;
+  GUI_SetFont(pFont);
+}
+
+void GUI_RETAIN_SetTextMode(int Mode)
+{
+  RetainWordType* a = __emit(RETAIN_OP_TEXTMODE, 1);
+
+  if (a != NULL)
+    a[0].i = Mode;
+  GUI_SetTextMode(Mode);
+}
+
+void GUI_RETAIN_Clear(void)
+{
+  __emit(RETAIN_OP_CLEAR, 0);
+  GUI_Clear();
+}
+
+void GUI_RETAIN_FillRect(int x0, int y0, int x1, int y1)
+{
+  RetainWordType* a = __emit(RETAIN_OP_FILLRECT, 4);
+
+  if (a != NULL) {
+    a[0].i = x0;
+    a[1].i = y0;
+    a[2].i = x1;
+    a[3].i = y1;
+  }
+  GUI_FillRect(x0, y0, x1, y1);
+}
+
+void GUI_RETAIN_DrawGradientV(int x0, int y0, int x1, int y1, GUI_COLOR Color0, GUI_COLOR Color1)
+{
+  RetainWordType* a = __emit(RETAIN_OP_GRADIENTV, 6);
+
+  if (a != NULL) {
+    a[0].i = x0;
+    a[1].i = y0;
+    a[2].i = x1;
+    a[3].i = y1;
+    a[4].u = Color0;
+    a[5].u = Color1;
+  }
+  GUI_DrawGradientV(x0, y0, x1, y1, Color0, Color1);
+}
+
+void GUI_RETAIN_DrawGradientH(int x0, int y0, int x1, int y1, GUI_COLOR Color0, GUI_COLOR Color1)
+{
+  RetainWordType* a = __emit(RETAIN_OP_GRADIENTH, 6);
+
+  if (a != NULL) {
+    a[0].i = x0;
+    a[1].i = y0;
+    a[2].i = x1;
+    a[3].i = y1;
+    a[4].u = Color0;
+    a[5].u = Color1;
+  }
+  GUI_DrawGradientH(x0, y0, x1, y1, Color0, Color1);
+}
+
+void GUI_RETAIN_DrawBitmap(const GUI_BITMAP* pBM, int x, int y)
+{
+  RetainWordType* a = __emit(RETAIN_OP_BITMAP, 3);
+
+  if (a != NULL) {
+    a[0].p = pBM;
+    a[1].i = x;
+    a[2].i = y;
+  }
+  GUI_DrawBitmap(pBM, x, y);
+}
+
+// 洢豸¼ݸҪGUI_RETAIN_Invalidate()
+void GUI_RETAIN_DrawMemdev(GUI_MEMDEV_Handle hMem)
+{
+  RetainWordType* a = __emit(RETAIN_OP_MEMDEV, 1);
+
+  if (a != NULL)
+    a[0].i = hMem;
+  GUI_MEMDEV_Write(hMem);
+}
+
+// ַߵĻ
+void GUI_RETAIN_DispStringAt(const char* s, int x, int y)
+{
+  int Len = strlen(s) + 1;
+  int n = (Len + sizeof(RetainWordType) - 1) / sizeof(RetainWordType);
+  RetainWordType* a = __emit(RETAIN_OP_STRING, 2 + n);
+
+  if (a != NULL) {
+    a[0].i = x;
+    a[1].i = y;
+    memset(&a[2], 0, n * sizeof(RetainWordType));
+    memcpy(&a[2], s, Len);
+  }
+  GUI_DispStringAt(s, x, y);
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,91 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __GUI_RETAIN_H__
+#define __GUI_RETAIN_H__
+////////////////////////////////////////////////////////////////////////////////
+// ģʽػڵһػʱGUI_RETAIN_xxx()˳¼һŽ
+// Ժ󴰿λáߴ͵߸״̬û䣬ձطţܴ
+// ԼĻͼ롣ͬһűطżκȾ洢豸Ժֱͼ
+// ֻʺϻڵػ롣
+////////////////////////////////////////////////////////////////////////////////
+#include "GUI.h"
+#include "WM.h"
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+// 
+#ifndef RETAIN_MAX_WORDS
+#define RETAIN_MAX_WORDS      (64)          // ÿ¼ھͲ
+#endif
+#ifndef RETAIN_MEMDEV_AFTER
+#define RETAIN_MEMDEV_AFTER   (2)           // ͬһűطżκȾ洢豸
+#endif
+#ifndef RETAIN_MEMDEV_MAX
+#define RETAIN_MEMDEV_MAX     (256*1024UL)  // 洢豸ôֽڵĴֻطŲͼ
+#endif
+#ifndef RETAIN_STAT_EN
+#define RETAIN_STAT_EN        (0)           // 1=GUIDEMOÿֽӡطźͼʡµʱ
+#endif
+
+typedef union {
+  U32 u;
+  I32 i;
+  void const* p;
+} RetainWordType;
+
+typedef struct {
+  U32 Records;                // ˴ԼͼĴ
+  U32 Replays;
+  U32 Blits;
+  U32 TimeRecord;             // ۼƵ΢
+  U32 TimeReplay;
+  U32 TimeBlit;
+  I32 TimeSaved;              // ƽ¼ʱʡµ΢
+} RetainStatType;
+
+typedef struct {
+  RetainWordType aCmd[RETAIN_MAX_WORDS];
+  U16 NumWords;
+  U8 Valid;
+  U8 Overflow;
+  U32 Key;                    // ¼ʱλáߴ״̬ɢ
+  U32 Hash;                   // ɢ
+  U32 MemHash;                // 洢豸Ⱦű
+  U16 NumReplays;             // ǰطŵĴ
+  int xSize;
+  int ySize;
+  int xOrg;                   // ԭ㣬洢豸
+  int yOrg;
+  GUI_MEMDEV_Handle hMem;
+  U32 t0;
+  RetainStatType Stat;
+} RetainType;
+
+int  GUI_RETAIN_Begin(RetainType* p, WM_HWIN hWin, void const* pState, int NumBytes);
+void GUI_RETAIN_End(RetainType* p);
+void GUI_RETAIN_Invalidate(RetainType* p);
+void GUI_RETAIN_Delete(RetainType* p);
+void GUI_RETAIN_GetStat(RetainType const* p, RetainStatType* pStat);
+void GUI_RETAIN_Print(const char* sName, RetainType const* p);
+
+// ¼ʱ¼²ջ¼ʱֱӻ
+void GUI_RETAIN_SetColor(GUI_COLOR Color);
+void GUI_RETAIN_SetBkColor(GUI_COLOR Color);
+void GUI_RETAIN_SetFont(const GUI_FONT* pFont);
+void GUI_RETAIN_SetTextMode(int Mode);
+void GUI_RETAIN_Clear(void);
+void GUI_RETAIN_FillRect(int x0, int y0, int x1, int y1);
+void GUI_RETAIN_DrawGradientV(int x0, int y0, int x1, int y1, GUI_COLOR Color0, GUI_COLOR Color1);
+void GUI_RETAIN_DrawGradientH(int x0, int y0, int x1, int y1, GUI_COLOR Color0, GUI_COLOR Color1);
+void GUI_RETAIN_DrawBitmap(const GUI_BITMAP* pBM, int x, int y);
+void GUI_RETAIN_DrawMemdev(GUI_MEMDEV_Handle hMem);
+void GUI_RETAIN_DispStringAt(const char* s, int x, int y);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __GUI_RETAIN_H__ */
@@ -0,0 +1,294 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "usrinc.h"
+#include "GUI_RotSprite.h"
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// 
+#ifndef ROTSPRITE_POOL_BYTES
+#define ROTSPRITE_POOL_BYTES  (2*1024*1024UL) // سشСռemWinڴ
+#endif
+#ifndef ROTSPRITE_MIX_MAX
+#define ROTSPRITE_MIX_MAX     (128*128)       // ֵʱ֡ȡһ֡
+#endif
+
+#define ROTSPRITE_TRANSPARENT (0xFF000000UL)  // GUI_DRAW_BMP8888ȫ͸
+
+// سذȳ䣬ݶֻGUI_Lock()֮ڷ
+static U32 _pool[ROTSPRITE_POOL_BYTES / 4] MEM_PI_CPUONLY;
+static U32 _pool_used = 0;
+static U32 _mix[ROTSPRITE_MIX_MAX];
+
+/*
+* س
+* @return: ַNULL
+*/
+static void* __pool_alloc(U32 NumBytes)
+{
+  U32 NumWords = (NumBytes + 3) / 4;
+  void* p;
+
+  if (NumWords > GUI_COUNTOF(_pool) - _pool_used)
+    return NULL;
+  p = &_pool[_pool_used];
+  _pool_used += NumWords;
+  return p;
+}
+
+/*
+* õһ֡ܵ͸غ󿽽س
+* @return: 0ɹسز-1
+*/
+static int __crop(RotSpriteFrameType* f, U32 const* pData, int Size)
+{
+  int x, y, x0 = Size, y0 = Size, x1 = -1, y1 = -1;
+  U32* pDst;
+
+  for (y = 0; y < Size; y++) {
+    for (x = 0; x < Size; x++) {
+      if (pData[y * Size + x] >> 24 != 0xFF) {
+        if (x < x0) x0 = x;
+        if (x > x1) x1 = x;
+        if (y < y0) y0 = y;
+        if (y > y1) y1 = y;
+      }
+    }
+  }
+  f->x0 = (I16)(x0 - Size / 2);
+  f->y0 = (I16)(y0 - Size / 2);
+  f->xSize = 0;
+  f->ySize = 0;
+  f->pData = NULL;
+  if (x1 < 0)
+    return 0;
+  pDst = (U32*)__pool_alloc((U32)(x1 - x0 + 1) * (y1 - y0 + 1) * 4);
+  if (pDst == NULL)
+    return -1;
+  f->xSize = (I16)(x1 - x0 + 1);
+  f->ySize = (I16)(y1 - y0 + 1);
+  f->pData = pDst;
+  for (y = y0; y <= y1; y++) {
+    memcpy(pDst, &pData[y * Size + x0], f->xSize * 4);
+    pDst += f->xSize;
+  }
+  return 0;
+}
+
+static void __draw(U32 const* pData, int xSize, int ySize, int x, int y)
+{
+  GUI_BITMAP bm;
+
+  bm.XSize = xSize;
+  bm.YSize = ySize;
+  bm.BytesPerLine = xSize * 4;
+  bm.BitsPerPixel = 32;
+  bm.pData = (U8 const*)pData;
+  bm.pPal = NULL;
+  bm.pMethods = GUI_DRAW_BMP8888;
+  GUI_DrawBitmap(&bm, x, y);
+}
+
+/*
+* ȡ֡ת(x, y)أ֡Ϊȫ͸
+* @return:
+*/
+static U32 __pixel(RotSpriteFrameType const* f, int x, int y)
+{
+  x -= f->x0;
+  y -= f->y0;
+  if (x < 0 || y < 0 || x >= f->xSize || y >= f->ySize)
+    return ROTSPRITE_TRANSPARENT;
+  return f->pData[y * f->xSize + x];
+}
+
+/*
+* ֡Ȩw(0~256ԽԽf1)ֵ󻭳
+* ͸ȼȨɫȫ͸ɫ
+* @return: 0ɹ̫󷵻-1
+*/
+static int __draw_mix(RotSpriteFrameType const* f0, RotSpriteFrameType const* f1, int w, int x, int y)
+{
+  int x0, y0, x1, y1, ix, iy, sh;
+  U32 c0, c1, o0, o1, o, r;
+  U32* p = _mix;
+
+  x0 = GUI_MIN(f0->x0, f1->x0);
+  y0 = GUI_MIN(f0->y0, f1->y0);
+  x1 = GUI_MAX(f0->x0 + f0->xSize, f1->x0 + f1->xSize);
+  y1 = GUI_MAX(f0->y0 + f0->ySize, f1->y0 + f1->ySize);
+  if ((x1 - x0) * (y1 - y0) > ROTSPRITE_MIX_MAX)
+    return -1;
+  for (iy = y0; iy < y1; iy++) {
+    for (ix = x0; ix < x1; ix++) {
+      c0 = __pixel(f0, ix, iy);
+      c1 = __pixel(f1, ix, iy);
+      o0 = (255 - (c0 >> 24)) * (256 - w);
+      o1 = (255 - (c1 >> 24)) * w;
+      o = o0 + o1;
+      if (o == 0) {
+        *p++ = ROTSPRITE_TRANSPARENT;
+        continue;
+      }
+      r = (U32)(255 - (o >> 8)) << 24;
+      for (sh = 0; sh < 24; sh += 8)
+        r |= ((((c0 >> sh) & 0xFF) * o0 + ((c1 >> sh) & 0xFF) * o1) / o) << sh;
+      *p++ = r;
+    }
+  }
+  __draw(_mix, x1 - x0, y1 - y0, x + x0, y + y0);
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_ROTSPRITE_Create
+//|  |: ԤȻһתнǶ
+//|          |:
+//| б |: pfDraw/p: һ֡ĻصĲ
+//|          |: Size: صα߳תУҪܷǶȵͼ
+//|          |: a0/a1: һ֡һ֡ĽǶȣǧ֮һ
+//|          |: NumSteps: ֡Ϊ2
+//|          |: Interp: 1=ʱֵ֮֡
+//|          |:
+//|      |: 0ɹڴ治-1
+//|          |:
+//| עϢ |: ÿ֡һSize*Size32λ͸洢豸ϻãõ͸ߺŽ
+//|          |: سءд洢豸ͼοڻصGUI_MEMDEV_RotateHQ()
+//|          |: سغȳɾ˳Ҫʹ෴
+////////////////////////////////////////////////////////////////////////////////
+int GUI_ROTSPRITE_Create(RotSpriteType* pSprite, GUI_ROTSPRITE_DRAW_FUNC* pfDraw, void* p, int Size, I32 a0, I32 a1, int NumSteps, int Interp)
+{
+  GUI_MEMDEV_Handle hMem, hOld;
+  GUI_COLOR BkColor;
+  int i, r = 0;
+
+  if (NumSteps < 2 || a0 == a1)
+    return -1;
+  GUI_Lock();
+  pSprite->PoolBase = _pool_used;
+  pSprite->a0 = a0;
+  pSprite->a1 = a1;
+  pSprite->NumSteps = NumSteps;
+  pSprite->Interp = Interp;
+  pSprite->pFrame = (RotSpriteFrameType*)__pool_alloc(NumSteps * sizeof(RotSpriteFrameType));
+  hMem = GUI_MEMDEV_CreateFixed(0, 0, Size, Size, GUI_MEMDEV_NOTRANS, GUI_MEMDEV_APILIST_32, GUI_COLOR_CONV_8888);
+  if (pSprite->pFrame == NULL || hMem == 0) {
+    if (hMem != 0)
+      GUI_MEMDEV_Delete(hMem);
+    _pool_used = pSprite->PoolBase;
+    pSprite->pFrame = NULL;
+    GUI_Unlock();
+    return -1;
+  }
+  hOld = GUI_MEMDEV_Select(hMem);
+  BkColor = GUI_GetBkColor();
+  GUI_SetBkColor(GUI_TRANSPARENT);
+  for (i = 0; r == 0 && i < NumSteps; i++) {
+    GUI_Clear();
+    pfDraw(p, a0 + (I32)((I64)(a1 - a0) * i / (NumSteps - 1)), Size / 2, Size / 2);
+    r = __crop(&pSprite->pFrame[i], (U32 const*)GUI_MEMDEV_GetDataPtr(hMem), Size);
+  }
+  GUI_SetBkColor(BkColor);
+  GUI_MEMDEV_Select(hOld);
+  GUI_MEMDEV_Delete(hMem);
+  if (r != 0) {
+    _pool_used = pSprite->PoolBase;
+    pSprite->pFrame = NULL;
+  }
+  GUI_Unlock();
+  return r;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_ROTSPRITE_Draw
+//|  |: (x, y)ΪתửǶΪaľ
+//|          |:
+//| б |: a: Ƕȣǧ֮һȣΧʱȡ
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ֵʱȡһֵ֡ʱ֡úܽ򲢼̫Ҳȡһ֡
+//|          |: ֻͼµıҪȻָ(GUI_MEMDEV_DrawAuto())
+////////////////////////////////////////////////////////////////////////////////
+void GUI_ROTSPRITE_Draw(RotSpriteType const* pSprite, I32 a, int x, int y)
+{
+  RotSpriteFrameType const* f;
+  I32 Span, q;
+  int i, w;
+
+  if (pSprite->pFrame == NULL)
+    return;
+  Span = pSprite->a1 - pSprite->a0;
+  q = a - pSprite->a0;
+  if (Span < 0) {
+    Span = -Span;
+    q = -q;
+  }
+  if (q <= 0) {
+    i = 0;
+    w = 0;
+  } else if (q >= Span) {
+    i = pSprite->NumSteps - 1;
+    w = 0;
+  } else {
+    q *= pSprite->NumSteps - 1;
+    i = q / Span;
+    w = (int)((q % Span) * 256 / Span);
+  }
+  GUI_Lock();
+  if (pSprite->Interp == 0 || w < 8 || w > 248) {
+    if (w > 128)
+      i++;
+    w = 0;
+  }
+  f = &pSprite->pFrame[i];
+  if (w == 0 || __draw_mix(f, f + 1, w, x, y) != 0) {
+    if (w > 128)
+      f++;
+    if (f->xSize != 0)
+      __draw(f->pData, f->xSize, f->ySize, x + f->x0, y + f->y0);
+  }
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_ROTSPRITE_Delete
+//|  |: ɾ飬黹س
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ֮󴴽ľҲһʧЧɾ˳Ҫʹ෴
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_ROTSPRITE_Delete(RotSpriteType* pSprite)
+{
+  GUI_Lock();
+  if (pSprite->pFrame != NULL && pSprite->PoolBase <= _pool_used)
+    _pool_used = pSprite->PoolBase;
+  pSprite->pFrame = NULL;
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_ROTSPRITE_GetNumFreeBytes
+//|  |: ȡسصʣֽ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ֡ROTSPRITE_POOL_BYTES
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+U32 GUI_ROTSPRITE_GetNumFreeBytes(void)
+{
+  return (GUI_COUNTOF(_pool) - _pool_used) * 4;
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,45 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __GUI_ROT_SPRITE_H__
+#define __GUI_ROT_SPRITE_H__
+////////////////////////////////////////////////////////////////////////////////
+// ת飺ָ֮תתͼΰNǶԤȻãõ͸ߺ
+// طŽسأʱǶһֱ֡ͼѡֵ֮֡
+////////////////////////////////////////////////////////////////////////////////
+#include "GUI.h"
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+// һ֡Ļصڵǰѡе豸ϣ(xPivot, yPivot)ΪתửǶΪa(ǧ֮һ)ͼ
+typedef void GUI_ROTSPRITE_DRAW_FUNC(void* p, I32 a, int xPivot, int yPivot);
+
+typedef struct {
+  I16 x0;                     // תϽ
+  I16 y0;
+  I16 xSize;                  // 0Ϊ֡
+  I16 ySize;
+  U32 const* pData;           // GUI_DRAW_BMP8888
+} RotSpriteFrameType;
+
+typedef struct {
+  RotSpriteFrameType* pFrame; // س
+  I32 a0;                     // һ֡һ֡ĽǶȣǧ֮һ
+  I32 a1;
+  int NumSteps;
+  int Interp;                 // 1=ֵ֮֡
+  U32 PoolBase;               // ռõس㣬ɾʱ
+} RotSpriteType;
+
+int  GUI_ROTSPRITE_Create(RotSpriteType* pSprite, GUI_ROTSPRITE_DRAW_FUNC* pfDraw, void* p, int Size, I32 a0, I32 a1, int NumSteps, int Interp);
+void GUI_ROTSPRITE_Draw(RotSpriteType const* pSprite, I32 a, int x, int y);
+void GUI_ROTSPRITE_Delete(RotSpriteType* pSprite);
+U32  GUI_ROTSPRITE_GetNumFreeBytes(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __GUI_ROT_SPRITE_H__ */
@@ -0,0 +1,263 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "usrinc.h"
+#include "GUI_ScrollPlot.h"
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////
+static U32 __index(GUI_COLOR Color)
+{
+  return (GUI_COLOR_CONV_8888)->pfColor2Index(Color & 0xFFFFFF) & 0xFFFFFF;
+}
+
+/*
+* һУȻٰÿߴһеyһеy
+* aValueΪNULLʱֻ
+* @return:
+*/
+static void __column(ScrollPlotType* p, U32* pCol, I16 const* aValue)
+{
+  int y, y0, y1, t, Stride = p->xSize;
+  U32 Bk;
+
+  Bk = (p->GridDistX > 0 && p->NumCols % p->GridDistX == 0) ? p->GridColor : p->BkColor;
+  for (y = 0; y < p->ySize; y++)
+    pCol[y * Stride] = Bk;
+  if (p->GridDistY > 0) {
+    for (y = p->ySize - 1 - p->GridOffY; y >= 0; y -= p->GridDistY) {
+      if (y < p->ySize)
+        pCol[y * Stride] = p->GridColor;
+    }
+  }
+  for (t = 0; aValue != NULL && t < p->NumTraces; t++) {
+    y = p->ySize - 1 - aValue[t];
+    y0 = (p->aLast[t] < 0) ? y : GUI_MIN(y, p->aLast[t]);
+    y1 = (p->aLast[t] < 0) ? y : GUI_MAX(y, p->aLast[t]);
+    p->aLast[t] = GUI_MIN(GUI_MAX(y, 0), p->ySize - 1);
+    y0 = GUI_MAX(y0, 0);
+    y1 = GUI_MIN(y1, p->ySize - 1);
+    for (y = y0; y <= y1; y++)
+      pCol[y * Stride] = p->aColor[t];
+  }
+}
+
+/*
+* ͼɿյ(ֻб)ߴͷʼ
+* @return:
+*/
+static void __clear(ScrollPlotType* p)
+{
+  U32* pData;
+  int x, t;
+
+  pData = (U32*)GUI_MEMDEV_GetDataPtr(p->hMem);
+  p->NumCols = 0;
+  for (x = 0; x < p->xSize; x++) {
+    __column(p, pData + x, NULL);
+    p->NumCols++;
+  }
+  p->xWrite = 0;
+  for (t = 0; t < SCROLLPLOT_MAX_TRACES; t++)
+    p->aLast[t] = -1;
+}
+
+static void __draw(U32 const* pData, int xSize, int ySize, int BytesPerLine, int x, int y)
+{
+  GUI_BITMAP bm;
+
+  bm.XSize = xSize;
+  bm.YSize = ySize;
+  bm.BytesPerLine = BytesPerLine;
+  bm.BitsPerPixel = 32;
+  bm.pData = (U8 const*)pData;
+  bm.pPal = NULL;
+  bm.pMethods = GUI_DRAW_BMP8888;
+  GUI_DrawBitmap(&bm, x, y);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_SCROLLPLOT_Create
+//|  |: һͼ
+//|          |:
+//| б |: xSize/ySize: ͼСһһ
+//|          |: NumTraces/aColor: ͸Եɫ
+//|          |: BkColor: ɫ
+//|          |:
+//|      |: 0ɹԻڴ治-1
+//|          |:
+//| עϢ |: ͼһ32λ洢豸emWinڴط䡣
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int GUI_SCROLLPLOT_Create(ScrollPlotType* p, int xSize, int ySize, int NumTraces, GUI_COLOR const* aColor, GUI_COLOR BkColor)
+{
+  int t;
+
+  memset(p, 0, sizeof(*p));
+  if (xSize <= 0 || ySize <= 0 || NumTraces <= 0 || NumTraces > SCROLLPLOT_MAX_TRACES)
+    return -1;
+  GUI_Lock();
+  p->hMem = GUI_MEMDEV_CreateFixed(0, 0, xSize, ySize, GUI_MEMDEV_NOTRANS, GUI_MEMDEV_APILIST_32, GUI_COLOR_CONV_8888);
+  if (p->hMem == 0) {
+    GUI_Unlock();
+    return -1;
+  }
+  p->xSize = xSize;
+  p->ySize = ySize;
+  p->NumTraces = NumTraces;
+  for (t = 0; t < NumTraces; t++)
+    p->aColor[t] = __index(aColor[t]);
+  p->BkColor = __index(BkColor);
+  p->GridColor = p->BkColor;
+  __clear(p);
+  GUI_Unlock();
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_SCROLLPLOT_SetGrid
+//|  |: 
+//|          |:
+//| б |: DistX/DistY: ߺͺߵļ࣬0Ϊ
+//|          |: OffY: һױߵľ
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ߸һѻߣ岻Ӱ졣
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_SCROLLPLOT_SetGrid(ScrollPlotType* p, int DistX, int DistY, int OffY, GUI_COLOR Color)
+{
+  if (p->hMem == 0)
+    return;
+  GUI_Lock();
+  p->GridDistX = DistX;
+  p->GridDistY = DistY;
+  p->GridOffY = OffY;
+  p->GridColor = __index(Color);
+  __clear(p);
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_SCROLLPLOT_AddValues
+//|  |: һвÿһֵ
+//|          |:
+//| б |: aValue: ױߵͼıõ
+//|          |:
+//|      |: 0ɹλ-1
+//|          |:
+//| עϢ |: GUI_Lock()ڲɼ߳ãֻһߡ
+//|          |: ˶²Dropped
+////////////////////////////////////////////////////////////////////////////////
+int GUI_SCROLLPLOT_AddValues(ScrollPlotType* p, I16 const* aValue)
+{
+  U16 Head = p->Head;
+
+  if ((U16)(Head - p->Tail) >= SCROLLPLOT_RING) {
+    p->Dropped++;
+    return -1;
+  }
+  memcpy(p->aRing[Head & (SCROLLPLOT_RING - 1)], aValue, p->NumTraces * sizeof(I16));
+  p->Head = Head + 1;
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_SCROLLPLOT_Update
+//|  |: µĲͼ
+//|          |:
+//| б |:
+//|          |:
+//|      |: »
+//|          |:
+//| עϢ |: ˢ֮䵽˼ͻУȻͼֻһ
+//|          |: ֻĴ洢豸ʾҪGUI_SCROLLPLOT_Draw()
+////////////////////////////////////////////////////////////////////////////////
+int GUI_SCROLLPLOT_Update(ScrollPlotType* p)
+{
+  U16 Tail = p->Tail, n;
+  U32* pData;
+  int t, i;
+
+  if (p->hMem == 0)
+    return 0;
+  n = (U16)(p->Head - Tail);
+  if (n == 0)
+    return 0;
+  GUI_Lock();
+  pData = (U32*)GUI_MEMDEV_GetDataPtr(p->hMem);
+  if (n > p->xSize) {
+    // ĲҪһĲ
+    Tail += n - p->xSize - 1;
+    for (t = 0; t < p->NumTraces; t++)
+      p->aLast[t] = GUI_MIN(GUI_MAX(p->ySize - 1 - p->aRing[Tail & (SCROLLPLOT_RING - 1)][t], 0), p->ySize - 1);
+    p->NumCols += n - p->xSize;
+    Tail++;
+    n = (U16)p->xSize;
+  }
+  for (i = 0; i < n; i++) {
+    __column(p, pData + p->xWrite, p->aRing[Tail & (SCROLLPLOT_RING - 1)]);
+    Tail++;
+    p->NumCols++;
+    if (++p->xWrite == p->xSize)
+      p->xWrite = 0;
+  }
+  p->Tail = Tail;
+  GUI_Unlock();
+  return n;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_SCROLLPLOT_Draw
+//|  |: (x, y)ʾͼµһұ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ͼѭдλгΣ[xWrite, xSize)ߣ
+//|          |: [0, xWrite)ұߣζֱָ洢豸λͼ
+////////////////////////////////////////////////////////////////////////////////
+void GUI_SCROLLPLOT_Draw(ScrollPlotType const* p, int x, int y)
+{
+  U32 const* pData;
+  int xSize0;
+
+  if (p->hMem == 0)
+    return;
+  GUI_Lock();
+  pData = (U32 const*)GUI_MEMDEV_GetDataPtr(p->hMem);
+  xSize0 = p->xSize - p->xWrite;
+  __draw(pData + p->xWrite, xSize0, p->ySize, p->xSize * 4, x, y);
+  if (p->xWrite > 0)
+    __draw(pData, p->xWrite, p->ySize, p->xSize * 4, x + xSize0, y);
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_SCROLLPLOT_Delete
+//|  |: ɾͼ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_SCROLLPLOT_Delete(ScrollPlotType* p)
+{
+  GUI_Lock();
+  if (p->hMem != 0)
+    GUI_MEMDEV_Delete(p->hMem);
+  p->hMem = 0;
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
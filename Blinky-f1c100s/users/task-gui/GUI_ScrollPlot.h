@@ -0,0 +1,56 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __GUI_SCROLL_PLOT_H__
+#define __GUI_SCROLL_PLOT_H__
+////////////////////////////////////////////////////////////////////////////////
+// (ʾ/¼ʽ)Ƚλ壬ˢʱֻµļУ
+// ͼҲǰѭʹõĴ洢豸ʾʱдλ÷
+// ƣҲػɵߺ
+////////////////////////////////////////////////////////////////////////////////
+#include "GUI.h"
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+// 
+#ifndef SCROLLPLOT_MAX_TRACES
+#define SCROLLPLOT_MAX_TRACES (4)   // ÿͼ
+#endif
+#ifndef SCROLLPLOT_RING
+#define SCROLLPLOT_RING       (512) // λ2
+#endif
+
+typedef struct {
+  GUI_MEMDEV_Handle hMem;     // ѭʹõĻͼ
+  int xSize;
+  int ySize;
+  int xWrite;                 // һдҲɵһ
+  U32 NumCols;                // 
+  int NumTraces;
+  U32 aColor[SCROLLPLOT_MAX_TRACES];  // ת
+  int aLast[SCROLLPLOT_MAX_TRACES];   // һеy-1Ϊû
+  U32 BkColor;
+  U32 GridColor;
+  int GridDistX;              // 0Ϊ
+  int GridDistY;
+  int GridOffY;
+  I16 aRing[SCROLLPLOT_RING][SCROLLPLOT_MAX_TRACES];
+  volatile U16 Head;          // ֻд
+  volatile U16 Tail;          // ֻGUI_SCROLLPLOT_Update()д
+  U32 Dropped;                // λʱĲ
+} ScrollPlotType;
+
+int  GUI_SCROLLPLOT_Create(ScrollPlotType* p, int xSize, int ySize, int NumTraces, GUI_COLOR const* aColor, GUI_COLOR BkColor);
+void GUI_SCROLLPLOT_SetGrid(ScrollPlotType* p, int DistX, int DistY, int OffY, GUI_COLOR Color);
+int  GUI_SCROLLPLOT_AddValues(ScrollPlotType* p, I16 const* aValue);
+int  GUI_SCROLLPLOT_Update(ScrollPlotType* p);
+void GUI_SCROLLPLOT_Draw(ScrollPlotType const* p, int x, int y);
+void GUI_SCROLLPLOT_Delete(ScrollPlotType* p);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __GUI_SCROLL_PLOT_H__ */
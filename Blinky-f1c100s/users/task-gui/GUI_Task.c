@@ -23,7 +23,8 @@ static OS_TID _gui_tid = 0;
 ////////////////////////////////////////////////////////////////////////////////
 bool_t APP_CreateGuiService(void)
 {
-  _gui_tid = os_tsk_create_user(
+  _gui_tid = TSKMON_CreateTask(
+                 "gui",
                  __ThreadGUI,
                  TSK_PRIO_LOLIMIT,
                  __StackGUI,
@@ -0,0 +1,686 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "usrinc.h"
+#include "GUI_TextCache.h"
+#include <string.h>
+#include <stdio.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// 
+#ifndef TEXTCACHE_NUM
+#define TEXTCACHE_NUM         (32)          // ໺ִ
+#endif
+#ifndef TEXTCACHE_MAX_LEN
+#define TEXTCACHE_MAX_LEN     (32)          // ִ
+#endif
+#ifndef TEXTCACHE_BUDGET
+#define TEXTCACHE_BUDGET      (256*1024UL)  // ִֽԤ㣬洢豸emWinڴط
+#endif
+#ifndef TEXTCACHE_ATLAS_NUM
+#define TEXTCACHE_ATLAS_NUM   (4)           // ģÿһ
+#endif
+#ifndef TEXTCACHE_GLYPH_MAX
+#define TEXTCACHE_GLYPH_MAX   (64*64)       // ģֱӻ
+#endif
+
+// ģֱַַӻ
+static const char _atlas_chars[] = "0123456789+-.,:% ";
+#define TEXTCACHE_ATLAS_CHARS ((int)sizeof(_atlas_chars) - 1)
+
+typedef struct {
+  const GUI_FONT* pFont;
+  GUI_COLOR Color;
+  GUI_COLOR BkColor;          // ͸ģʽʱΪ0
+  U8 Trans;
+  char s[TEXTCACHE_MAX_LEN + 1];
+} TextCacheKeyType;
+
+typedef struct {
+  TextCacheKeyType Key;
+  GUI_MEMDEV_Handle hMem;     // 0Ϊ
+  U32 NumBytes;
+  U32 Stamp;                  // һʹõʱ̣ԽСԽû
+  S16 xSize;
+  S16 ySize;
+} TextCacheEntryType;
+
+typedef struct {
+  const GUI_FONT* pFont;      // NULLΪ
+  GUI_MEMDEV_Handle hMem;     // ڵװֵĸʣֻɫ
+  U32 Stamp;
+  S16 xSize;
+  S16 ySize;
+  S16 xOff[TEXTCACHE_ATLAS_CHARS];
+  S16 Width[TEXTCACHE_ATLAS_CHARS];
+} TextAtlasType;
+
+// ݶֻGUI_Lock()֮ڷ
+static TextCacheEntryType _cache[TEXTCACHE_NUM];
+static TextAtlasType _atlas[TEXTCACHE_ATLAS_NUM];
+static TextCacheStatType _stat = {0, 0, 0, 0, 0, 0, TEXTCACHE_BUDGET, 0};
+static U32 _stamp = 0;
+static U32 _glyph[TEXTCACHE_GLYPH_MAX];
+static U32 _lut[256];         // ʵصɫģ
+static GUI_COLOR _lut_color;
+static GUI_COLOR _lut_bk;
+static int _lut_trans = -1;
+
+/*
+* GUI_COLORתɴ洢豸أGUI_DRAW_BMP88880xAARRGGBBA=0͸
+* @return:
+*/
+static U32 __index(GUI_COLOR Color)
+{
+  return (GUI_COLOR_CONV_8888)->pfColor2Index(Color & 0xFFFFFF) & 0xFFFFFF;
+}
+
+static U32 __mix(U32 fg, U32 bk, unsigned a)
+{
+  U32 r = 0;
+  int sh;
+
+  for (sh = 0; sh < 24; sh += 8)
+    r |= ((((fg >> sh) & 0xFF) * a + ((bk >> sh) & 0xFF) * (255 - a)) / 255) << sh;
+  return r;
+}
+
+/*
+* ɸʵصɫ
+* ͸ʱԤȺͱɫϺã͸ʱɫ䣬ʷŽalpha
+* emWin32λ洢豸λͼֱͨalphaﲻԤˡ
+* @return:
+*/
+static void __make_lut(U32* lut, GUI_COLOR Color, GUI_COLOR BkColor, int Trans)
+{
+  U32 fg, bk;
+  int i;
+
+  fg = __index(Color);
+  bk = __index(BkColor);
+  for (i = 0; i < 256; i++)
+    lut[i] = Trans ? (((U32)(255 - i) << 24) | fg) : __mix(fg, bk, i);
+}
+
+/*
+* ȡǰģʽ
+* @return: 1=͸ 0=͸ɫ򷵻-1()
+*/
+static int __get_trans(void)
+{
+  switch (GUI_GetTextMode()) {
+  case GUI_TM_NORMAL:
+    return 0;
+  case GUI_TM_TRANS:
+    return 1;
+  default:
+    return -1;
+  }
+}
+
+/*
+* ǰ뷽ʽϽ
+* @return:
+*/
+static void __align(int* x, int* y, int xSize, int ySize)
+{
+  int Align = GUI_GetTextAlign();
+
+  switch (Align & GUI_TA_HORIZONTAL) {
+  case GUI_TA_RIGHT:
+    *x -= xSize;
+    break;
+  case GUI_TA_HCENTER:
+    *x -= xSize / 2;
+    break;
+  }
+  switch (Align & GUI_TA_VERTICAL) {
+  case GUI_TA_BOTTOM:
+    *y -= ySize - 1;
+    break;
+  case GUI_TA_VCENTER:
+    *y -= ySize / 2;
+    break;
+  case GUI_TA_BASELINE:
+    *y -= GUI_GetFont()->Baseline;
+    break;
+  }
+}
+
+/*
+* õǰִڵװֻµ32λ洢豸õÿصĸ
+* @return: 洢豸ڴ治0
+*/
+static GUI_MEMDEV_Handle __raster(const char* s, int xSize, int ySize, const S16* xOff)
+{
+  GUI_MEMDEV_Handle hMem, hOld;
+  GUI_COLOR Color, BkColor;
+  int Mode, Align, x0, y0, i;
+
+  hMem = GUI_MEMDEV_CreateFixed(0, 0, xSize, ySize, GUI_MEMDEV_NOTRANS, GUI_MEMDEV_APILIST_32, GUI_COLOR_CONV_8888);
+  if (hMem == 0)
+    return 0;
+  Color = GUI_GetColor();
+  BkColor = GUI_GetBkColor();
+  Mode = GUI_GetTextMode();
+  Align = GUI_GetTextAlign();
+  x0 = GUI_GetDispPosX();
+  y0 = GUI_GetDispPosY();
+  hOld = GUI_MEMDEV_Select(hMem);
+  GUI_SetBkColor(GUI_BLACK);
+  GUI_Clear();
+  GUI_SetColor(GUI_WHITE);
+  GUI_SetTextMode(GUI_TM_TRANS);
+  GUI_SetTextAlign(GUI_TA_LEFT | GUI_TA_TOP);
+  if (xOff == NULL) {
+    GUI_DispStringAt(s, 0, 0);
+  } else {
+    // ģַţ־ַһ
+    for (i = 0; s[i]; i++)
+      GUI_DispCharAt((U8)s[i], xOff[i], 0);
+  }
+  GUI_MEMDEV_Select(hOld);
+  GUI_SetColor(Color);
+  GUI_SetBkColor(BkColor);
+  GUI_SetTextMode(Mode);
+  GUI_SetTextAlign(Align);
+  GUI_GotoXY(x0, y0);
+  return hMem;
+}
+
+static void __remove(int i)
+{
+  GUI_MEMDEV_Delete(_cache[i].hMem);
+  _stat.NumBytes -= _cache[i].NumBytes;
+  _stat.NumEntries--;
+  _cache[i].hMem = 0;
+}
+
+/*
+* ̭ûõһ
+* @return: ̭±꣬Ϊշ-1
+*/
+static int __evict(void)
+{
+  int i, lru = -1;
+
+  for (i = 0; i < TEXTCACHE_NUM; i++) {
+    if (_cache[i].hMem != 0 && (lru < 0 || (S32)(_cache[i].Stamp - _cache[lru].Stamp) < 0))
+      lru = i;
+  }
+  if (lru >= 0) {
+    __remove(lru);
+    _stat.Evictions++;
+  }
+  return lru;
+}
+
+static int __find(TextCacheKeyType const* k)
+{
+  int i;
+
+  for (i = 0; i < TEXTCACHE_NUM; i++) {
+    if (_cache[i].hMem != 0 && _cache[i].Key.pFont == k->pFont && _cache[i].Key.Color == k->Color &&
+        _cache[i].Key.BkColor == k->BkColor && _cache[i].Key.Trans == k->Trans && strcmp(_cache[i].Key.s, k->s) == 0)
+      return i;
+  }
+  return -1;
+}
+
+/*
+* դִɫŽ棬Ҫʱ̭
+* @return: ±꣬Ԥڴ治-1
+*/
+static int __load(TextCacheKeyType const* k)
+{
+  GUI_MEMDEV_Handle hMem;
+  U32 NumBytes, lut[256];
+  U32* pData;
+  int xSize, ySize, i;
+
+  xSize = GUI_GetStringDistX(k->s);
+  ySize = GUI_GetFontDistY();
+  if (xSize <= 0 || ySize <= 0)
+    return -1;
+  NumBytes = (U32)xSize * ySize * 4;
+  if (NumBytes > _stat.Budget)
+    return -1;
+  while (_stat.NumBytes + NumBytes > _stat.Budget || _stat.NumEntries >= TEXTCACHE_NUM)
+    __evict();
+
+  for (;;) {
+    hMem = __raster(k->s, xSize, ySize, NULL);
+    if (hMem != 0 || __evict() < 0)
+      break;
+  }
+  if (hMem == 0)
+    return -1;
+  __make_lut(lut, k->Color, k->BkColor, k->Trans);
+  pData = (U32*)GUI_MEMDEV_GetDataPtr(hMem);
+  for (i = 0; i < xSize * ySize; i++)
+    pData[i] = lut[pData[i] & 0xFF];
+
+  for (i = 0; _cache[i].hMem != 0; i++)
+    ;
+  _cache[i].Key = *k;
+  _cache[i].hMem = hMem;
+  _cache[i].NumBytes = NumBytes;
+  _cache[i].Stamp = _stamp++;
+  _cache[i].xSize = (S16)xSize;
+  _cache[i].ySize = (S16)ySize;
+  _stat.NumBytes += NumBytes;
+  _stat.NumEntries++;
+  return i;
+}
+
+/*
+* ȡǰģûо½һţ̭ûõ
+* @return: ģڴ治NULL
+*/
+static TextAtlasType* __get_atlas(void)
+{
+  const GUI_FONT* pFont = GUI_GetFont();
+  TextAtlasType* a = NULL;
+  int i, x;
+
+  for (i = 0; i < TEXTCACHE_ATLAS_NUM; i++) {
+    if (_atlas[i].pFont == pFont) {
+      _atlas[i].Stamp = _stamp++;
+      return &_atlas[i];
+    }
+  }
+  for (i = 0; i < TEXTCACHE_ATLAS_NUM; i++) {
+    if (_atlas[i].pFont == NULL) {
+      a = &_atlas[i];
+      break;
+    }
+    if (a == NULL || (S32)(_atlas[i].Stamp - a->Stamp) < 0)
+      a = &_atlas[i];
+  }
+  if (a->pFont != NULL) {
+    GUI_MEMDEV_Delete(a->hMem);
+    a->pFont = NULL;
+  }
+  for (i = x = 0; i < TEXTCACHE_ATLAS_CHARS; i++) {
+    a->xOff[i] = (S16)x;
+    a->Width[i] = (S16)GUI_GetCharDistX((U8)_atlas_chars[i]);
+    x += a->Width[i];
+  }
+  a->xSize = (S16)x;
+  a->ySize = (S16)GUI_GetFontDistY();
+  a->hMem = __raster(_atlas_chars, a->xSize, a->ySize, a->xOff);
+  if (a->hMem == 0)
+    return NULL;
+  a->pFont = pFont;
+  a->Stamp = _stamp++;
+  _stat.AtlasBuilds++;
+  return a;
+}
+
+/*
+* õǰɫģһַɫ󻭳
+* @return:
+*/
+static void __draw_glyph(TextAtlasType const* a, int i, int x, int y)
+{
+  GUI_BITMAP bm;
+  U32 const* pSrc;
+  U32* pDst = _glyph;
+  int xSize = a->Width[i], ix, iy;
+
+  pSrc = (U32 const*)GUI_MEMDEV_GetDataPtr(a->hMem) + a->xOff[i];
+  for (iy = 0; iy < a->ySize; iy++) {
+    for (ix = 0; ix < xSize; ix++)
+      *pDst++ = _lut[pSrc[ix] & 0xFF];
+    pSrc += a->xSize;
+  }
+  bm.XSize = xSize;
+  bm.YSize = a->ySize;
+  bm.BytesPerLine = xSize * 4;
+  bm.BitsPerPixel = 32;
+  bm.pData = (U8 const*)_glyph;
+  bm.pPal = NULL;
+  bm.pMethods = GUI_DRAW_BMP8888;
+  GUI_DrawBitmap(&bm, x, y);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_TEXTCACHE_DispStringAt
+//|  |: (x, y)ʾһ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: GUI_DispStringAt()ͬʹõǰ塢ɫɫģʽ
+//|          |: 뷽ʽС̫ɫģʽֱִӻ
+//|          |: ַֻ岻иı䡣
+////////////////////////////////////////////////////////////////////////////////
+void GUI_TEXTCACHE_DispStringAt(const char* s, int x, int y)
+{
+  TextCacheKeyType k;
+  int i, Trans;
+
+  GUI_Lock();
+  Trans = __get_trans();
+  if (Trans < 0 || strlen(s) > TEXTCACHE_MAX_LEN || strchr(s, '\n') != NULL) {
+    _stat.Bypass++;
+    GUI_DispStringAt(s, x, y);
+    GUI_Unlock();
+    return;
+  }
+  memset(&k, 0, sizeof(k));
+  k.pFont = GUI_GetFont();
+  k.Color = GUI_GetColor();
+  k.BkColor = Trans ? 0 : GUI_GetBkColor();
+  k.Trans = (U8)Trans;
+  strcpy(k.s, s);
+  i = __find(&k);
+  if (i >= 0) {
+    _stat.Hits++;
+  } else {
+    _stat.Misses++;
+    i = __load(&k);
+  }
+  if (i < 0) {
+    _stat.Bypass++;
+    GUI_DispStringAt(s, x, y);
+  } else {
+    _cache[i].Stamp = _stamp++;
+    __align(&x, &y, _cache[i].xSize, _cache[i].ySize);
+    if (Trans)
+      GUI_MEMDEV_WriteAt(_cache[i].hMem, x, y);
+    else
+      GUI_MEMDEV_WriteOpaqueAt(_cache[i].hMem, x, y);
+    GUI_GotoXY(x + _cache[i].xSize, y);
+  }
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_TEXTCACHE_DispStringInRect
+//|  |: ھﰴAlignʾһ
+//|          |:
+//| б |: Align: GUI_TA_xxx
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ֻԵִͬGUI_DispStringInRect()εĲֱõ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_TEXTCACHE_DispStringInRect(const char* s, const GUI_RECT* pRect, int Align)
+{
+  const GUI_RECT* pOldClip;
+  GUI_RECT Rect;
+  int OldAlign, x, y;
+
+  switch (Align & GUI_TA_HORIZONTAL) {
+  case GUI_TA_RIGHT:
+    x = pRect->x1 + 1;
+    break;
+  case GUI_TA_HCENTER:
+    x = (pRect->x0 + pRect->x1 + 1) / 2;
+    break;
+  default:
+    x = pRect->x0;
+    break;
+  }
+  switch (Align & GUI_TA_VERTICAL) {
+  case GUI_TA_BOTTOM:
+    y = pRect->y1;
+    break;
+  case GUI_TA_VCENTER:
+    y = (pRect->y0 + pRect->y1 + 1) / 2;
+    break;
+  default:
+    y = pRect->y0;
+    break;
+  }
+  GUI_Lock();
+  // ͵ѾĲüȡܻȥ
+  Rect = *pRect;
+  pOldClip = GUI_SetClipRect(&Rect);
+  if (pOldClip != NULL) {
+    GUI__IntersectRect(&Rect, pOldClip);
+    GUI_SetClipRect(&Rect);
+  }
+  OldAlign = GUI_SetTextAlign(Align);
+  GUI_TEXTCACHE_DispStringAt(s, x, y);
+  GUI_SetTextAlign(OldAlign);
+  GUI_SetClipRect(pOldClip);
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_TEXTCACHE_DispDigitsAt
+//|  |: ģ(x, y)ʾһ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ʺÿ֡ڱĶģÿֻդһΣɫڻ
+//|          |: ʱɫɫűҲؽģֱַӻ
+////////////////////////////////////////////////////////////////////////////////
+void GUI_TEXTCACHE_DispDigitsAt(const char* s, int x, int y)
+{
+  TextAtlasType* a;
+  GUI_COLOR Color, BkColor;
+  const char *p, *q;
+  int xSize, i, Trans;
+
+  GUI_Lock();
+  Trans = __get_trans();
+  a = (Trans < 0) ? NULL : __get_atlas();
+  if (a == NULL) {
+    _stat.Bypass++;
+    GUI_DispStringAt(s, x, y);
+    GUI_Unlock();
+    return;
+  }
+  Color = GUI_GetColor();
+  BkColor = Trans ? 0 : GUI_GetBkColor();
+  if (Trans != _lut_trans || Color != _lut_color || BkColor != _lut_bk) {
+    __make_lut(_lut, Color, BkColor, Trans);
+    _lut_color = Color;
+    _lut_bk = BkColor;
+    _lut_trans = Trans;
+  }
+  for (xSize = 0, p = s; *p; p++)
+    xSize += GUI_GetCharDistX((U8)*p);
+  __align(&x, &y, xSize, a->ySize);
+  for (p = s; *p; p++) {
+    q = strchr(_atlas_chars, *p);
+    i = (int)(q - _atlas_chars);
+    if (q != NULL && a->Width[i] * a->ySize <= TEXTCACHE_GLYPH_MAX) {
+      __draw_glyph(a, i, x, y);
+      x += a->Width[i];
+    } else {
+      GUI_DispCharAt((U8)*p, x, y);
+      x += GUI_GetCharDistX((U8)*p);
+    }
+  }
+  GUI_GotoXY(x, y);
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_TEXTCACHE_DispDecAt
+//|  |: ģ(x, y)ʾһʮ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: λ٣ͬGUI_DispDecMin()
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_TEXTCACHE_DispDecAt(I32 v, int x, int y)
+{
+  char ac[12], *p = &ac[sizeof(ac) - 1];
+  U32 u = (v < 0) ? 0 - (U32)v : (U32)v;
+
+  *p = 0;
+  do {
+    *--p = (char)('0' + u % 10);
+    u /= 10;
+  } while (u);
+  if (v < 0)
+    *--p = '-';
+  GUI_TEXTCACHE_DispDigitsAt(p, x, y);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_TEXTCACHE_SetBudget
+//|  |: ִֽԤ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ԤСʱ̭Ԥڣģڡ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_TEXTCACHE_SetBudget(U32 NumBytes)
+{
+  GUI_Lock();
+  _stat.Budget = NumBytes;
+  while (_stat.NumBytes > _stat.Budget)
+    __evict();
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_TEXTCACHE_Flush
+//|  |: ִģ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: (ⲿֿ¼)֮á
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_TEXTCACHE_Flush(void)
+{
+  int i;
+
+  GUI_Lock();
+  for (i = 0; i < TEXTCACHE_NUM; i++) {
+    if (_cache[i].hMem != 0)
+      __remove(i);
+  }
+  for (i = 0; i < TEXTCACHE_ATLAS_NUM; i++) {
+    if (_atlas[i].pFont != NULL) {
+      GUI_MEMDEV_Delete(_atlas[i].hMem);
+      _atlas[i].pFont = NULL;
+    }
+  }
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_TEXTCACHE_GetStat
+//|  |: ȡʵͳ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_TEXTCACHE_GetStat(TextCacheStatType* pStat)
+{
+  GUI_Lock();
+  *pStat = _stat;
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_TEXTCACHE_Bench
+//|  |: Ա޻ʱֵĺʱӡԴ
+//|          |:
+//| б |: pFont: õ
+//|          |: s: õִ
+//|          |: n: ÿĴ
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: һĴ洢豸ϣӰĻ͸Ͳ͸ģʽһ飬
+//|          |: GUI_DispDecMin()ģ
+////////////////////////////////////////////////////////////////////////////////
+void GUI_TEXTCACHE_Bench(const GUI_FONT* pFont, const char* s, int n)
+{
+  static const char* const _mode_name[] = {"normal", "trans"};
+  GUI_MEMDEV_Handle hMem, hOld;
+  const GUI_FONT* pOldFont;
+  GUI_COLOR Color, BkColor;
+  U32 t[3];
+  int Mode, Align, Trans, i, xSize, ySize;
+
+  GUI_Lock();
+  pOldFont = GUI_SetFont(pFont);
+  xSize = GUI_GetStringDistX(s) + GUI_GetStringDistX("-0000000");
+  ySize = GUI_GetFontDistY();
+  hMem = GUI_MEMDEV_CreateFixed(0, 0, xSize, ySize, GUI_MEMDEV_NOTRANS, GUI_MEMDEV_APILIST_32, GUI_COLOR_CONV_8888);
+  if (hMem == 0) {
+    GUI_SetFont(pOldFont);
+    GUI_Unlock();
+    printf("TextCache: no memory.\n");
+    return;
+  }
+  Color = GUI_GetColor();
+  BkColor = GUI_GetBkColor();
+  Mode = GUI_GetTextMode();
+  Align = GUI_GetTextAlign();
+  hOld = GUI_MEMDEV_Select(hMem);
+  GUI_SetColor(GUI_WHITE);
+  GUI_SetBkColor(GUI_BLUE);
+  GUI_SetTextAlign(GUI_TA_LEFT | GUI_TA_TOP);
+  for (Trans = 0; Trans < 2; Trans++) {
+    GUI_SetTextMode(Trans ? GUI_TM_TRANS : GUI_TM_NORMAL);
+    GUI_TEXTCACHE_DispStringAt(s, 0, 0); // Ȱѻ
+    t[0] = target_hrt_read();
+    for (i = 0; i < n; i++)
+      GUI_DispStringAt(s, 0, 0);
+    t[1] = target_hrt_read();
+    for (i = 0; i < n; i++)
+      GUI_TEXTCACHE_DispStringAt(s, 0, 0);
+    t[2] = target_hrt_read();
+    printf("TextCache %s \"%s\" x%d: %u us, cached %u us\n",
+           _mode_name[Trans], s, n,
+           (unsigned)TARGET_HRT_US(t[1] - t[0]),
+           (unsigned)TARGET_HRT_US(t[2] - t[1]));
+    t[0] = target_hrt_read();
+    for (i = 0; i < n; i++) {
+      GUI_GotoXY(0, 0);
+      GUI_DispDecMin(i * 7);
+    }
+    t[1] = target_hrt_read();
+    for (i = 0; i < n; i++)
+      GUI_TEXTCACHE_DispDecAt(i * 7, 0, 0);
+    t[2] = target_hrt_read();
+    printf("TextCache %s digits x%d: %u us, atlas %u us\n",
+           _mode_name[Trans], n,
+           (unsigned)TARGET_HRT_US(t[1] - t[0]),
+           (unsigned)TARGET_HRT_US(t[2] - t[1]));
+  }
+  GUI_MEMDEV_Select(hOld);
+  GUI_MEMDEV_Delete(hMem);
+  GUI_SetFont(pOldFont);
+  GUI_SetColor(Color);
+  GUI_SetBkColor(BkColor);
+  GUI_SetTextMode(Mode);
+  GUI_SetTextAlign(Align);
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
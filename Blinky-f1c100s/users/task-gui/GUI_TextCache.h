@@ -0,0 +1,46 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __GUI_TEXT_CACHE_H__
+#define __GUI_TEXT_CACHE_H__
+////////////////////////////////////////////////////////////////////////////////
+// ֻ棺ͬһ塢ɫµһֻŰդһΣ
+// 32λalphaĴ洢豸Ժֱӿÿһŵ
+// ģʱ򰴵ǰɫɫÿ»ģ
+////////////////////////////////////////////////////////////////////////////////
+#include "GUI.h"
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+// 
+#ifndef TEXTCACHE_BENCH_EN
+#define TEXTCACHE_BENCH_EN    (0)   // 1=GUIDEMO_AntialiasedTextʱӡ޻ĺʱԱ
+#endif
+
+typedef struct {
+  U32 Hits;
+  U32 Misses;
+  U32 Evictions;
+  U32 Bypass;                 // ̫лڴ治ֱӻĴ
+  U32 AtlasBuilds;            // ½ģĴ
+  U32 NumBytes;               // ִ浱ǰռ
+  U32 Budget;
+  int NumEntries;
+} TextCacheStatType;
+
+void GUI_TEXTCACHE_DispStringAt(const char* s, int x, int y);
+void GUI_TEXTCACHE_DispStringInRect(const char* s, const GUI_RECT* pRect, int Align);
+void GUI_TEXTCACHE_DispDigitsAt(const char* s, int x, int y);
+void GUI_TEXTCACHE_DispDecAt(I32 v, int x, int y);
+void GUI_TEXTCACHE_SetBudget(U32 NumBytes);
+void GUI_TEXTCACHE_Flush(void);
+void GUI_TEXTCACHE_GetStat(TextCacheStatType* pStat);
+void GUI_TEXTCACHE_Bench(const GUI_FONT* pFont, const char* s, int n);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __GUI_TEXT_CACHE_H__ */
@@ -0,0 +1,174 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "usrinc.h"
+#include "GUI.h"
+#include "GUI_TouchFilter.h"
+#include "tp-f1c100s.h"
+#include "f1c100s-irq.h"
+#include "framebuffer.h"
+#include <stdio.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// 
+#ifndef TOUCH_FRAME_MS
+#define TOUCH_FRAME_MS    (16)        // סڼGUIϱļˢʶ
+#endif
+#ifndef TOUCH_RING_SIZE
+#define TOUCH_RING_SIZE   (64)        // 2
+#endif
+#ifndef TOUCH_TRACE_EN
+#define TOUCH_TRACE_EN    (0)         // 1=ӡԭʼץȡtools/touch-replayĻط
+#endif
+
+// У׼(4.3480x272ĵֵ)
+#ifndef TOUCH_CAL_X0
+#define TOUCH_CAL_X0      (200)
+#define TOUCH_CAL_X1      (3900)
+#define TOUCH_CAL_Y0      (350)
+#define TOUCH_CAL_Y1      (3750)
+#define TOUCH_CAL_SWAP    (0)
+#endif
+
+#define TOUCH_EVT_SAMPLE  (0x0001)
+
+////////////////////////////////////////////////////////////////////////////////
+static U64 __StackTouch[2048 / 8] MEM_PI_STACK;
+static __task void __ThreadTouch(void);
+static OS_TID _touch_tid = 0;
+
+static tp_f1c100s_t _tp;
+static TouchFilterType _filter;
+
+// ж()봥߳()֮ĵߵ߻ζУ
+static TouchSampleType _ring[TOUCH_RING_SIZE];
+static volatile u16_t _ring_head = 0;   // жд
+static volatile u16_t _ring_tail = 0;   // ߳д
+static volatile u32_t _ring_overrun = 0;
+
+static void __ring_push(uint16_t x, uint16_t y, uint8_t pressed)
+{
+  u16_t head = _ring_head;
+  TouchSampleType* s;
+
+  if ((u16_t)(head - _ring_tail) >= TOUCH_RING_SIZE) {
+    _ring_overrun++;
+    return;
+  }
+  s = &_ring[head & (TOUCH_RING_SIZE - 1)];
+  s->t = sys_tick;
+  s->x = x;
+  s->y = y;
+  s->pressed = pressed;
+  _ring_head = head + 1;
+  // ɿձǿʱẒ̻̇߳߳һ֡Լȡ
+  if (head == _ring_tail && _touch_tid != 0) {
+    isr_evt_set(TOUCH_EVT_SAMPLE, _touch_tid);
+  }
+}
+
+static void tp_irq(void)
+{
+  uint16_t x = 0, y = 0;
+  uint32_t evt = tp_f1c100s_get_event(&_tp, &x, &y);
+
+  if (evt & TP_EVENT_DATA) {
+    __ring_push(x, y, 1);
+  }
+  if (evt & TP_EVENT_UP) {
+    __ring_push(0, 0, 0);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: APP_CreateTouchService
+//|  |: ʼ߳
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ߳ƽʱ¼ϣ̶ٰѯ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+bool_t APP_CreateTouchService(void)
+{
+  TouchCalibType cal;
+  fb_panel_t const* panel = fb_f1c100s_get_panel();
+
+  cal.raw_x0 = TOUCH_CAL_X0;
+  cal.raw_x1 = TOUCH_CAL_X1;
+  cal.raw_y0 = TOUCH_CAL_Y0;
+  cal.raw_y1 = TOUCH_CAL_Y1;
+  cal.xsize = panel->width;     // 갴ʱѡ
+  cal.ysize = panel->height;
+  cal.swap_xy = TOUCH_CAL_SWAP;
+  TOUCH_FilterInit(&_filter, &cal);
+
+  _touch_tid = TSKMON_CreateTask(
+                   "touch",
+                   __ThreadTouch,
+                   TSK_PRIO_LOWER,
+                   __StackTouch,
+                   sizeof(__StackTouch));
+
+  if (_touch_tid == 0) {
+    DBG_PUTS("Touch failed.\n");
+    return false;
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: __ThreadTouch
+//|  |: ߳
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ʱڵȴж¼סڼÿ֡һΣ
+//|          |: һ֡ڵȫͽ˲GUIύһƶ
+////////////////////////////////////////////////////////////////////////////////
+static __task void __ThreadTouch(void)
+{
+  TouchSampleType s;
+  TouchStateType st;
+  GUI_PID_STATE pid;
+
+  _tp.virt = F1C100S_TP_BASE;
+  _tp.sensitive = 15;
+  tp_f1c100s_init(&_tp);
+  f1c100s_intc_set_isr(F1C100S_IRQ_TP, tp_irq);
+  f1c100s_intc_enable_irq(F1C100S_IRQ_TP);
+
+  for (;;) {
+    if (TOUCH_FilterIsActive(&_filter)) {
+      os_dly_wait(TOUCH_FRAME_MS);
+    } else {
+      os_evt_wait_or(TOUCH_EVT_SAMPLE, 0xFFFF);
+    }
+    os_evt_clr(TOUCH_EVT_SAMPLE, os_tsk_self());
+
+    while (_ring_tail != _ring_head) {
+      s = _ring[_ring_tail & (TOUCH_RING_SIZE - 1)];
+      _ring_tail++;
+#if (TOUCH_TRACE_EN > 0)
+      printf("%u %u %u %u\n", s.t, s.x, s.y, s.pressed);
+#endif
+      TOUCH_FilterPut(&_filter, &s);
+    }
+
+    while (TOUCH_FilterGet(&_filter, &st)) {
+      pid.x = st.x;
+      pid.y = st.y;
+      pid.Pressed = st.pressed;
+      pid.Layer = 0;
+      LCDCONF_Invalidate();     // ʱȻָȫˢ
+      GUI_TOUCH_StoreStateEx(&pid);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
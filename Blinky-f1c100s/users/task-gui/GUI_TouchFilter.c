@@ -0,0 +1,195 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "GUI_TouchFilter.h"
+#include <string.h>
+
+static int32_t __median3(int32_t a, int32_t b, int32_t c)
+{
+  if (a > b) {
+    int32_t t = a;
+    a = b;
+    b = t;
+  }
+  if (b > c)
+    b = c;
+  return (a > b) ? a : b;
+}
+
+static int32_t __map_axis(int32_t raw, int32_t raw0, int32_t raw1, int32_t size)
+{
+  int32_t v;
+
+  if (raw1 == raw0)
+    return 0;
+  v = ((raw - raw0) * size) / (raw1 - raw0);
+  if (v < 0)
+    v = 0;
+  if (v > size - 1)
+    v = size - 1;
+  return v;
+}
+
+static void __push_edge(TouchFilterType* f, uint32_t t, int32_t x, int32_t y, int pressed)
+{
+  TouchStateType* e;
+
+  if (f->edge_n >= TOUCH_EDGE_MAX) {
+    // ʱһ֤µıһᱻϱ
+    f->dropped++;
+    f->edge_n = TOUCH_EDGE_MAX - 1;
+  }
+  e = &f->edge[f->edge_n++];
+  e->t = t;
+  e->x = (int16_t)x;
+  e->y = (int16_t)y;
+  e->pressed = (uint8_t)pressed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: TOUCH_FilterInit
+//|  |: ʼ˲ʹĬϵȥ/ƽ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: úֱ޸debounce/move_thresh/iir_shift
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void TOUCH_FilterInit(TouchFilterType* f, TouchCalibType const* cal)
+{
+  memset(f, 0, sizeof(*f));
+  f->cal = *cal;
+  f->debounce = 2;
+  f->move_thresh = 1;
+  f->iir_shift = 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: TOUCH_FilterPut
+//|  |: һԭʼ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: /̧Ϊ¼Ŷӣᱻϲ
+//|          |: סڼƶֻ˲꣬TOUCH_FilterGet()ϲϱ
+////////////////////////////////////////////////////////////////////////////////
+void TOUCH_FilterPut(TouchFilterType* f, TouchSampleType const* s)
+{
+  int32_t mx, my, px, py, t;
+
+  if (!s->pressed) {
+    f->down_cnt = 0;
+    f->med_n = 0;
+    if (f->is_down) {
+      f->is_down = 0;
+      __push_edge(f, s->t, (f->fx + 128) >> 8, (f->fy + 128) >> 8, 0);
+    }
+    return;
+  }
+
+  // 3ֵ˲ȥ
+  f->med_x[0] = f->med_x[1];
+  f->med_x[1] = f->med_x[2];
+  f->med_x[2] = s->x;
+  f->med_y[0] = f->med_y[1];
+  f->med_y[1] = f->med_y[2];
+  f->med_y[2] = s->y;
+  if (f->med_n < 3)
+    f->med_n++;
+  if (f->med_n >= 3) {
+    mx = __median3(f->med_x[0], f->med_x[1], f->med_x[2]);
+    my = __median3(f->med_y[0], f->med_y[1], f->med_y[2]);
+  } else {
+    mx = s->x;
+    my = s->y;
+  }
+  if (f->cal.swap_xy) {
+    t = mx;
+    mx = my;
+    my = t;
+  }
+  px = __map_axis(mx, f->cal.raw_x0, f->cal.raw_x1, f->cal.xsize);
+  py = __map_axis(my, f->cal.raw_y0, f->cal.raw_y1, f->cal.ysize);
+  f->t_last = s->t;
+
+  if (!f->is_down) {
+    // ȥǰdebounceֻԤ˲
+    f->fx = px << 8;
+    f->fy = py << 8;
+    if (++f->down_cnt > f->debounce) {
+      f->is_down = 1;
+      __push_edge(f, s->t, px, py, 1);
+    }
+    return;
+  }
+  f->fx += ((px << 8) - f->fx) >> f->iir_shift;
+  f->fy += ((py << 8) - f->fy) >> f->iir_shift;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: TOUCH_FilterGet
+//|  |: ȡһҪϱ״̬
+//|          |:
+//| б |:
+//|          |:
+//|      |: 1=stЧ0=ûҪϱ״̬
+//|          |:
+//| עϢ |: ÿ֡ѭֱ0ÿֻ֡ϱһƶ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int TOUCH_FilterGet(TouchFilterType* f, TouchStateType* st)
+{
+  int32_t x, y, dx, dy;
+
+  if (f->edge_n > 0) {
+    *st = f->edge[0];
+    f->edge_n--;
+    memmove(&f->edge[0], &f->edge[1], f->edge_n * sizeof(f->edge[0]));
+    f->out = *st;
+    return 1;
+  }
+  if (f->is_down) {
+    x = (f->fx + 128) >> 8;
+    y = (f->fy + 128) >> 8;
+    dx = x - f->out.x;
+    dy = y - f->out.y;
+    if (dx < 0)
+      dx = -dx;
+    if (dy < 0)
+      dy = -dy;
+    if (dx >= f->move_thresh || dy >= f->move_thresh) {
+      st->t = f->t_last;
+      st->x = (int16_t)x;
+      st->y = (int16_t)y;
+      st->pressed = 1;
+      f->out = *st;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: TOUCH_FilterIsActive
+//|  |: Ƿڰ»ȥ(ʱҪ֡ѯ)
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int TOUCH_FilterIsActive(TouchFilterType const* f)
+{
+  return (f->is_down || f->down_cnt > 0 || f->edge_n > 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
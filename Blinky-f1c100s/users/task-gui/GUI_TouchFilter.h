@@ -0,0 +1,67 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __GUI_TOUCH_FILTER_H__
+#define __GUI_TOUCH_FILTER_H__
+////////////////////////////////////////////////////////////////////////////////
+// ˲ȥͺϲRTXemWin˻طŹҲֱӱ
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+#define TOUCH_EDGE_MAX  (4)
+
+// ԭʼ(ж)
+typedef struct {
+  uint32_t t;           // ʱ(ms)
+  uint16_t x, y;        // ԭʼADCֵ
+  uint8_t  pressed;     // 0=̧¼
+} TouchSampleType;
+
+// ϱGUI״̬
+typedef struct {
+  uint32_t t;           // ״̬һʱ
+  int16_t  x, y;        // Ļ
+  uint8_t  pressed;
+} TouchStateType;
+
+// ԭʼֵĻУ׼
+typedef struct {
+  int32_t raw_x0, raw_x1;   // Ļ˶Ӧԭʼֵ
+  int32_t raw_y0, raw_y1;   // Ļ˶Ӧԭʼֵ
+  int32_t xsize, ysize;
+  int32_t swap_xy;
+} TouchCalibType;
+
+typedef struct {
+  // 
+  TouchCalibType cal;
+  int32_t debounce;     // ʺĲȶ
+  int32_t move_thresh;  // Сڸƶϱ
+  int32_t iir_shift;    // IIRƽϵΪ1/2^n0ʾƽ
+  // ״̬
+  int32_t down_cnt;
+  int32_t is_down;
+  int32_t med_n;
+  int32_t med_x[3], med_y[3];
+  int32_t fx, fy;       // ˲(8λС)
+  uint32_t t_last;
+  TouchStateType out;   // һϱ״̬
+  TouchStateType edge[TOUCH_EDGE_MAX];
+  int32_t edge_n;
+  uint32_t dropped;     // ض
+} TouchFilterType;
+
+void TOUCH_FilterInit(TouchFilterType* f, TouchCalibType const* cal);
+void TOUCH_FilterPut(TouchFilterType* f, TouchSampleType const* s);
+int  TOUCH_FilterGet(TouchFilterType* f, TouchStateType* st);
+int  TOUCH_FilterIsActive(TouchFilterType const* f);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __GUI_TOUCH_FILTER_H__ */
@@ -0,0 +1,1061 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "usrinc.h"
+#include "GUI_VirtList.h"
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// 
+#ifndef VLIST_SORT_QUEUE
+#define VLIST_SORT_QUEUE      (8)     // гȣ2
+#endif
+
+#define VLIST_EVT_SORT        (0x0001)
+#define VLIST_DIRTY           (0xFFFFFFFEUL)  // aShownʾһҪд
+#define VLIST_ID_LIST         (GUI_ID_LISTVIEW0)
+#define VLIST_ID_SCROLL       (GUI_ID_VSCROLL)
+#define VTREE_EXPANDED        (0x80)
+
+////////////////////////////////////////////////////////////////////////////////
+static U64 __StackSort[4096 / 8] MEM_PI_STACK;
+static __task void __ThreadSort(void);
+static OS_TID _sort_tid = 0;
+
+// ݶֻGUI_Lock()֮ڷ
+static VirtualListType* _req[VLIST_SORT_QUEUE];
+static U16 _req_head = 0;
+static U16 _req_tail = 0;
+static VirtualListType* volatile _sorting = NULL;
+
+/*
+* ɴȡбڻûʱNULL
+* @return:
+*/
+static VirtualListType* __get(WM_HWIN hWin)
+{
+  VirtualListType* p = NULL;
+
+  WM_GetUserData(hWin, &p, sizeof(p));
+  return p;
+}
+
+/*
+* λPosӦĴ洢к
+* @return:
+*/
+static U32 __index(VirtualListType const* p, U32 Pos)
+{
+  if (p->Reverse)
+    Pos = p->NumRows - 1 - Pos;
+  return (p->apOrder[0] != NULL) ? p->apOrder[0][Pos] : Pos;
+}
+
+/*
+* 洢кIndexڵλãֻʱһ
+* @return:
+*/
+static U32 __find_pos(VirtualListType const* p, U32 Index)
+{
+  U32 i;
+
+  if (p->apOrder[0] == NULL)
+    i = Index;
+  else {
+    for (i = 0; i < p->NumRows && p->apOrder[0][i] != Index; i++)
+      ;
+    if (i == p->NumRows)
+      return VLIST_NONE;
+  }
+  return p->Reverse ? p->NumRows - 1 - i : i;
+}
+
+/*
+* лȡһУûоṩҪ水洢кţ򡢵򶼲ʧЧ
+* @return:
+*/
+static VirtualRowType const* __fetch(VirtualListType* p, U32 Index)
+{
+  VirtualRowType* pRow = &p->aCache[Index & (VLIST_CACHE_ROWS - 1)];
+  int c;
+
+  if (pRow->Index == Index) {
+    p->Hits++;
+    return pRow;
+  }
+  p->Misses++;
+  for (c = 0; c < p->NumCols; c++) {
+    pRow->acText[c][0] = 0;
+    p->pfGetText(p->pUser, Index, c, pRow->acText[c], VLIST_MAX_TEXT);
+    pRow->acText[c][VLIST_MAX_TEXT - 1] = 0;
+  }
+  pRow->Index = Index;
+  return pRow;
+}
+
+static void __flush(VirtualListType* p)
+{
+  int i;
+
+  for (i = 0; i < VLIST_CACHE_ROWS; i++)
+    p->aCache[i].Index = VLIST_NONE;
+  for (i = 0; i < VLIST_MAX_VISIBLE; i++)
+    p->aShown[i] = VLIST_DIRTY;
+}
+
+static void __clamp_top(VirtualListType* p)
+{
+  U32 Max = (p->NumRows > (U32)p->NumVisible) ? p->NumRows - p->NumVisible : 0;
+
+  if (p->Top > Max)
+    p->Top = Max;
+}
+
+/*
+* ѿɼдLISTVIEWʾĴ洢кûвԹѡ
+* ֻһйأ޹
+* @return:
+*/
+static void __refresh(VirtualListType* p)
+{
+  VirtualRowType const* pRow;
+  U32 Pos, Index;
+  int r, c, Sel = -1;
+
+  __clamp_top(p);
+  for (r = 0; r < p->NumVisible; r++) {
+    Pos = p->Top + r;
+    Index = (Pos < p->NumRows) ? __index(p, Pos) : VLIST_NONE;
+    if (Index != p->aShown[r]) {
+      p->aShown[r] = Index;
+      pRow = (Index != VLIST_NONE) ? __fetch(p, Index) : NULL;
+      for (c = 0; c < p->NumCols; c++)
+        LISTVIEW_SetItemText(p->hList, c, r, (pRow != NULL) ? pRow->acText[c] : "");
+    }
+    if (Pos == p->SelPos)
+      Sel = r;
+  }
+  if (LISTVIEW_GetSel(p->hList) != Sel)
+    LISTVIEW_SetSel(p->hList, Sel);
+  SCROLLBAR_SetPageSize(p->hScroll, GUI_MAX(p->NumVisible, 1));
+  SCROLLBAR_SetNumItems(p->hScroll, GUI_MAX((int)p->NumRows, 1));
+  SCROLLBAR_SetValue(p->hScroll, (int)p->Top);
+}
+
+/*
+* ͷиһŵ¼УLISTVIEWô
+* @return:
+*/
+static void __layout(VirtualListType* p)
+{
+  GUI_RECT r, ri;
+  int n, h;
+
+  if (p->NumCols == 0)
+    return;
+  if (LISTVIEW_GetNumRows(p->hList) == 0)
+    LISTVIEW_AddRow(p->hList, NULL);
+  LISTVIEW_GetItemRect(p->hList, 0, 0, &r);
+  WM_GetInsideRectExScrollbar(p->hList, &ri);
+  h = r.y1 - r.y0 + 1;
+  n = (ri.y1 - ri.y0 + 1 - HEADER_GetHeight(LISTVIEW_GetHeader(p->hList))) / GUI_MAX(h, 1);
+  n = GUI_MIN(GUI_MAX(n, 1), VLIST_MAX_VISIBLE);
+  while ((int)LISTVIEW_GetNumRows(p->hList) < n)
+    LISTVIEW_AddRow(p->hList, NULL);
+  while ((int)LISTVIEW_GetNumRows(p->hList) > n)
+    LISTVIEW_DeleteRow(p->hList, n);
+  p->NumVisible = n;
+  __flush(p);
+  __refresh(p);
+}
+
+/*
+* ѡλPosü
+* @return:
+*/
+static void __select(VirtualListType* p, U32 Pos)
+{
+  if (p->NumRows == 0)
+    return;
+  if (Pos >= p->NumRows)
+    Pos = p->NumRows - 1;
+  p->SelPos = Pos;
+  if (Pos < p->Top)
+    p->Top = Pos;
+  else if (Pos >= p->Top + p->NumVisible)
+    p->Top = Pos - p->NumVisible + 1;
+  __refresh(p);
+}
+
+/*
+* ѡƶDeltaУûѡʱѡһɼ
+* @return:
+*/
+static void __move(VirtualListType* p, int Delta)
+{
+  U32 Pos = p->SelPos;
+
+  if (Pos == VLIST_NONE)
+    Pos = p->Top;
+  else if (Delta < 0)
+    Pos = (Pos > (U32)-Delta) ? Pos + Delta : 0;
+  else
+    Pos += Delta;
+  __select(p, Pos);
+}
+
+/*
+* һбŽУڶĲظ
+* @return:
+*/
+static int __request(VirtualListType* p)
+{
+  p->SortGen++;
+  if (p->Queued)
+    return 0;
+  if (_sort_tid == 0) {
+    _sort_tid = TSKMON_CreateTask(
+                    "vlist",
+                    __ThreadSort,
+                    TSK_PRIO_LOLIMIT,
+                    __StackSort,
+                    sizeof(__StackSort));
+  }
+  if (_sort_tid == 0 || (U16)(_req_head - _req_tail) >= VLIST_SORT_QUEUE)
+    return -1;
+  _req[_req_head & (VLIST_SORT_QUEUE - 1)] = p;
+  _req_head++;
+  p->Queued = 1;
+  os_evt_set(VLIST_EVT_SORT, _sort_tid);
+  return 0;
+}
+
+/*
+* NumRowsֻλúʾ
+* @return:
+*/
+static void __set_rows(VirtualListType* p, U32 NumRows)
+{
+  int i;
+
+  for (i = 0; i < VLIST_CACHE_ROWS; i++) {
+    if (p->aCache[i].Index >= NumRows)
+      p->aCache[i].Index = VLIST_NONE;
+  }
+  for (i = 0; i < VLIST_MAX_VISIBLE; i++)
+    p->aShown[i] = VLIST_DIRTY;
+  p->NumRows = NumRows;
+  if (p->SelPos != VLIST_NONE && p->SelPos >= NumRows)
+    p->SelPos = VLIST_NONE;
+  __refresh(p);
+}
+
+/*
+* ڵĻصӹLISTVIEW֪ͨ
+* @return:
+*/
+static void __cbWin(WM_MESSAGE* pMsg)
+{
+  VirtualListType* p;
+  int Id, NCode, r;
+
+  switch (pMsg->MsgId) {
+  case WM_NOTIFY_PARENT:
+    p = __get(pMsg->hWin);
+    if (p == NULL)
+      break;
+    Id = WM_GetId(pMsg->hWinSrc);
+    NCode = pMsg->Data.v;
+    if (Id == VLIST_ID_SCROLL && NCode == WM_NOTIFICATION_VALUE_CHANGED) {
+      r = SCROLLBAR_GetValue(pMsg->hWinSrc);
+      if ((U32)r != p->Top) {
+        p->Top = r;
+        __refresh(p);
+      }
+    } else if (Id == VLIST_ID_LIST && NCode == WM_NOTIFICATION_SEL_CHANGED) {
+      r = LISTVIEW_GetSel(pMsg->hWinSrc);
+      if (r >= 0 && p->Top + r < p->NumRows && p->Top + r != p->SelPos) {
+        p->SelPos = p->Top + r;
+        WM_NotifyParent(p->hWin, WM_NOTIFICATION_SEL_CHANGED);
+      }
+    } else if (Id == VLIST_ID_LIST && NCode == WM_NOTIFICATION_RELEASED) {
+      if (p->pfActivate != NULL && p->SelPos != VLIST_NONE)
+        p->pfActivate(p->pUser, p->SelPos);
+    }
+    break;
+  case WM_PAINT:
+    break;
+  default:
+    WM_DefaultProc(pMsg);
+  }
+}
+
+/*
+* LISTVIEWĻص·ҳĳȫƶվ
+* @return:
+*/
+static void __cbList(WM_MESSAGE* pMsg)
+{
+  VirtualListType* p;
+  WM_KEY_INFO const* pKey;
+
+  if (pMsg->MsgId == WM_KEY) {
+    pKey = (WM_KEY_INFO const*)pMsg->Data.p;
+    p = __get(WM_GetParent(pMsg->hWin));
+    if (p != NULL && pKey->PressedCnt > 0) {
+      switch (pKey->Key) {
+      case GUI_KEY_UP:
+        __move(p, -1);
+        return;
+      case GUI_KEY_DOWN:
+        __move(p, 1);
+        return;
+      case GUI_KEY_PGUP:
+        __move(p, -p->NumVisible);
+        return;
+      case GUI_KEY_PGDOWN:
+        __move(p, p->NumVisible);
+        return;
+      case GUI_KEY_HOME:
+        __select(p, 0);
+        return;
+      case GUI_KEY_END:
+        __select(p, VLIST_NONE);
+        return;
+      case GUI_KEY_ENTER:
+        if (p->pfActivate != NULL && p->SelPos != VLIST_NONE)
+          p->pfActivate(p->pUser, p->SelPos);
+        return;
+      }
+    }
+  }
+  LISTVIEW_Callback(pMsg);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VLIST_Create
+//|  |: һб
+//|          |:
+//| б |: x0/y0/xSize/ySize/hParent/Id: ͬLISTVIEW_CreateEx()ұ߷Ź
+//|          |: pfGetText/pUser: ṩ
+//|          |:
+//|      |: 0ɹڽ-1
+//|          |:
+//| עϢ |: úGUI_VLIST_AddColumn()УGUI_VLIST_SetNumRows()
+//|          |: յWM_NOTIFICATION_SEL_CHANGEDڡ
+////////////////////////////////////////////////////////////////////////////////
+int GUI_VLIST_Create(VirtualListType* p, int x0, int y0, int xSize, int ySize, WM_HWIN hParent, int Id, VLIST_GET_TEXT_FUNC* pfGetText, void* pUser)
+{
+  int wScroll;
+
+  memset(p, 0, sizeof(*p));
+  p->pfGetText = pfGetText;
+  p->pUser = pUser;
+  p->SortCol = -1;
+  p->SelPos = VLIST_NONE;
+  __flush(p);
+  GUI_Lock();
+  wScroll = SCROLLBAR_GetDefaultWidth();
+  p->hWin = WM_CreateWindowAsChild(x0, y0, xSize, ySize, hParent, WM_CF_SHOW, __cbWin, sizeof(p));
+  if (p->hWin == 0) {
+    GUI_Unlock();
+    return -1;
+  }
+  WM_SetId(p->hWin, Id);
+  p->hList = LISTVIEW_CreateEx(0, 0, xSize - wScroll, ySize, p->hWin, WM_CF_SHOW, 0, VLIST_ID_LIST);
+  p->hScroll = SCROLLBAR_CreateEx(xSize - wScroll, 0, wScroll, ySize, p->hWin, WM_CF_SHOW, SCROLLBAR_CF_VERTICAL, VLIST_ID_SCROLL);
+  if (p->hList == 0 || p->hScroll == 0) {
+    WM_DeleteWindow(p->hWin);
+    p->hWin = 0;
+    GUI_Unlock();
+    return -1;
+  }
+  WM_SetCallback(p->hList, __cbList);
+  WM_SetUserData(p->hWin, &p, sizeof(p));
+  GUI_Unlock();
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VLIST_AddColumn
+//|  |: һ
+//|          |:
+//| б |: ͬLISTVIEW_AddColumn()
+//|          |:
+//|      |: 0ɹVLIST_MAX_COLS-1
+//|          |:
+//| עϢ |: к󰴱ͷ߶һ
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int GUI_VLIST_AddColumn(VirtualListType* p, int Width, const char* s, int Align)
+{
+  if (p->hWin == 0 || p->NumCols >= VLIST_MAX_COLS)
+    return -1;
+  GUI_Lock();
+  LISTVIEW_AddColumn(p->hList, Width, s, Align);
+  p->NumCols++;
+  __layout(p);
+  GUI_Unlock();
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VLIST_EnableSort
+//|  |: бһڴ棬
+//|          |:
+//| б |: pfCompare: ȽϺ
+//|          |: pBuffer: ŵ2*MaxRowsU32ʾһ
+//|          |:
+//|      |: 0ɹезŲ·-1
+//|          |:
+//| עϢ |: ܳMaxRows
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int GUI_VLIST_EnableSort(VirtualListType* p, VLIST_COMPARE_FUNC* pfCompare, U32* pBuffer, U32 MaxRows)
+{
+  U32 i;
+
+  if (p->NumRows > MaxRows)
+    return -1;
+  GUI_Lock();
+  p->pfCompare = pfCompare;
+  p->apOrder[0] = pBuffer;
+  p->apOrder[1] = pBuffer + MaxRows;
+  p->MaxRows = MaxRows;
+  for (i = 0; i < p->NumRows; i++)
+    p->apOrder[0][i] = i;
+  GUI_Unlock();
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VLIST_SetNumRows
+//|  |: 
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ־÷еĴ洢кŽں棬еֲ䣻ԭ
+//|          |: һеĻһСʱ洢кŴڵ
+//|          |: NumRowsСбں̨š
+////////////////////////////////////////////////////////////////////////////////
+void GUI_VLIST_SetNumRows(VirtualListType* p, U32 NumRows)
+{
+  U32 i, j, Old = p->NumRows;
+  int Tail;
+
+  if (p->hWin == 0)
+    return;
+  GUI_Lock();
+  if (p->apOrder[0] != NULL) {
+    NumRows = GUI_MIN(NumRows, p->MaxRows);
+    if (NumRows < Old) {
+      for (i = j = 0; i < Old; i++) {
+        if (p->apOrder[0][i] < NumRows)
+          p->apOrder[0][j++] = p->apOrder[0][i];
+      }
+    } else {
+      for (i = Old; i < NumRows; i++)
+        p->apOrder[0][i] = i;
+    }
+  }
+  Tail = (Old > 0 && p->Top + p->NumVisible >= Old);
+  if (p->SelPos != VLIST_NONE) {
+    if (NumRows < Old)
+      p->SelPos = VLIST_NONE;
+    else if (p->Reverse)
+      p->SelPos += NumRows - Old;
+  }
+  if (Tail && !p->Reverse && NumRows > (U32)p->NumVisible)
+    p->Top = NumRows - p->NumVisible;
+  __set_rows(p, NumRows);
+  if (p->apOrder[0] != NULL && p->SortCol >= 0 && NumRows != Old)
+    __request(p);
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VLIST_Invalidate
+//|  |: ݸˣл棬ɼṩҪ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: бں̨š
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_VLIST_Invalidate(VirtualListType* p)
+{
+  if (p->hWin == 0)
+    return;
+  GUI_Lock();
+  __flush(p);
+  __refresh(p);
+  if (p->apOrder[0] != NULL && p->SortCol >= 0)
+    __request(p);
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VLIST_SetSort
+//|  |: Col
+//|          |:
+//| б |: Col: -1Ϊ洢˳
+//|          |: Reverse: 1Ϊ
+//|          |:
+//|      |: 0ɹû-1
+//|          |:
+//| עϢ |: ֻĵʱЧţʱں̨߳һµ
+//|          |: źǰվʾڼѡ
+////////////////////////////////////////////////////////////////////////////////
+int GUI_VLIST_SetSort(VirtualListType* p, int Col, int Reverse)
+{
+  U32 i;
+  int r = 0;
+
+  if (p->hWin == 0 || Col >= p->NumCols)
+    return -1;
+  GUI_Lock();
+  if (p->Reverse != Reverse) {
+    p->Reverse = Reverse;
+    if (p->SelPos != VLIST_NONE)
+      p->SelPos = p->NumRows - 1 - p->SelPos;
+  }
+  if (Col != p->SortCol) {
+    if (p->apOrder[0] == NULL) {
+      r = -1;
+    } else if (Col < 0) {
+      p->SortCol = Col;
+      p->SortGen++;
+      for (i = 0; i < p->NumRows; i++)
+        p->apOrder[0][i] = i;
+      p->SelPos = VLIST_NONE;
+    } else {
+      p->SortCol = Col;
+      r = __request(p);
+    }
+  }
+  __refresh(p);
+  GUI_Unlock();
+  return r;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VLIST_IsSorting
+//|  |: ̨ǷΪб
+//|          |:
+//| б |:
+//|          |:
+//|      |: 1Ϊ
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int GUI_VLIST_IsSorting(VirtualListType const* p)
+{
+  return p->Queued || _sorting == p;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VLIST_SetTop
+//|  |: λPosʾڵһ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_VLIST_SetTop(VirtualListType* p, U32 Pos)
+{
+  if (p->hWin == 0)
+    return;
+  GUI_Lock();
+  p->Top = Pos;
+  __refresh(p);
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VLIST_SetSel
+//|  |: ѡλPosвü
+//|          |:
+//| б |: Pos: VLIST_NONEΪһ
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_VLIST_SetSel(VirtualListType* p, U32 Pos)
+{
+  if (p->hWin == 0)
+    return;
+  GUI_Lock();
+  __select(p, Pos);
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VLIST_IncSel
+//|  |: ѡƶDeltaУ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_VLIST_IncSel(VirtualListType* p, int Delta)
+{
+  if (p->hWin == 0)
+    return;
+  GUI_Lock();
+  __move(p, Delta);
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VLIST_GetSel
+//|  |: ȡѡеλ
+//|          |:
+//| б |:
+//|          |:
+//|      |: VLIST_NONEΪû
+//|          |:
+//| עϢ |: 洢кGUI_VLIST_GetIndex()㡣
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+U32 GUI_VLIST_GetSel(VirtualListType* p)
+{
+  return p->SelPos;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VLIST_GetIndex
+//|  |: λûɴ洢к
+//|          |:
+//| б |:
+//|          |:
+//|      |: Խ緵VLIST_NONE
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+U32 GUI_VLIST_GetIndex(VirtualListType* p, U32 Pos)
+{
+  U32 Index = VLIST_NONE;
+
+  GUI_Lock();
+  if (Pos < p->NumRows)
+    Index = __index(p, Pos);
+  GUI_Unlock();
+  return Index;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VLIST_Delete
+//|  |: ɾб
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: Ļ̷֣߳ԲGUI_Lock()֮ڵá
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_VLIST_Delete(VirtualListType* p)
+{
+  U16 i;
+
+  GUI_Lock();
+  p->Abort = 1;
+  for (i = _req_tail; i != _req_head; i++) {
+    if (_req[i & (VLIST_SORT_QUEUE - 1)] == p)
+      _req[i & (VLIST_SORT_QUEUE - 1)] = NULL;
+  }
+  p->Queued = 0;
+  while (_sorting == p) {
+    GUI_Unlock();
+    os_dly_wait(1);
+    GUI_Lock();
+  }
+  if (p->hWin != 0)
+    WM_DeleteWindow(p->hWin);
+  p->hWin = 0;
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*
+* ȽУʱ洢кţȷ
+* @return:
+*/
+static int __less(VirtualListType* p, int Col, U32 a, U32 b)
+{
+  int r = p->pfCompare(p->pUser, a, b, Col);
+
+  return (r != 0) ? (r < 0) : (a < b);
+}
+
+static void __sift(VirtualListType* p, int Col, U32* a, U32 i, U32 n)
+{
+  U32 c, t = a[i];
+
+  for (;;) {
+    c = 2 * i + 1;
+    if (c >= n)
+      break;
+    if (c + 1 < n && __less(p, Col, a[c], a[c + 1]))
+      c++;
+    if (!__less(p, Col, t, a[c]))
+      break;
+    a[i] = a[c];
+    i = c;
+  }
+  a[i] = t;
+}
+
+/*
+* óCPU˳㿴ҪҪ
+* @return: 1Ϊ
+*/
+static int __yield(VirtualListType* p, U32 Gen)
+{
+  os_tsk_pass();
+  return p->Abort || p->SortGen != Gen;
+}
+
+/*
+* 򣺲Ҫڴ棬Ҳn*log(n)ÿ³64һCPU
+* @return: 0źã-1Ϊ
+*/
+static int __heapsort(VirtualListType* p, int Col, U32 Gen, U32* a, U32 n)
+{
+  U32 i, t;
+
+  if (n < 2)
+    return 0;
+  for (i = n / 2; i-- > 0;) {
+    __sift(p, Col, a, i, n);
+    if ((i & 63) == 0 && __yield(p, Gen))
+      return -1;
+  }
+  for (i = n - 1; i > 0; i--) {
+    t = a[0];
+    a[0] = a[i];
+    a[i] = t;
+    __sift(p, Col, a, 0, i);
+    if ((i & 63) == 0 && __yield(p, Gen))
+      return -1;
+  }
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: __ThreadSort
+//|  |: ߳
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ʾõһݵһţȽϺãź
+//|          |: ڼûµûڻϣ򶪵ɶ
+//|          |: š
+////////////////////////////////////////////////////////////////////////////////
+static __task void __ThreadSort(void)
+{
+  VirtualListType* p;
+  U32 Gen, n, Index, *t;
+  int Col, r;
+
+  for (;;) {
+    os_evt_wait_or(VLIST_EVT_SORT, 0xFFFF);
+    for (;;) {
+      GUI_Lock();
+      if (_req_tail == _req_head) {
+        GUI_Unlock();
+        break;
+      }
+      p = _req[_req_tail & (VLIST_SORT_QUEUE - 1)];
+      _req_tail++;
+      if (p == NULL) {
+        GUI_Unlock();
+        continue;
+      }
+      p->Queued = 0;
+      _sorting = p;
+      Gen = p->SortGen;
+      Col = p->SortCol;
+      n = p->NumRows;
+      memcpy(p->apOrder[1], p->apOrder[0], n * sizeof(U32));
+      GUI_Unlock();
+
+      r = __heapsort(p, Col, Gen, p->apOrder[1], n);
+
+      GUI_Lock();
+      if (r == 0 && !p->Abort && Gen == p->SortGen && n == p->NumRows) {
+        Index = (p->SelPos != VLIST_NONE) ? __index(p, p->SelPos) : VLIST_NONE;
+        t = p->apOrder[0];
+        p->apOrder[0] = p->apOrder[1];
+        p->apOrder[1] = t;
+        if (Index != VLIST_NONE)
+          p->SelPos = __find_pos(p, Index);
+        __refresh(p);
+      }
+      _sorting = NULL;
+      GUI_Unlock();
+      os_tsk_pass();
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*
+* бṩߣչǺͽڵƴһ
+* @return:
+*/
+static void __tree_text(void* p, U32 Index, int Col, char* acText, int MaxLen)
+{
+  VirtualTreeType* pTree = (VirtualTreeType*)p;
+  U32 Node = pTree->pNode[Index];
+  int d = pTree->pDepth[Index] & ~VTREE_EXPANDED, n = 0;
+
+  GUI_USE_PARA(Col);
+  while (d-- > 0 && n < MaxLen - 3) {
+    acText[n++] = ' ';
+    acText[n++] = ' ';
+  }
+  if (n > MaxLen - 3)
+    n = MaxLen - 3;
+  if (pTree->pDepth[Index] & VTREE_EXPANDED)
+    acText[n++] = '-';
+  else if (pTree->pfGetNumChildren(pTree->pUser, Node) > 0)
+    acText[n++] = '+';
+  else
+    acText[n++] = ' ';
+  acText[n++] = ' ';
+  acText[n] = 0;
+  pTree->pfGetText(pTree->pUser, Node, acText + n, MaxLen - n);
+}
+
+static void __tree_activate(void* p, U32 Pos)
+{
+  GUI_VTREE_Toggle((VirtualTreeType*)p, Pos);
+}
+
+/*
+* Ժ洢кƶлȫ
+* @return:
+*/
+static void __tree_rows(VirtualTreeType* pTree, U32 NumRows)
+{
+  __flush(&pTree->List);
+  __set_rows(&pTree->List, NumRows);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VTREE_Create
+//|  |: һ
+//|          |:
+//| б |: pfGetNumChildren/pfGetChild/pfGetText/pUser: ṩߣڵΪ0
+//|          |: pNode/pDepth/MaxRows: ̯ƽõűܷMaxRows
+//|          |:
+//|      |: 0ɹ-1
+//|          |:
+//| עϢ |: ʼʱڵӽڵ㶼ġسչѡеĽڵ㡣
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int GUI_VTREE_Create(VirtualTreeType* pTree, int x0, int y0, int xSize, int ySize, WM_HWIN hParent, int Id,
+                     VTREE_GET_NUM_CHILDREN_FUNC* pfGetNumChildren, VTREE_GET_CHILD_FUNC* pfGetChild,
+                     VTREE_GET_TEXT_FUNC* pfGetText, void* pUser, U32* pNode, U8* pDepth, U32 MaxRows)
+{
+  U32 i, n;
+
+  pTree->pfGetNumChildren = pfGetNumChildren;
+  pTree->pfGetChild = pfGetChild;
+  pTree->pfGetText = pfGetText;
+  pTree->pUser = pUser;
+  pTree->pNode = pNode;
+  pTree->pDepth = pDepth;
+  pTree->MaxRows = MaxRows;
+  if (GUI_VLIST_Create(&pTree->List, x0, y0, xSize, ySize, hParent, Id, __tree_text, pTree) != 0)
+    return -1;
+  pTree->List.pfActivate = __tree_activate;
+  GUI_Lock();
+  LISTVIEW_SetHeaderHeight(pTree->List.hList, 0);
+  GUI_VLIST_AddColumn(&pTree->List, WM_GetWindowSizeX(pTree->List.hList), "", GUI_TA_LEFT);
+  n = GUI_MIN(pfGetNumChildren(pUser, 0), MaxRows);
+  for (i = 0; i < n; i++) {
+    pNode[i] = pfGetChild(pUser, 0, i);
+    pDepth[i] = 0;
+  }
+  __tree_rows(pTree, n);
+  GUI_Unlock();
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VTREE_Expand
+//|  |: չλPosĽڵ
+//|          |:
+//| б |:
+//|          |:
+//|      |: 0ɹŲ·-1
+//|          |:
+//| עϢ |: ӽڵ棬ģֻһκС
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+int GUI_VTREE_Expand(VirtualTreeType* pTree, U32 Pos)
+{
+  VirtualListType* p = &pTree->List;
+  U32 i, n, Node;
+  U8 d;
+
+  GUI_Lock();
+  if (Pos >= p->NumRows || (pTree->pDepth[Pos] & VTREE_EXPANDED)) {
+    GUI_Unlock();
+    return 0;
+  }
+  Node = pTree->pNode[Pos];
+  n = pTree->pfGetNumChildren(pTree->pUser, Node);
+  if (p->NumRows + n > pTree->MaxRows) {
+    GUI_Unlock();
+    return -1;
+  }
+  d = pTree->pDepth[Pos] + 1;
+  memmove(pTree->pNode + Pos + 1 + n, pTree->pNode + Pos + 1, (p->NumRows - Pos - 1) * sizeof(U32));
+  memmove(pTree->pDepth + Pos + 1 + n, pTree->pDepth + Pos + 1, p->NumRows - Pos - 1);
+  for (i = 0; i < n; i++) {
+    pTree->pNode[Pos + 1 + i] = pTree->pfGetChild(pTree->pUser, Node, i);
+    pTree->pDepth[Pos + 1 + i] = GUI_MIN(d, VTREE_EXPANDED - 1);
+  }
+  pTree->pDepth[Pos] |= VTREE_EXPANDED;
+  if (p->SelPos != VLIST_NONE && p->SelPos > Pos)
+    p->SelPos += n;
+  __tree_rows(pTree, p->NumRows + n);
+  GUI_Unlock();
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VTREE_Collapse
+//|  |: λPosĽڵ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: һȥѡĻѡڵ㡣
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_VTREE_Collapse(VirtualTreeType* pTree, U32 Pos)
+{
+  VirtualListType* p = &pTree->List;
+  U32 End, n;
+  U8 d;
+
+  GUI_Lock();
+  if (Pos >= p->NumRows || !(pTree->pDepth[Pos] & VTREE_EXPANDED)) {
+    GUI_Unlock();
+    return;
+  }
+  d = pTree->pDepth[Pos] & ~VTREE_EXPANDED;
+  for (End = Pos + 1; End < p->NumRows && (pTree->pDepth[End] & ~VTREE_EXPANDED) > d; End++)
+    ;
+  n = End - Pos - 1;
+  memmove(pTree->pNode + Pos + 1, pTree->pNode + End, (p->NumRows - End) * sizeof(U32));
+  memmove(pTree->pDepth + Pos + 1, pTree->pDepth + End, p->NumRows - End);
+  pTree->pDepth[Pos] = d;
+  if (p->SelPos != VLIST_NONE && p->SelPos > Pos)
+    p->SelPos = (p->SelPos < End) ? Pos : p->SelPos - n;
+  if (p->Top > Pos)
+    p->Top = (p->Top < End) ? Pos : p->Top - n;
+  __tree_rows(pTree, p->NumRows - n);
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VTREE_Toggle
+//|  |: չλPosĽڵ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_VTREE_Toggle(VirtualTreeType* pTree, U32 Pos)
+{
+  GUI_Lock();
+  if (Pos < pTree->List.NumRows && (pTree->pDepth[Pos] & VTREE_EXPANDED))
+    GUI_VTREE_Collapse(pTree, Pos);
+  else
+    GUI_VTREE_Expand(pTree, Pos);
+  GUI_Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VTREE_GetNode
+//|  |: ȡλPosĽڵ
+//|          |:
+//| б |:
+//|          |:
+//|      |: Խ緵VLIST_NONE
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+U32 GUI_VTREE_GetNode(VirtualTreeType* pTree, U32 Pos)
+{
+  U32 Node = VLIST_NONE;
+
+  GUI_Lock();
+  if (Pos < pTree->List.NumRows)
+    Node = pTree->pNode[Pos];
+  GUI_Unlock();
+  return Node;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: GUI_VTREE_Delete
+//|  |: ɾ
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |:
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+void GUI_VTREE_Delete(VirtualTreeType* pTree)
+{
+  GUI_VLIST_Delete(&pTree->List);
+}
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,119 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#ifndef __GUI_VIRT_LIST_H__
+#define __GUI_VIRT_LIST_H__
+////////////////////////////////////////////////////////////////////////////////
+// бLISTVIEWֻһУԱߵĹʾʾЩ
+// ṩҪЩе֣ҪзһСл򲻰
+// ݣֻں̨߳һкźúŻϡ
+// չĽڵ̯ƽһһڵ㣬бʾ
+////////////////////////////////////////////////////////////////////////////////
+#include "GUI.h"
+#include "LISTVIEW.h"
+#include "SCROLLBAR.h"
+
+#ifdef __cplusplus
+extern "C"  {
+#endif
+
+// 
+#ifndef VLIST_MAX_COLS
+#define VLIST_MAX_COLS        (4)     // 
+#endif
+#ifndef VLIST_MAX_TEXT
+#define VLIST_MAX_TEXT        (32)    // ÿֽβ0
+#endif
+#ifndef VLIST_CACHE_ROWS
+#define VLIST_CACHE_ROWS      (64)    // л2
+#endif
+#ifndef VLIST_MAX_VISIBLE
+#define VLIST_MAX_VISIBLE     (48)    // LISTVIEWŵ
+#endif
+
+#define VLIST_NONE            (0xFFFFFFFFUL)
+
+// ȡ洢˳IndexеColе
+typedef void VLIST_GET_TEXT_FUNC(void* p, U32 Index, int Col, char* acText, int MaxLen);
+// Ƚϴ洢˳ڵColϵĴС߳ãGUI_Lock()֮
+typedef int  VLIST_COMPARE_FUNC(void* p, U32 Index0, U32 Index1, int Col);
+// ѡб˻س
+typedef void VLIST_ACTIVATE_FUNC(void* p, U32 Pos);
+
+typedef struct {
+  U32 Index;                  // 洢˳кţVLIST_NONEΪ
+  char acText[VLIST_MAX_COLS][VLIST_MAX_TEXT];
+} VirtualRowType;
+
+typedef struct {
+  WM_HWIN hWin;               // ڣLISTVIEW͹Ӵ
+  LISTVIEW_Handle hList;
+  SCROLLBAR_Handle hScroll;
+  VLIST_GET_TEXT_FUNC* pfGetText;
+  VLIST_COMPARE_FUNC* pfCompare;
+  VLIST_ACTIVATE_FUNC* pfActivate;
+  void* pUser;
+  int NumCols;
+  int NumVisible;             // LISTVIEW
+  U32 NumRows;                // 
+  U32 MaxRows;                // ܷŵ
+  U32* apOrder[2];            // ʾõĺͺ̨õNULLΪ
+  int SortCol;                // -1Ϊ洢˳
+  int Reverse;
+  U32 Top;                    // һɼеλ
+  U32 SelPos;                 // ѡеλãVLIST_NONEΪû
+  U32 aShown[VLIST_MAX_VISIBLE];  // LISTVIEWÿʾĴ洢к
+  VirtualRowType aCache[VLIST_CACHE_ROWS];
+  U32 Hits;
+  U32 Misses;
+  volatile U32 SortGen;       // ÿҪż1߳̾ݴ˶ʱĽ
+  volatile U8 Queued;
+  volatile U8 Abort;
+} VirtualListType;
+
+// ȡڵNodeӽڵڵΪ0
+typedef U32  VTREE_GET_NUM_CHILDREN_FUNC(void* p, U32 Node);
+// ȡڵNodeĵChildӽڵ
+typedef U32  VTREE_GET_CHILD_FUNC(void* p, U32 Node, U32 Child);
+// ȡڵNode
+typedef void VTREE_GET_TEXT_FUNC(void* p, U32 Node, char* acText, int MaxLen);
+
+typedef struct {
+  VirtualListType List;
+  VTREE_GET_NUM_CHILDREN_FUNC* pfGetNumChildren;
+  VTREE_GET_CHILD_FUNC* pfGetChild;
+  VTREE_GET_TEXT_FUNC* pfGetText;
+  void* pUser;
+  U32* pNode;                 // ̯ƽÿеĽڵ
+  U8* pDepth;                 // ÿеĲΣλΪչ
+  U32 MaxRows;
+} VirtualTreeType;
+
+int  GUI_VLIST_Create(VirtualListType* p, int x0, int y0, int xSize, int ySize, WM_HWIN hParent, int Id, VLIST_GET_TEXT_FUNC* pfGetText, void* pUser);
+int  GUI_VLIST_AddColumn(VirtualListType* p, int Width, const char* s, int Align);
+int  GUI_VLIST_EnableSort(VirtualListType* p, VLIST_COMPARE_FUNC* pfCompare, U32* pBuffer, U32 MaxRows);
+void GUI_VLIST_SetNumRows(VirtualListType* p, U32 NumRows);
+void GUI_VLIST_Invalidate(VirtualListType* p);
+int  GUI_VLIST_SetSort(VirtualListType* p, int Col, int Reverse);
+int  GUI_VLIST_IsSorting(VirtualListType const* p);
+void GUI_VLIST_SetTop(VirtualListType* p, U32 Pos);
+void GUI_VLIST_SetSel(VirtualListType* p, U32 Pos);
+void GUI_VLIST_IncSel(VirtualListType* p, int Delta);
+U32  GUI_VLIST_GetSel(VirtualListType* p);
+U32  GUI_VLIST_GetIndex(VirtualListType* p, U32 Pos);
+void GUI_VLIST_Delete(VirtualListType* p);
+
+int  GUI_VTREE_Create(VirtualTreeType* pTree, int x0, int y0, int xSize, int ySize, WM_HWIN hParent, int Id,
+                      VTREE_GET_NUM_CHILDREN_FUNC* pfGetNumChildren, VTREE_GET_CHILD_FUNC* pfGetChild,
+                      VTREE_GET_TEXT_FUNC* pfGetText, void* pUser, U32* pNode, U8* pDepth, U32 MaxRows);
+int  GUI_VTREE_Expand(VirtualTreeType* pTree, U32 Pos);
+void GUI_VTREE_Collapse(VirtualTreeType* pTree, U32 Pos);
+void GUI_VTREE_Toggle(VirtualTreeType* pTree, U32 Pos);
+U32  GUI_VTREE_GetNode(VirtualTreeType* pTree, U32 Pos);
+void GUI_VTREE_Delete(VirtualTreeType* pTree);
+
+#ifdef __cplusplus
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+#endif /* __GUI_VIRT_LIST_H__ */
@@ -0,0 +1,305 @@
+// ļɺҫƣʹȨַȨ㣡
+// ͨQQϵˣ2675045224Сʱغ
+#include "usrinc.h"
+#include "framebuffer.h"
+#include <stdio.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Զ̻棺ʾĻ水16x16ֿ飬ϴηݱȽ(ÿһɢֵ)
+// ֻѱ仯ĿRLEѹUART0ȥtools/fb-stream롢ʾ
+// ¼ơûĻĲ̨Ҳܿ棬¼ֱ֡ڻعȶԡ
+//
+// ÿħУ飬̨ıһҲܱ˷
+////////////////////////////////////////////////////////////////////////////////
+// 
+#ifndef STREAM_EN
+#define STREAM_EN         (0)         // 1=߳(ռUART0)
+#endif
+#ifndef STREAM_FPS
+#define STREAM_FPS        (10)        // ֡ʣʵ֡ʻܴڴ
+#endif
+#ifndef STREAM_KEY_FRAMES
+#define STREAM_KEY_FRAMES (100)       // ÿ֡طһΣ;Ͷֽںָ
+#endif
+
+#if (STREAM_EN > 0)
+
+#if (FB_LAYER0_BPP != 32)
+#error "STREAM_EN needs FB_LAYER0_BPP == 32"
+#endif
+
+// Э飬tools/fb-stream/fbstream_view.cһ(С)
+//   ͷ16ֽڣmagic[4] type[1] version[1] len[2] seq[4] width[2] height[2]
+//   Ȼlenֽڵݣadler32[4](typeĩβ)
+//   STREAM_PKT_TILEݣx[2] y[2] w[1] h[1] 
+//   STREAM_PKT_FRAMEݣtiles[2] flags[2] ms[4]һ֡Ŀ鷢󷢳
+//   룺ÿǺһֽڣ2λΪ6λΪ-1
+//     STREAM_OP_COPY n(B,G,Rһֽ)
+//     STREAM_OP_FILL 1أظn
+//     STREAM_OP_UP   nһͬ
+#define STREAM_MAGIC      (0x54534246UL)  // "FBST"
+#define STREAM_VERSION    (1)
+#define STREAM_PKT_TILE   (0)
+#define STREAM_PKT_FRAME  (1)
+#define STREAM_FLAG_KEY   (1 << 0)
+#define STREAM_OP_COPY    (0)
+#define STREAM_OP_FILL    (1)
+#define STREAM_OP_UP      (2)
+#define STREAM_HDR_SIZE   (16)
+
+#define STREAM_TILE       (16)
+#define STREAM_MAX_TILES  (((1024 + STREAM_TILE - 1) / STREAM_TILE) * ((600 + STREAM_TILE - 1) / STREAM_TILE))
+// ±벻ÿ4ֽ
+#define STREAM_PKT_MAX    (STREAM_HDR_SIZE + 6 + 4 * STREAM_TILE * STREAM_TILE + 4)
+
+#define STREAM_EVT_FRAME  (0x0001)
+
+////////////////////////////////////////////////////////////////////////////////
+static U64 __StackStream[1024 / 8] MEM_PI_STACK;
+static __task void __ThreadStream(void);
+static OS_TID _stream_tid = 0;
+
+static uint32_t _hash[STREAM_MAX_TILES];     // ÿϴηݵɢֵ
+static uint32_t _tile[STREAM_TILE * STREAM_TILE];
+static uint8_t _pkt[STREAM_PKT_MAX];
+
+static void __put16(uint8_t* p, uint32_t v)
+{
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void __put32(uint8_t* p, uint32_t v)
+{
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t __adler32(uint8_t const* p, uint32_t n)
+{
+  uint32_t a = 1, b = 0;
+
+  while (n--) {
+    a = (a + *p++) % 65521;
+    b = (b + a) % 65521;
+  }
+  return (b << 16) | a;
+}
+
+static uint32_t __hash(uint32_t const* px, uint32_t n)
+{
+  uint32_t h = 2166136261UL;
+
+  while (n--) {
+    h = (h ^ (*px++ & 0x00ffffff)) * 16777619UL;
+  }
+  return h;
+}
+
+static uint8_t* __put_pixel(uint8_t* o, uint32_t c)
+{
+  o[0] = (uint8_t)c;
+  o[1] = (uint8_t)(c >> 8);
+  o[2] = (uint8_t)(c >> 16);
+  return o + 3;
+}
+
+/*
+* һ飺ͬɫFILLһͬUPԭCOPY
+* @return: ֽ
+*/
+static uint32_t __encode(uint32_t const* px, int w, int n, uint8_t* out)
+{
+  uint8_t* o = out;
+  int i = 0, k, r, l;
+
+  while (i < n) {
+    for (k = 0; i >= w && i + k < n && k < 64 && px[i + k] == px[i + k - w]; k++);
+    for (r = 1; i + r < n && r < 64 && px[i + r] == px[i]; r++);
+    if (k >= 2 && k >= r) {
+      *o++ = (uint8_t)((STREAM_OP_UP << 6) | (k - 1));
+      i += k;
+    } else if (r >= 2) {
+      *o++ = (uint8_t)((STREAM_OP_FILL << 6) | (r - 1));
+      o = __put_pixel(o, px[i]);
+      i += r;
+    } else {
+      // ԭһֱһFILLUPʼ
+      for (l = 1; i + l < n && l < 64; l++) {
+        if (i + l + 1 < n && px[i + l + 1] == px[i + l])
+          break;
+        if (i + l >= w && i + l + 1 < n &&
+            px[i + l] == px[i + l - w] && px[i + l + 1] == px[i + l + 1 - w])
+          break;
+      }
+      *o++ = (uint8_t)((STREAM_OP_COPY << 6) | (l - 1));
+      for (; l > 0; l--, i++)
+        o = __put_pixel(o, px[i]);
+    }
+  }
+  return (uint32_t)(o - out);
+}
+
+/*
+* ͷУ鲢ȥ
+* @return: none
+*/
+static void __send(uint32_t type, uint32_t len, uint32_t seq, fb_panel_t const* panel)
+{
+  uint32_t total = STREAM_HDR_SIZE + len + 4;
+
+  __put32(&_pkt[0], STREAM_MAGIC);
+  _pkt[4] = (uint8_t)type;
+  _pkt[5] = STREAM_VERSION;
+  __put16(&_pkt[6], len);
+  __put32(&_pkt[8], seq);
+  __put16(&_pkt[12], (uint32_t)panel->width);
+  __put16(&_pkt[14], (uint32_t)panel->height);
+  __put32(&_pkt[STREAM_HDR_SIZE + len], __adler32(&_pkt[4], STREAM_HDR_SIZE - 4 + len));
+  // ͻ岻ʱ˯ߵȴGUIʱƬæ
+  while (f1c100s_uart_txfree() < total) {
+    sys_yield();
+  }
+  f1c100s_uart_write(_pkt, total, UART_TX_BLOCK | UART_TX_RAW);
+}
+
+/*
+* ɨһ֡ݱ˵Ŀ(keyʱȫ)
+* @return: Ŀ
+*/
+static uint32_t __send_tiles(framebuffer_t* fb, fb_panel_t const* panel, uint32_t seq, int key)
+{
+  uint32_t const* src;
+  uint32_t h, len, sent = 0;
+  int32_t vwidth, vheight;
+  int tx, ty, x, y, w, th, t = 0;
+  fb_state_t st;
+
+  fb_f1c100s_get_vsize(&vwidth, &vheight);
+  fb_f1c100s_begin(fb, &st);
+  for (ty = 0; ty < panel->height; ty += STREAM_TILE) {
+    th = (panel->height - ty < STREAM_TILE) ? panel->height - ty : STREAM_TILE;
+    for (tx = 0; tx < panel->width; tx += STREAM_TILE, t++) {
+      w = (panel->width - tx < STREAM_TILE) ? panel->width - tx : STREAM_TILE;
+      // ȿɢкͱõͬһݣڷڼһ֡ٷ
+      src = (uint32_t const*)st.base + (st.yorg + ty) * vwidth + st.xorg + tx;
+      for (y = 0; y < th; y++) {
+        for (x = 0; x < w; x++)
+          _tile[y * w + x] = src[y * vwidth + x];
+      }
+      h = __hash(_tile, w * th);
+      if (!key && h == _hash[t])
+        continue;
+      _hash[t] = h;
+      __put16(&_pkt[STREAM_HDR_SIZE + 0], tx);
+      __put16(&_pkt[STREAM_HDR_SIZE + 2], ty);
+      _pkt[STREAM_HDR_SIZE + 4] = (uint8_t)w;
+      _pkt[STREAM_HDR_SIZE + 5] = (uint8_t)th;
+      len = 6 + __encode(_tile, w, w * th, &_pkt[STREAM_HDR_SIZE + 6]);
+      __send(STREAM_PKT_TILE, len, seq, panel);
+      sent++;
+    }
+    // ÿɨһпóCPUGUI߳뱾߳ͬΪȼ
+    sys_yield();
+  }
+  return sent;
+}
+
+/* ֡жãһ֡Ѿ */
+static void __frame_cb(void* arg)
+{
+  (void)arg;
+  isr_evt_set(STREAM_EVT_FRAME, _stream_tid);
+}
+
+#endif /* STREAM_EN */
+
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: APP_CreateStreamService
+//|  |: ߳
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: STREAM_ENΪ0ʱʲô
+//|          |:
+////////////////////////////////////////////////////////////////////////////////
+bool_t APP_CreateStreamService(void)
+{
+#if (STREAM_EN > 0)
+  fb_panel_t const* panel = fb_f1c100s_get_panel();
+  uint32_t tiles;
+
+  tiles = ((panel->width + STREAM_TILE - 1) / STREAM_TILE) * ((panel->height + STREAM_TILE - 1) / STREAM_TILE);
+  if (tiles > STREAM_MAX_TILES) {
+    DBG_PUTS("Stream: panel too large.\n");
+    return false;
+  }
+  _stream_tid = TSKMON_CreateTask(
+                    "stream",
+                    __ThreadStream,
+                    TSK_PRIO_LOLIMIT,
+                    __StackStream,
+                    sizeof(__StackStream));
+
+  if (_stream_tid == 0) {
+    DBG_PUTS("Stream failed.\n");
+    return false;
+  }
+#endif
+  return true;
+}
+
+#if (STREAM_EN > 0)
+////////////////////////////////////////////////////////////////////////////////
+//|          |
+//|  |: __ThreadStream
+//|  |: ߳
+//|          |:
+//| б |:
+//|          |:
+//|      |:
+//|          |:
+//| עϢ |: ÿ֡һvblankæʱмֱ֡Ӷ
+//|          |: ֡ʱ˾ݴʵ֡ʡ
+////////////////////////////////////////////////////////////////////////////////
+static __task void __ThreadStream(void)
+{
+  framebuffer_t* fb = LCDCONF_GetFramebuffer();
+  fb_panel_t const* panel = fb_f1c100s_get_panel();
+  fb_state_t st;
+  uint32_t n = 0, tiles;
+  int key;
+  U32 tmr;
+
+  // ʾʼ
+  while (fb->priv == NULL) {
+    sys_delay(100);
+  }
+  for (;;) {
+    timer_start(&tmr);
+    st.flags = 0;
+    if (fb_f1c100s_commit(fb, &st, __frame_cb, NULL) != 0) {
+      sys_yield();
+      continue;
+    }
+    os_evt_wait_or(STREAM_EVT_FRAME, TWAIT_FOREVER);
+    key = (n % STREAM_KEY_FRAMES) == 0;
+    tiles = __send_tiles(fb, panel, n, key);
+    __put16(&_pkt[STREAM_HDR_SIZE + 0], tiles);
+    __put16(&_pkt[STREAM_HDR_SIZE + 2], key ? STREAM_FLAG_KEY : 0);
+    __put32(&_pkt[STREAM_HDR_SIZE + 4], sys_tick);
+    __send(STREAM_PKT_FRAME, 8, n, panel);
+    n++;
+    if (!timer_expired(&tmr, 1000 / STREAM_FPS)) {
+      sys_delay(1000 / STREAM_FPS - (sys_tick - tmr));
+    }
+  }
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,7 @@
 // ļɺҫƣʹȨַȨ㣡
 // ͨQQϵˣ2675045224Сʱغ
 #include "usrinc.h"
+#include "framebuffer.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 //|          |
@@ -20,6 +21,12 @@ void UserEntryInit(void)
   if (!APP_CreateGuiService()) {
     sys_suspend();
   }
+  if (!APP_CreateTouchService()) {
+    sys_suspend();
+  }
+  if (!APP_CreateStreamService()) {
+    sys_suspend();
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -36,8 +43,22 @@ void UserEntryInit(void)
 ////////////////////////////////////////////////////////////////////////////////
 void UserEntryLoop(void)
 {
+#if (TSKMON_EN > 0) && (TSKMON_REPORT_PERIOD > 0)
+  U32 tmr_report;
+
+  timer_start(&tmr_report);
+#endif
   for (;;) {
     target_wdt_feed();
+#if (TSKMON_EN > 0) && (TSKMON_REPORT_PERIOD > 0)
+    // ԴӡCPUռʺջԼʾˢ
+    if (timer_expired(&tmr_report, TSKMON_REPORT_PERIOD)) {
+      timer_start(&tmr_report);
+      TSKMON_Sample();
+      TSKMON_Report();
+      LCDCONF_ReportRefresh();
+    }
+#endif
     // ѭ
     sys_delay(500);
   }